@@ -0,0 +1,333 @@
+/// @file
+/// @brief Benchmark of QP::QMapHsm against the equivalent QP::QHsm
+/// @cond
+///***************************************************************************
+/// Last updated for version 6.8.2
+/// Last updated on  2020-07-17
+///
+///                    Q u a n t u m  L e a P s
+///                    ------------------------
+///                    Modern Embedded Software
+///
+/// Copyright (C) 2005-2018 Quantum Leaps, LLC. All rights reserved.
+///
+/// This program is open source software: you can redistribute it and/or
+/// modify it under the terms of the GNU General Public License as published
+/// by the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Alternatively, this program may be distributed and modified under the
+/// terms of Quantum Leaps commercial licenses, which expressly supersede
+/// the GNU General Public License and are specifically designed for
+/// licensees interested in retaining the proprietary status of their code.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program. If not, see <www.gnu.org/licenses>.
+///
+/// Contact information:
+/// <www.state-machine.com/licensing>
+/// <info@state-machine.com>
+///***************************************************************************
+/// @endcond
+
+#include "qpcpp.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+using namespace QP;
+
+//----------------------------------------------------------------------------
+// Both state machines have the same six-level hierarchy
+// s0 > s1 > s2 > s3 > s4 > s5 and the same behavior:
+//   s0: A (counted), B (logged), T (transition to s5)
+//   s1: B (logged only when the count is odd, else unhandled),
+//       initial transition to s2
+//   s3: T2 (transition to s1)
+//   s5: X (logged)
+// All states log their entry and exit. N1..N3 are handled nowhere.
+//
+enum BenchSignals {
+    A_SIG = Q_USER_SIG,
+    B_SIG,
+    T_SIG,
+    T2_SIG,
+    X_SIG,
+    N1_SIG,
+    N2_SIG,
+    N3_SIG,
+    MAX_SIG
+};
+
+static std::string l_log; // log of the entries, exits and actions
+static std::uint32_t l_cnt; // count of the A events
+
+extern "C" Q_NORETURN Q_onAssert(char const * const module, int_t const loc)
+{
+    std::fprintf(stderr, "Assertion failed in %s:%d\n", module, loc);
+    std::exit(-1);
+}
+
+//============================================================================
+// the switch-based QHsm
+class SwitchSm : public QHsm {
+public:
+    SwitchSm() : QHsm(Q_STATE_CAST(&SwitchSm::initial)) {}
+
+private:
+    static QState initial(void * const me, QEvt const * const e);
+    static QState s0(void * const me, QEvt const * const e);
+    static QState s1(void * const me, QEvt const * const e);
+    static QState s2(void * const me, QEvt const * const e);
+    static QState s3(void * const me, QEvt const * const e);
+    static QState s4(void * const me, QEvt const * const e);
+    static QState s5(void * const me, QEvt const * const e);
+};
+
+#define ENTRY_EXIT(state_) \
+    case Q_ENTRY_SIG: l_log += #state_ "+"; return Q_RET_HANDLED; \
+    case Q_EXIT_SIG:  l_log += #state_ "-"; return Q_RET_HANDLED;
+
+QState SwitchSm::initial(void * const me, QEvt const * const e) {
+    (void)e; // unused parameter
+    return static_cast<SwitchSm *>(me)->tran(&s5);
+}
+QState SwitchSm::s0(void * const me, QEvt const * const e) {
+    switch (e->sig) {
+        ENTRY_EXIT(s0)
+        case A_SIG: ++l_cnt; return Q_RET_HANDLED;
+        case B_SIG: l_log += "s0B "; return Q_RET_HANDLED;
+        case T_SIG: return static_cast<SwitchSm *>(me)->tran(&s5);
+    }
+    return static_cast<SwitchSm *>(me)->super(&QHsm::top);
+}
+QState SwitchSm::s1(void * const me, QEvt const * const e) {
+    switch (e->sig) {
+        ENTRY_EXIT(s1)
+        case Q_INIT_SIG: return static_cast<SwitchSm *>(me)->tran(&s2);
+        case B_SIG:
+            if ((l_cnt & 1U) != 0U) {
+                l_log += "s1B ";
+                return Q_RET_HANDLED;
+            }
+            return Q_RET_UNHANDLED;
+    }
+    return static_cast<SwitchSm *>(me)->super(&s0);
+}
+QState SwitchSm::s2(void * const me, QEvt const * const e) {
+    switch (e->sig) {
+        ENTRY_EXIT(s2)
+    }
+    return static_cast<SwitchSm *>(me)->super(&s1);
+}
+QState SwitchSm::s3(void * const me, QEvt const * const e) {
+    switch (e->sig) {
+        ENTRY_EXIT(s3)
+        case T2_SIG: return static_cast<SwitchSm *>(me)->tran(&s1);
+    }
+    return static_cast<SwitchSm *>(me)->super(&s2);
+}
+QState SwitchSm::s4(void * const me, QEvt const * const e) {
+    switch (e->sig) {
+        ENTRY_EXIT(s4)
+    }
+    return static_cast<SwitchSm *>(me)->super(&s3);
+}
+QState SwitchSm::s5(void * const me, QEvt const * const e) {
+    switch (e->sig) {
+        ENTRY_EXIT(s5)
+        case X_SIG: l_log += "s5X "; return Q_RET_HANDLED;
+    }
+    return static_cast<SwitchSm *>(me)->super(&s4);
+}
+
+//============================================================================
+// the signal-mapped QMapHsm
+class MapSm : public QMapHsm {
+public:
+    MapSm() : QMapHsm(Q_STATE_CAST(&MapSm::initial)) {}
+
+    static QState initial(void * const me, QEvt const * const e);
+
+#define ENTRY_EXIT_HANDLERS(state_) \
+    static QState state_##_entry(void * const, QEvt const * const) { \
+        l_log += #state_ "+"; \
+        return Q_RET_HANDLED; \
+    } \
+    static QState state_##_exit(void * const, QEvt const * const) { \
+        l_log += #state_ "-"; \
+        return Q_RET_HANDLED; \
+    }
+
+    ENTRY_EXIT_HANDLERS(s0)
+    ENTRY_EXIT_HANDLERS(s1)
+    ENTRY_EXIT_HANDLERS(s2)
+    ENTRY_EXIT_HANDLERS(s3)
+    ENTRY_EXIT_HANDLERS(s4)
+    ENTRY_EXIT_HANDLERS(s5)
+
+    static QState s0_A(void * const, QEvt const * const) {
+        ++l_cnt;
+        return Q_RET_HANDLED;
+    }
+    static QState s0_B(void * const, QEvt const * const) {
+        l_log += "s0B ";
+        return Q_RET_HANDLED;
+    }
+    static QState s0_T(void * const me, QEvt const * const e);
+    static QState s1_init(void * const me, QEvt const * const e);
+    static QState s1_B(void * const, QEvt const * const) {
+        if ((l_cnt & 1U) != 0U) {
+            l_log += "s1B ";
+            return Q_RET_HANDLED;
+        }
+        return Q_RET_UNHANDLED;
+    }
+    static QState s3_T2(void * const me, QEvt const * const e);
+    static QState s5_X(void * const, QEvt const * const) {
+        l_log += "s5X ";
+        return Q_RET_HANDLED;
+    }
+};
+
+static constexpr QMapSig s0_map[] {
+    { QMapHsm::Q_ENTRY_SIG, &MapSm::s0_entry },
+    { QMapHsm::Q_EXIT_SIG,  &MapSm::s0_exit  },
+    { A_SIG,                &MapSm::s0_A     },
+    { B_SIG,                &MapSm::s0_B     },
+    { T_SIG,                &MapSm::s0_T     }
+};
+Q_MAP_TOP_STATE(s0, s0_map);
+
+static constexpr QMapSig s1_map[] {
+    { QMapHsm::Q_ENTRY_SIG, &MapSm::s1_entry },
+    { QMapHsm::Q_EXIT_SIG,  &MapSm::s1_exit  },
+    { QMapHsm::Q_INIT_SIG,  &MapSm::s1_init  },
+    { B_SIG,                &MapSm::s1_B     }
+};
+Q_MAP_STATE(s1, s0, s1_map);
+
+static constexpr QMapSig s2_map[] {
+    { QMapHsm::Q_ENTRY_SIG, &MapSm::s2_entry },
+    { QMapHsm::Q_EXIT_SIG,  &MapSm::s2_exit  }
+};
+Q_MAP_STATE(s2, s1, s2_map);
+
+static constexpr QMapSig s3_map[] {
+    { QMapHsm::Q_ENTRY_SIG, &MapSm::s3_entry },
+    { QMapHsm::Q_EXIT_SIG,  &MapSm::s3_exit  },
+    { T2_SIG,               &MapSm::s3_T2    }
+};
+Q_MAP_STATE(s3, s2, s3_map);
+
+static constexpr QMapSig s4_map[] {
+    { QMapHsm::Q_ENTRY_SIG, &MapSm::s4_entry },
+    { QMapHsm::Q_EXIT_SIG,  &MapSm::s4_exit  }
+};
+Q_MAP_STATE(s4, s3, s4_map);
+
+static constexpr QMapSig s5_map[] {
+    { QMapHsm::Q_ENTRY_SIG, &MapSm::s5_entry },
+    { QMapHsm::Q_EXIT_SIG,  &MapSm::s5_exit  },
+    { X_SIG,                &MapSm::s5_X     }
+};
+Q_MAP_STATE(s5, s4, s5_map);
+
+QState MapSm::initial(void * const me, QEvt const * const e) {
+    (void)e; // unused parameter
+    return static_cast<MapSm *>(me)->tran(&QMapHsm::state<s5>);
+}
+QState MapSm::s0_T(void * const me, QEvt const * const e) {
+    (void)e; // unused parameter
+    return static_cast<MapSm *>(me)->tran(&QMapHsm::state<s5>);
+}
+QState MapSm::s1_init(void * const me, QEvt const * const e) {
+    (void)e; // unused parameter
+    return static_cast<MapSm *>(me)->tran(&QMapHsm::state<s2>);
+}
+QState MapSm::s3_T2(void * const me, QEvt const * const e) {
+    (void)e; // unused parameter
+    return static_cast<MapSm *>(me)->tran(&QMapHsm::state<s1>);
+}
+
+//============================================================================
+// log of a reproducible random sequence of events, the same for both
+template<class SM_>
+static std::string runLog(SM_ &sm) {
+    l_log.clear();
+    l_cnt = 0U;
+    sm.init();
+    l_log += "| ";
+    std::srand(7U);
+    for (int i = 0; i < 2000; ++i) {
+        QEvt const e = { static_cast<QSignal>(A_SIG
+                             + (std::rand() % (MAX_SIG - A_SIG))), 0U, 0U };
+        sm.dispatch(&e);
+        l_log += ".";
+    }
+    return l_log;
+}
+//............................................................................
+// best time of one dispatch() of the signal @p sig [ns]
+template<class SM_>
+static double bench(SM_ &sm, QSignal const sig) {
+    static int const N_EVT = 10000000;
+    static int const N_RUN = 5;
+    QEvt const e = { sig, 0U, 0U };
+    double best = 1e9;
+    for (int k = 0; k < N_RUN; ++k) {
+        l_log.clear();
+        auto const t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < N_EVT; ++i) {
+            sm.dispatch(&e);
+        }
+        double const ns = std::chrono::duration<double, std::nano>(
+            std::chrono::steady_clock::now() - t0).count() / N_EVT;
+        if (ns < best) {
+            best = ns;
+        }
+    }
+    return best;
+}
+
+//----------------------------------------------------------------------------
+int main() {
+    static SwitchSm switchSm;
+    static MapSm mapSm;
+
+    std::string const log1 = runLog(switchSm);
+    std::string const log2 = runLog(mapSm);
+    std::printf("behavior: %s (%u bytes of log)\n",
+                (log1 == log2) ? "identical" : "DIFFERENT",
+                static_cast<unsigned>(log1.size()));
+    if (log1 != log2) {
+        return -1;
+    }
+
+    QEvt const t = { T_SIG, 0U, 0U }; // both machines to s5
+    switchSm.dispatch(&t);
+    mapSm.dispatch(&t);
+
+    static struct {
+        char const *name;
+        QSignal sig;
+    } const tests[] = {
+        { "handled 5 levels up", A_SIG  },
+        { "handled in leaf",     X_SIG  },
+        { "ignored",             N1_SIG }
+    };
+    l_log.reserve(1024U);
+    std::printf("%-20s %10s %10s\n", "dispatch() [ns]", "QHsm", "QMapHsm");
+    for (auto const &test : tests) {
+        double const t1 = bench(switchSm, test.sig);
+        double const t2 = bench(mapSm, test.sig);
+        std::printf("%-20s %10.1f %10.1f\n", test.name, t1, t2);
+    }
+    return 0;
+}
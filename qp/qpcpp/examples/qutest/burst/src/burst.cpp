@@ -0,0 +1,65 @@
+#include "qpcpp.hpp"
+#include "burst.hpp"
+
+Q_DEFINE_THIS_FILE
+
+// Burster declaration -------------------------------------------------------
+class Burster : public QActive {
+public:
+    Burster() : QActive(Q_STATE_CAST(&Burster::initial)) {}
+private:
+    static QState initial(Burster * const me, QEvt const * const e);
+    static QState active(Burster * const me, QEvt const * const e);
+};
+
+// Local objects -------------------------------------------------------------
+static Burster l_burster; // the single instance of the Burster AO
+
+// Global-scope objects ------------------------------------------------------
+QActive * const AO_Burster = &l_burster; // "opaque" AO pointer
+
+// Burster::SM ---------------------------------------------------------------
+QState Burster::initial(Burster * const me, QEvt const * const e) {
+    (void)me; // unused parameter
+    (void)e;  // unused parameter
+
+    QS_FUN_DICTIONARY(&QHsm::top);
+    QS_FUN_DICTIONARY(&Burster::initial);
+    QS_FUN_DICTIONARY(&Burster::active);
+
+    QS_SIG_DICTIONARY(DATA_SIG, nullptr);
+    QS_SIG_DICTIONARY(LIFO_SIG, nullptr);
+
+    return Q_TRAN(&Burster::active);
+}
+//............................................................................
+QState Burster::active(Burster * const me, QEvt const * const e) {
+    QState status_;
+    switch (e->sig) {
+        case DATA_SIG: {
+            // the free entries show the events still left in the queue,
+            // which excludes the rest of the current burst
+            QS_BEGIN(DATA, nullptr) // app-specific record
+                QS_U16(0, Q_EVT_CAST(DataEvt)->seq);
+                QS_U8(0, me->m_eQueue.getNFree());
+            QS_END()
+            status_ = Q_HANDLED();
+            break;
+        }
+        case LIFO_SIG: {
+            QS_BEGIN(LIFO, nullptr) // app-specific record
+                QS_U16(0, Q_EVT_CAST(DataEvt)->seq);
+            QS_END()
+            DataEvt *pe = Q_NEW(DataEvt, DATA_SIG);
+            pe->seq = static_cast<uint16_t>(Q_EVT_CAST(DataEvt)->seq + 100U);
+            me->postLIFO(pe);
+            status_ = Q_HANDLED();
+            break;
+        }
+        default: {
+            status_ = Q_SUPER(&QHsm::top);
+            break;
+        }
+    }
+    return status_;
+}
@@ -0,0 +1,24 @@
+#ifndef BURST_HPP
+#define BURST_HPP
+
+using namespace QP;
+
+enum BurstSignals {
+    DATA_SIG = Q_USER_SIG, // data event, reported when dispatched
+    LIFO_SIG,              // posts a data event LIFO to the AO itself
+    MAX_SIG                // the last signal
+};
+
+struct DataEvt : public QEvt {
+    uint16_t seq; // sequence number of the event
+};
+
+// application-specific trace records
+enum BurstRecords {
+    DATA = QS_USER, // DATA_SIG dispatched
+    LIFO            // LIFO_SIG dispatched
+};
+
+extern QActive * const AO_Burster;
+
+#endif // BURST_HPP
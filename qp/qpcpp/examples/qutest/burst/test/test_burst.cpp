@@ -0,0 +1,112 @@
+//****************************************************************************
+// Purpose: Fixture for QUTEST
+// Last updated for version 6.3.5
+// Last updated on  2018-09-17
+//
+//                    Q u a n t u m  L e a P s
+//                    ------------------------
+//                    Modern Embedded Software
+//
+// Copyright (C) 2002-2018 Quantum Leaps, LLC. All rights reserved.
+//
+// This program is open source software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Alternatively, this program may be distributed and modified under the
+// terms of Quantum Leaps commercial licenses, which expressly supersede
+// the GNU General Public License and are specifically designed for
+// licensees interested in retaining the proprietary status of their code.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <www.gnu.org/licenses/>.
+//
+// Contact information:
+// <www.state-machine.com/licensing>
+// <info@state-machine.com>
+//****************************************************************************
+#include "qpcpp.hpp"
+#include "burst.hpp"
+
+Q_DEFINE_THIS_FILE
+
+//............................................................................
+int main(int argc, char *argv[]) {
+    static QF_MPOOL_EL(DataEvt) smlPoolSto[20];
+    static QEvt const *bursterQueueSto[10];
+
+    QF::init();   // initialize the framework and the underlying RT kernel
+
+    // initialize the QS software tracing
+    Q_ALLEGE(QS_INIT(argc > 1 ? argv[1] : nullptr));
+
+    // object dictionaries...
+    QS_OBJ_DICTIONARY(AO_Burster);
+
+    // pause execution of the test and wait for the test script to continue
+    QS_TEST_PAUSE();
+
+    // initialize event pools...
+    QF::poolInit(smlPoolSto, sizeof(smlPoolSto), sizeof(smlPoolSto[0]));
+
+    AO_Burster->start(1U,                  // QP priority of the AO
+                  bursterQueueSto,         // event queue storage
+                  Q_DIM(bursterQueueSto),  // queue length [events]
+                  nullptr, 0U);            // stack storage and size
+
+    return QF::run(); // run the QF application
+}
+
+//----------------------------------------------------------------------------
+void QS::onTestSetup(void) {
+    QS_USR_DICTIONARY(DATA);
+    QS_USR_DICTIONARY(LIFO);
+}
+//............................................................................
+void QS::onTestTeardown(void) {
+}
+
+//............................................................................
+void QS::onCommand(uint8_t cmdId,
+                   uint32_t param1, uint32_t param2, uint32_t param3)
+{
+    switch (cmdId) {
+        case 0: { // post param2 events numbered from param1 at once,
+                  // the event number param3 is LIFO_SIG
+            for (uint32_t seq = param1; seq < param1 + param2; ++seq) {
+                DataEvt *e = Q_NEW(DataEvt,
+                                   (seq == param3) ? LIFO_SIG : DATA_SIG);
+                e->seq = static_cast<uint16_t>(seq);
+                AO_Burster->POST(e, nullptr);
+            }
+            break;
+        }
+        case 1: { // set the burst limit of the AO
+            AO_Burster->setBurst(param1);
+            break;
+        }
+        default:
+            break;
+    }
+}
+//............................................................................
+//! callback function to "massage" the injected QP events (not used here)
+void QS::onTestEvt(QEvt *e) {
+    (void)e; // unused parameter
+}
+//............................................................................
+// callback function to output the posted QP events (not used here)
+void QS::onTestPost(void const *sender, QActive *recipient,
+                    QEvt const *e, bool status)
+{
+    (void)sender;
+    (void)recipient;
+    (void)e;
+    (void)status;
+}
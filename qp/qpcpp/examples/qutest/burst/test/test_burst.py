@@ -0,0 +1,46 @@
+# test-script for QUTest unit testing harness
+# see https://www.state-machine.com/qtools/html
+
+# the AO queue holds 10 events (+1 front event)
+QLEN = 10
+
+# preamble...
+def on_reset():
+    expect_pause()
+    glb_filter(GRP_UA)
+    current_obj(OBJ_SM_AO, "AO_Burster")
+    continue_test()
+
+# tests...
+test("one event at a time by default")
+command(0, 0, 3, 0xFFFF)
+for seq in range(3):
+    expect("@timestamp DATA %d %d" %(seq, QLEN - 1 + seq))
+expect("@timestamp Trg-Done QS_RX_COMMAND")
+
+test("LIFO post in order without bursts", NORESET)
+command(0, 0, 3, 0)
+expect("@timestamp LIFO 0")
+expect("@timestamp DATA 100 %d" %(QLEN - 1))
+expect("@timestamp DATA 1 %d" %(QLEN))
+expect("@timestamp DATA 2 %d" %(QLEN + 1))
+expect("@timestamp Trg-Done QS_RX_COMMAND")
+
+test("events removed from the queue in bursts", NORESET)
+command(1, 4)
+expect("@timestamp Trg-Done QS_RX_COMMAND")
+command(0, 0, 6, 0xFFFF)
+for seq in range(4):
+    expect("@timestamp DATA %d %d" %(seq, QLEN - 1))
+for seq in range(4, 6):
+    expect("@timestamp DATA %d %d" %(seq, QLEN + 1))
+expect("@timestamp Trg-Done QS_RX_COMMAND")
+
+test("LIFO post during a burst asserted", NORESET)
+command(0, 0, 3, 0)
+expect("@timestamp LIFO 0")
+expect("@timestamp =ASSERT= Mod=qf_actq,Loc=220")
+
+test("burst limit out of range")
+command(1, 5)
+expect("@timestamp =ASSERT= Mod=qf_actq,Loc=500")
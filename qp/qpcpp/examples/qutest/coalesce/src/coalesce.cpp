@@ -0,0 +1,59 @@
+#include "qpcpp.hpp"
+#include "coalesce.hpp"
+
+Q_DEFINE_THIS_FILE
+
+// Sensor declaration --------------------------------------------------------
+class Sensor : public QActive {
+public:
+    Sensor() : QActive(Q_STATE_CAST(&Sensor::initial)) {}
+private:
+    static QState initial(Sensor * const me, QEvt const * const e);
+    static QState active(Sensor * const me, QEvt const * const e);
+};
+
+// Local objects -------------------------------------------------------------
+static Sensor l_sensor; // the single instance of the Sensor AO
+
+// Global-scope objects ------------------------------------------------------
+QActive * const AO_Sensor = &l_sensor; // "opaque" AO pointer
+
+// Sensor::SM ----------------------------------------------------------------
+QState Sensor::initial(Sensor * const me, QEvt const * const e) {
+    (void)e; // unused parameter
+
+    // the signals without parameters, which can be merged
+    me->setCoalesce(TIMEOUT_SIG, true);
+    me->setCoalesce(DATA_READY_SIG, true);
+
+    QS_FUN_DICTIONARY(&QHsm::top);
+    QS_FUN_DICTIONARY(&Sensor::initial);
+    QS_FUN_DICTIONARY(&Sensor::active);
+
+    QS_SIG_DICTIONARY(TIMEOUT_SIG,    nullptr);
+    QS_SIG_DICTIONARY(DATA_READY_SIG, nullptr);
+    QS_SIG_DICTIONARY(DATA_SIG,       nullptr);
+
+    return Q_TRAN(&Sensor::active);
+}
+//............................................................................
+QState Sensor::active(Sensor * const me, QEvt const * const e) {
+    QState status_;
+    switch (e->sig) {
+        case TIMEOUT_SIG:    // intentionally fall through
+        case DATA_READY_SIG: // intentionally fall through
+        case DATA_SIG: {
+            QS_BEGIN(RECEIVED, nullptr) // app-specific record
+                QS_SIG(e->sig, nullptr);
+                QS_U16(0, me->getMerged());
+            QS_END()
+            status_ = Q_HANDLED();
+            break;
+        }
+        default: {
+            status_ = Q_SUPER(&QHsm::top);
+            break;
+        }
+    }
+    return status_;
+}
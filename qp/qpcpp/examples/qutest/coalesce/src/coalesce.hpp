@@ -0,0 +1,20 @@
+#ifndef COALESCE_HPP
+#define COALESCE_HPP
+
+using namespace QP;
+
+enum CoalesceSignals {
+    TIMEOUT_SIG = Q_USER_SIG, // coalesced
+    DATA_READY_SIG,           // coalesced
+    DATA_SIG,                 // not coalesced
+    MAX_SIG                   // the last signal (less than QF_EVT_COALESCE)
+};
+
+// application-specific trace records
+enum CoalesceRecords {
+    RECEIVED = QS_USER // event dispatched to the Sensor AO
+};
+
+extern QActive * const AO_Sensor;
+
+#endif // COALESCE_HPP
@@ -0,0 +1,50 @@
+# test-script for QUTest unit testing harness
+# see https://www.state-machine.com/qtools/html
+
+# preamble...
+def on_reset():
+    expect_pause()
+    glb_filter(GRP_UA)
+    current_obj(OBJ_SM_AO, "AO_Sensor")
+    continue_test()
+
+# tests...
+test("identical static events merged while pending")
+command(0, 3)
+expect("@timestamp RECEIVED TIMEOUT_SIG 4")
+expect("@timestamp RECEIVED DATA_READY_SIG 4")
+for i in range(3):
+    expect("@timestamp RECEIVED DATA_SIG 4")
+expect("@timestamp Trg-Done QS_RX_COMMAND")
+
+test("static events queued again once dispatched", NORESET)
+command(0, 1)
+expect("@timestamp RECEIVED TIMEOUT_SIG 4")
+expect("@timestamp RECEIVED DATA_READY_SIG 4")
+expect("@timestamp RECEIVED DATA_SIG 4")
+expect("@timestamp Trg-Done QS_RX_COMMAND")
+
+test("dynamic events not merged", NORESET)
+command(1, 3)
+for i in range(3):
+    expect("@timestamp RECEIVED TIMEOUT_SIG 4")
+expect("@timestamp Trg-Done QS_RX_COMMAND")
+
+test("merged posts traced")
+glb_filter(GRP_UA, GRP_AO)
+command(0, 2)
+expect("@timestamp AO-Post  Sdr=NULL,Obj=AO_Sensor,Evt<Sig=TIMEOUT_SIG,*")
+expect("@timestamp AO-Post  Sdr=NULL,Obj=AO_Sensor,Evt<Sig=DATA_READY_SIG,*")
+expect("@timestamp AO-Post  Sdr=NULL,Obj=AO_Sensor,Evt<Sig=DATA_SIG,*")
+expect("@timestamp AO-Merge Sdr=NULL,Obj=AO_Sensor,Evt<Sig=TIMEOUT_SIG>,Merged=1")
+expect("@timestamp AO-Merge Sdr=NULL,Obj=AO_Sensor,Evt<Sig=DATA_READY_SIG>,Merged=2")
+expect("@timestamp AO-Post  Sdr=NULL,Obj=AO_Sensor,Evt<Sig=DATA_SIG,*")
+expect("@timestamp AO-Get   Obj=AO_Sensor,Evt<Sig=TIMEOUT_SIG,*")
+expect("@timestamp RECEIVED TIMEOUT_SIG 2")
+expect("@timestamp AO-Get   Obj=AO_Sensor,Evt<Sig=DATA_READY_SIG,*")
+expect("@timestamp RECEIVED DATA_READY_SIG 2")
+expect("@timestamp AO-Get   Obj=AO_Sensor,Evt<Sig=DATA_SIG,*")
+expect("@timestamp RECEIVED DATA_SIG 2")
+expect("@timestamp AO-GetL  Obj=AO_Sensor,Evt<Sig=DATA_SIG,*")
+expect("@timestamp RECEIVED DATA_SIG 2")
+expect("@timestamp Trg-Done QS_RX_COMMAND")
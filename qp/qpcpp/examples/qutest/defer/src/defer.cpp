@@ -0,0 +1,101 @@
+#include "qpcpp.hpp"
+#include "defer.hpp"
+
+Q_DEFINE_THIS_FILE
+
+// Deferrer declaration ------------------------------------------------------
+class Deferrer : public QActive {
+    QEQueue m_deferredQueue;
+    QEvt const *m_deferredQSto[DEFER_QLEN];
+    bool m_deferring;
+
+public:
+    Deferrer()
+      : QActive(Q_STATE_CAST(&Deferrer::initial)),
+        m_deferring(true)
+    {}
+
+private:
+    static bool isDataB(QSignal const sig);
+    static QState initial(Deferrer * const me, QEvt const * const e);
+    static QState active(Deferrer * const me, QEvt const * const e);
+};
+
+// Local objects -------------------------------------------------------------
+static Deferrer l_deferrer; // the single instance of the Deferrer AO
+
+// Global-scope objects ------------------------------------------------------
+QActive * const AO_Deferrer = &l_deferrer; // "opaque" AO pointer
+
+// Deferrer::SM --------------------------------------------------------------
+bool Deferrer::isDataB(QSignal const sig) {
+    return sig == DATA_B_SIG;
+}
+//............................................................................
+QState Deferrer::initial(Deferrer * const me, QEvt const * const e) {
+    (void)e; // unused parameter
+
+    me->m_deferredQueue.init(me->m_deferredQSto, Q_DIM(me->m_deferredQSto));
+
+    QS_FUN_DICTIONARY(&QHsm::top);
+    QS_FUN_DICTIONARY(&Deferrer::initial);
+    QS_FUN_DICTIONARY(&Deferrer::active);
+
+    QS_SIG_DICTIONARY(DATA_A_SIG, nullptr);
+    QS_SIG_DICTIONARY(DATA_B_SIG, nullptr);
+    QS_SIG_DICTIONARY(RECALL_SIG, nullptr);
+    QS_SIG_DICTIONARY(DONE_SIG,   nullptr);
+
+    return Q_TRAN(&Deferrer::active);
+}
+//............................................................................
+QState Deferrer::active(Deferrer * const me, QEvt const * const e) {
+    QState status_;
+    switch (e->sig) {
+        case DATA_A_SIG: // intentionally fall through
+        case DATA_B_SIG: {
+            if (me->m_deferring) {
+                // the test fills the deferred queue at most to the brim
+                Q_ALLEGE(me->defer(&me->m_deferredQueue, e));
+            }
+            else {
+                QS_BEGIN(RECALLED, nullptr) // app-specific record
+                    QS_SIG(e->sig, nullptr);
+                    QS_U16(0, Q_EVT_CAST(DataEvt)->seq);
+                QS_END()
+            }
+            status_ = Q_HANDLED();
+            break;
+        }
+        case RECALL_SIG: {
+            std::uint_fast16_t const n = (Q_EVT_CAST(RecallEvt)->kind == 0U)
+                ? me->recallN(&me->m_deferredQueue,
+                              Q_EVT_CAST(RecallEvt)->n)
+                : me->recallIf(&me->m_deferredQueue, &Deferrer::isDataB);
+            QS_BEGIN(RECALL, nullptr) // app-specific record
+                QS_U16(0, n);
+            QS_END()
+
+            // the recalled events are at the front of the queue (LIFO),
+            // so DONE_SIG (FIFO) comes after all of them
+            me->m_deferring = false;
+            static QEvt const doneEvt = { DONE_SIG, 0U, 0U };
+            me->POST(&doneEvt, me);
+            status_ = Q_HANDLED();
+            break;
+        }
+        case DONE_SIG: {
+            me->m_deferring = true;
+            QS_BEGIN(DONE, nullptr) // app-specific record
+                QS_U16(0, me->m_deferredQueue.getNFree());
+            QS_END()
+            status_ = Q_HANDLED();
+            break;
+        }
+        default: {
+            status_ = Q_SUPER(&QHsm::top);
+            break;
+        }
+    }
+    return status_;
+}
@@ -0,0 +1,36 @@
+#ifndef DEFER_HPP
+#define DEFER_HPP
+
+using namespace QP;
+
+enum DeferSignals {
+    DATA_A_SIG = Q_USER_SIG, // data event, deferred until recalled
+    DATA_B_SIG,              // data event, recalled selectively
+    RECALL_SIG,              // recall the deferred data events
+    DONE_SIG,                // all recalled data events processed
+    MAX_SIG                  // the last signal
+};
+
+struct DataEvt : public QEvt {
+    uint16_t seq; // sequence number of the data event
+};
+
+struct RecallEvt : public QEvt {
+    uint16_t n;    // max # events for recallN()
+    uint8_t  kind; // 0: recallN(), 1: recallIf() DATA_B_SIG
+};
+
+// application-specific trace records
+enum DeferRecords {
+    RECALL = QS_USER, // events recalled by the RECALL_SIG
+    RECALLED,         // recalled data event processed
+    DONE              // recalled data events done
+};
+
+// length of the deferred queue, longer than 127 events to exercise
+// the 1-byte QEQueueCtr (the default QF_EQUEUE_CTR_SIZE)
+enum { DEFER_QLEN = 200U };
+
+extern QActive * const AO_Deferrer;
+
+#endif // DEFER_HPP
@@ -0,0 +1,43 @@
+# test-script for QUTest unit testing harness
+# see https://www.state-machine.com/qtools/html
+
+# the deferred queue holds DEFER_QLEN+1 events (see defer.hpp)
+DEFER_QLEN = 200
+
+def expect_recalled(seqs):
+    for seq in seqs:
+        sig = "DATA_B_SIG" if (seq & 1) else "DATA_A_SIG"
+        expect("@timestamp RECALLED %s %d" %(sig, seq))
+
+# preamble...
+def on_reset():
+    expect_pause()
+    glb_filter(GRP_UA)
+    current_obj(OBJ_SM_AO, "AO_Deferrer")
+    continue_test()
+
+# tests...
+test("recallN() from the full deferred queue")
+command(0, 0, DEFER_QLEN + 1)
+expect("@timestamp Trg-Done QS_RX_COMMAND")
+post("RECALL_SIG", pack('<HB', 5, 0))
+expect("@timestamp RECALL 5")
+expect_recalled(range(0, 5))
+expect("@timestamp DONE 5")
+expect("@timestamp Trg-Done QS_RX_EVENT")
+
+test("recallIf() from the wrapped-around deferred queue", NORESET)
+command(0, DEFER_QLEN + 1, 5)
+expect("@timestamp Trg-Done QS_RX_COMMAND")
+post("RECALL_SIG", pack('<HB', 0, 1))
+expect("@timestamp RECALL 101")
+expect_recalled(range(5, DEFER_QLEN + 6, 2))
+expect("@timestamp DONE 101")
+expect("@timestamp Trg-Done QS_RX_EVENT")
+
+test("recallN() of all the events kept in order", NORESET)
+post("RECALL_SIG", pack('<HB', 0xFFFF, 0))
+expect("@timestamp RECALL 100")
+expect_recalled(range(6, DEFER_QLEN + 6, 2))
+expect("@timestamp DONE %d" %(DEFER_QLEN + 1))
+expect("@timestamp Trg-Done QS_RX_EVENT")
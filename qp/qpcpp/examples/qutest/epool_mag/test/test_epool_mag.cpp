@@ -0,0 +1,164 @@
+/// @file
+/// @brief Fixture for QUTEST of the event pool magazines and size classes
+/// @ingroup qs
+/// @cond
+///***************************************************************************
+/// Last updated for version 6.8.2
+/// Last updated on  2020-07-17
+///
+///                    Q u a n t u m  L e a P s
+///                    ------------------------
+///                    Modern Embedded Software
+///
+/// Copyright (C) 2005-2018 Quantum Leaps, LLC. All rights reserved.
+///
+/// This program is open source software: you can redistribute it and/or
+/// modify it under the terms of the GNU General Public License as published
+/// by the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Alternatively, this program may be distributed and modified under the
+/// terms of Quantum Leaps commercial licenses, which expressly supersede
+/// the GNU General Public License and are specifically designed for
+/// licensees interested in retaining the proprietary status of their code.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program. If not, see <www.gnu.org/licenses>.
+///
+/// Contact information:
+/// <www.state-machine.com/licensing>
+/// <info@state-machine.com>
+///***************************************************************************
+/// @endcond
+
+#include "qpcpp.hpp" // for QUTEST
+#include <pthread.h>
+#include <semaphore.h>
+#include <unistd.h>
+
+using namespace QP;
+
+Q_DEFINE_THIS_FILE
+
+//----------------------------------------------------------------------------
+enum {
+    TEST_SIG = Q_USER_SIG // the signal of the allocated events
+};
+
+enum {
+    ALLOC = QS_USER // an event allocated from the pool 'poolId_'
+};
+
+enum {
+    HELPER, // command: another thread allocates and recycles param1 events
+    ALLOC_N // command: allocate param1 events of the size param2
+};
+
+// Local objects -------------------------------------------------------------
+static QEvt *l_evts[16];      // the events allocated by the commands
+static std::uint_fast8_t l_nEvts;
+static std::uint_fast16_t l_helperN; // # events for the helper thread
+static sem_t l_helperDone;    // the helper thread cached its blocks
+
+//............................................................................
+// the helper thread leaves the recycled blocks in its magazine and stays
+// alive, so that only the magazine flush can return them to the pool
+static void *helperThread(void * /*arg*/) {
+    QEvt *evts[16];
+    for (std::uint_fast16_t i = 0U; i < l_helperN; ++i) {
+        evts[i] = QF::newX_(16U, QF_NO_MARGIN, TEST_SIG);
+    }
+    for (std::uint_fast16_t i = 0U; i < l_helperN; ++i) {
+        QF::gc(evts[i]);
+    }
+    sem_post(&l_helperDone);
+    for (;;) {
+        pause();
+    }
+    return nullptr;
+}
+
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[]) {
+    // pools of 8 blocks of 16 bytes and 2 blocks of 64 bytes, matching
+    // the QF_EPOOL_EVT_SIZES defined in the Makefile
+    static std::uint64_t pool1Sto[8U*16U/sizeof(std::uint64_t)];
+    static std::uint64_t pool2Sto[2U*64U/sizeof(std::uint64_t)];
+
+    QF::init();   // initialize the framework and the underlying RT kernel
+
+    // initialize the QS software tracing
+    Q_ALLEGE(QS_INIT(argc > 1 ? argv[1] : nullptr));
+
+    QF::poolInit(pool1Sto, sizeof(pool1Sto), 16U);
+    QF::poolInit(pool2Sto, sizeof(pool2Sto), 64U);
+    sem_init(&l_helperDone, 0, 0U);
+
+    // pause execution of the test and wait for the test script to continue
+    QS_TEST_PAUSE();
+
+    return QF::run(); // run the QF application
+}
+
+//----------------------------------------------------------------------------
+void QS::onTestSetup(void) {
+    QS_USR_DICTIONARY(ALLOC);
+}
+//............................................................................
+void QS::onTestTeardown(void) {
+    for (; l_nEvts > 0U; --l_nEvts) {
+        QF::gc(l_evts[l_nEvts - 1U]);
+    }
+}
+
+//............................................................................
+void QS::onCommand(uint8_t cmdId,
+                   uint32_t param1, uint32_t param2, uint32_t param3)
+{
+    (void)param3; // unused parameter
+    switch (cmdId) {
+        case HELPER: { // wait until the helper thread caches its blocks
+            pthread_t helper;
+            l_helperN = static_cast<std::uint_fast16_t>(param1);
+            Q_ALLEGE(pthread_create(&helper, nullptr, &helperThread,
+                                    nullptr) == 0);
+            sem_wait(&l_helperDone);
+            break;
+        }
+        case ALLOC_N: {
+            for (uint32_t i = 0U; i < param1; ++i) {
+                QEvt * const e = QF::newX_(
+                    static_cast<std::uint_fast16_t>(param2),
+                    QF_NO_MARGIN, TEST_SIG);
+                l_evts[l_nEvts] = e;
+                ++l_nEvts;
+                QS_BEGIN(ALLOC, nullptr) // app-specific record
+                    QS_U8(0, e->poolId_);
+                QS_END()
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+//............................................................................
+//! callback function to "massage" the injected QP events (not used here)
+void QS::onTestEvt(QEvt *e) {
+    (void)e; // unused parameter
+}
+//............................................................................
+// callback function to output the posted QP events (not used here)
+void QS::onTestPost(void const *sender, QActive *recipient,
+                    QEvt const *e, bool status)
+{
+    (void)sender;
+    (void)recipient;
+    (void)e;
+    (void)status;
+}
@@ -0,0 +1,43 @@
+# test-script for QUTest unit testing harness
+# see https://www.state-machine.com/qtools/html
+
+# the commands of the fixture
+HELPER = 0
+ALLOC_N = 1
+
+def alloc(n, size, *pools):
+    command(ALLOC_N, n, size)
+    for pool in pools:
+        expect("@timestamp ALLOC %d" % pool)
+
+# preamble...
+def on_reset():
+    expect_pause()
+    glb_filter(GRP_UA)
+    continue_test()
+
+# tests...
+test("blocks cached by another thread allocated when the pool runs empty")
+command(HELPER, 4)
+expect("@timestamp Trg-Done QS_RX_COMMAND")
+alloc(8, 16, *([1] * 8))
+expect("@timestamp Trg-Done QS_RX_COMMAND")
+
+test("pool really empty asserted")
+command(HELPER, 4)
+expect("@timestamp Trg-Done QS_RX_COMMAND")
+alloc(9, 16, *([1] * 8))
+expect("@timestamp =ASSERT= Mod=qf_dyn,Loc=320")
+
+test("event pool looked up by the event-size class")
+for size, pool in ((4, 1), (16, 1), (17, 2), (64, 2)):
+    alloc(1, size, pool)
+    expect("@timestamp Trg-Done QS_RX_COMMAND")
+
+test("event too big for the pools in the lookup table")
+alloc(1, 65)
+expect("@timestamp =ASSERT= Mod=qf_dyn,Loc=310")
+
+test("event too big for the lookup table and for the pools")
+alloc(1, 300)
+expect("@timestamp =ASSERT= Mod=qf_dyn,Loc=310")
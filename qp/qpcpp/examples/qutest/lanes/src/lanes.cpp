@@ -0,0 +1,56 @@
+#include "qpcpp.hpp"
+#include "lanes.hpp"
+
+Q_DEFINE_THIS_FILE
+
+// Gateway declaration -------------------------------------------------------
+class Gateway : public QActive {
+public:
+    Gateway() : QActive(Q_STATE_CAST(&Gateway::initial)) {}
+private:
+    static QState initial(Gateway * const me, QEvt const * const e);
+    static QState active(Gateway * const me, QEvt const * const e);
+};
+
+// Local objects -------------------------------------------------------------
+static Gateway l_gateway; // the single instance of the Gateway AO
+
+// Global-scope objects ------------------------------------------------------
+QActive * const AO_Gateway = &l_gateway; // "opaque" AO pointer
+
+// Gateway::SM ---------------------------------------------------------------
+QState Gateway::initial(Gateway * const me, QEvt const * const e) {
+    (void)e; // unused parameter
+
+    QS_FUN_DICTIONARY(&QHsm::top);
+    QS_FUN_DICTIONARY(&Gateway::initial);
+    QS_FUN_DICTIONARY(&Gateway::active);
+
+    QS_SIG_DICTIONARY(DATA_SIG,    nullptr);
+    QS_SIG_DICTIONARY(TIMEOUT_SIG, nullptr);
+    QS_SIG_DICTIONARY(CONTROL_SIG, nullptr);
+
+    return Q_TRAN(&Gateway::active);
+}
+//............................................................................
+QState Gateway::active(Gateway * const me, QEvt const * const e) {
+    (void)me; // unused parameter
+    QState status_;
+    switch (e->sig) {
+        case DATA_SIG:    // intentionally fall through
+        case TIMEOUT_SIG: // intentionally fall through
+        case CONTROL_SIG: {
+            QS_BEGIN(RECEIVED, nullptr) // app-specific record
+                QS_SIG(e->sig, nullptr);
+                QS_U8(0, Q_EVT_CAST(SeqEvt)->seq);
+            QS_END()
+            status_ = Q_HANDLED();
+            break;
+        }
+        default: {
+            status_ = Q_SUPER(&QHsm::top);
+            break;
+        }
+    }
+    return status_;
+}
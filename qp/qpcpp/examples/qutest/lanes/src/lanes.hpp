@@ -0,0 +1,27 @@
+#ifndef LANES_HPP
+#define LANES_HPP
+
+using namespace QP;
+
+enum LanesSignals {
+    DATA_SIG = Q_USER_SIG, // lane 0 (the queue of the AO)
+    TIMEOUT_SIG,           // lane 1
+    CONTROL_SIG,           // lane 2 (the highest)
+    MAX_SIG                // the last signal
+};
+
+// event with the sequence number of the post
+struct SeqEvt : public QEvt {
+    uint8_t seq;
+};
+
+// application-specific trace records
+enum LanesRecords {
+    RECEIVED = QS_USER, // event dispatched to the Gateway AO
+    POSTED,             // status of a post with a margin
+    LANE_MIN            // low-watermarks of the lanes
+};
+
+extern QActive * const AO_Gateway;
+
+#endif // LANES_HPP
@@ -0,0 +1,164 @@
+//****************************************************************************
+// Purpose: Fixture for QUTEST
+// Last updated for version 6.3.5
+// Last updated on  2018-09-17
+//
+//                    Q u a n t u m  L e a P s
+//                    ------------------------
+//                    Modern Embedded Software
+//
+// Copyright (C) 2002-2018 Quantum Leaps, LLC. All rights reserved.
+//
+// This program is open source software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Alternatively, this program may be distributed and modified under the
+// terms of Quantum Leaps commercial licenses, which expressly supersede
+// the GNU General Public License and are specifically designed for
+// licensees interested in retaining the proprietary status of their code.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <www.gnu.org/licenses/>.
+//
+// Contact information:
+// <www.state-machine.com/licensing>
+// <info@state-machine.com>
+//****************************************************************************
+#include "qpcpp.hpp"
+#include "lanes.hpp"
+
+Q_DEFINE_THIS_FILE
+
+// the lanes of the signals
+static std::uint8_t const l_laneOf[MAX_SIG] = {
+    0U, 0U, 0U, 0U, // reserved signals
+    0U,             // DATA_SIG
+    1U,             // TIMEOUT_SIG
+    2U              // CONTROL_SIG
+};
+static QELanes l_lanes;
+
+//............................................................................
+int main(int argc, char *argv[]) {
+    static QF_MPOOL_EL(SeqEvt) smlPoolSto[20];
+    static QEvt const *gatewayQueueSto[10];
+    static QEvt const *timeoutLaneSto[4];
+    static QEvt const *controlLaneSto[2];
+
+    QF::init();   // initialize the framework and the underlying RT kernel
+
+    // initialize the QS software tracing
+    Q_ALLEGE(QS_INIT(argc > 1 ? argv[1] : nullptr));
+
+    // object dictionaries...
+    QS_OBJ_DICTIONARY(AO_Gateway);
+
+    // pause execution of the test and wait for the test script to continue
+    QS_TEST_PAUSE();
+
+    // initialize event pools...
+    QF::poolInit(smlPoolSto, sizeof(smlPoolSto), sizeof(smlPoolSto[0]));
+
+    // the lanes of the Gateway (capacity of a lane is its length + 1)
+    l_lanes.initLane(1U, timeoutLaneSto, Q_DIM(timeoutLaneSto));
+    l_lanes.initLane(2U, controlLaneSto, Q_DIM(controlLaneSto));
+    l_lanes.setLaneMap(l_laneOf, MAX_SIG);
+    AO_Gateway->setLanes(&l_lanes);
+
+    AO_Gateway->start(1U,                  // QP priority of the AO
+                  gatewayQueueSto,         // event queue storage
+                  Q_DIM(gatewayQueueSto),  // queue length [events]
+                  nullptr, 0U);            // stack storage and size
+
+    return QF::run(); // run the QF application
+}
+
+//----------------------------------------------------------------------------
+// new event with the signal 'sig' and the sequence number 'seq'
+static SeqEvt *newSeqEvt(enum_t const sig, std::uint8_t const seq) {
+    SeqEvt *e = Q_NEW(SeqEvt, sig);
+    e->seq = seq;
+    return e;
+}
+//............................................................................
+void QS::onTestSetup(void) {
+    QS_USR_DICTIONARY(RECEIVED);
+    QS_USR_DICTIONARY(POSTED);
+    QS_USR_DICTIONARY(LANE_MIN);
+}
+//............................................................................
+void QS::onTestTeardown(void) {
+}
+
+//............................................................................
+void QS::onCommand(uint8_t cmdId,
+                   uint32_t param1, uint32_t param2, uint32_t param3)
+{
+    // the signals of the posts of the command 0
+    static enum_t const sigs[] = {
+        DATA_SIG, DATA_SIG, TIMEOUT_SIG, CONTROL_SIG,
+        TIMEOUT_SIG, CONTROL_SIG
+    };
+
+    (void)param2; // unused parameter
+    (void)param3; // unused parameter
+
+    switch (cmdId) {
+        case 0: { // post events of all the lanes, numbered 1..
+            for (std::uint8_t i = 0U; i < Q_DIM(sigs); ++i) {
+                AO_Gateway->POST(newSeqEvt(sigs[i], i + 1U), nullptr);
+            }
+            break;
+        }
+        case 1: { // post 2 control events, then a data event as LIFO
+            AO_Gateway->POST(newSeqEvt(CONTROL_SIG, 1U), nullptr);
+            AO_Gateway->POST(newSeqEvt(CONTROL_SIG, 2U), nullptr);
+            AO_Gateway->postLIFO(newSeqEvt(DATA_SIG, 3U));
+            break;
+        }
+        case 2: { // post a data event, then param1 control events with
+                  // no margin left in their lane
+            AO_Gateway->POST(newSeqEvt(DATA_SIG, 1U), nullptr);
+            for (std::uint8_t i = 0U; i < param1; ++i) {
+                bool const posted = AO_Gateway->POST_X(
+                    newSeqEvt(CONTROL_SIG, i + 2U), 0U, nullptr);
+                QS_BEGIN(POSTED, nullptr) // app-specific record
+                    QS_U8(0, i + 2U);
+                    QS_U8(0, posted ? 1U : 0U);
+                QS_END()
+            }
+            break;
+        }
+        case 3: { // report the low-watermarks of the lanes 1 and 2
+            QS_BEGIN(LANE_MIN, nullptr) // app-specific record
+                QS_U16(0, l_lanes.getLaneMin(1U));
+                QS_U16(0, l_lanes.getLaneMin(2U));
+            QS_END()
+            break;
+        }
+        default:
+            break;
+    }
+}
+//............................................................................
+//! callback function to "massage" the injected QP events (not used here)
+void QS::onTestEvt(QEvt *e) {
+    (void)e; // unused parameter
+}
+//............................................................................
+// callback function to output the posted QP events (not used here)
+void QS::onTestPost(void const *sender, QActive *recipient,
+                    QEvt const *e, bool status)
+{
+    (void)sender;
+    (void)recipient;
+    (void)e;
+    (void)status;
+}
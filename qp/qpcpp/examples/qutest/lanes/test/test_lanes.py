@@ -0,0 +1,45 @@
+# test-script for QUTest unit testing harness
+# see https://www.state-machine.com/qtools/html
+
+# preamble...
+def on_reset():
+    expect_pause()
+    glb_filter(GRP_UA)
+    current_obj(OBJ_SM_AO, "AO_Gateway")
+    continue_test()
+
+# tests...
+test("highest lane first, FIFO within every lane")
+command(0)
+expect("@timestamp RECEIVED DATA_SIG 1")     # the front event
+expect("@timestamp RECEIVED CONTROL_SIG 4")
+expect("@timestamp RECEIVED CONTROL_SIG 6")
+expect("@timestamp RECEIVED TIMEOUT_SIG 3")
+expect("@timestamp RECEIVED TIMEOUT_SIG 5")
+expect("@timestamp RECEIVED DATA_SIG 2")
+expect("@timestamp Trg-Done QS_RX_COMMAND")
+command(3)
+expect("@timestamp LANE_MIN 3 1")
+expect("@timestamp Trg-Done QS_RX_COMMAND")
+
+test("LIFO post moves the front event back to its lane", NORESET)
+command(1)
+expect("@timestamp RECEIVED DATA_SIG 3")
+expect("@timestamp RECEIVED CONTROL_SIG 1")
+expect("@timestamp RECEIVED CONTROL_SIG 2")
+expect("@timestamp Trg-Done QS_RX_COMMAND")
+
+test("full lane refuses a post with margin")
+command(2, 4)
+expect("@timestamp POSTED 2 1")
+expect("@timestamp POSTED 3 1")
+expect("@timestamp POSTED 4 1")
+expect("@timestamp POSTED 5 0")
+expect("@timestamp RECEIVED DATA_SIG 1")
+expect("@timestamp RECEIVED CONTROL_SIG 2")
+expect("@timestamp RECEIVED CONTROL_SIG 3")
+expect("@timestamp RECEIVED CONTROL_SIG 4")
+expect("@timestamp Trg-Done QS_RX_COMMAND")
+command(3)
+expect("@timestamp LANE_MIN 5 0")
+expect("@timestamp Trg-Done QS_RX_COMMAND")
@@ -0,0 +1,312 @@
+//****************************************************************************
+// Purpose: Fixture for QUTEST
+// Last updated for version 6.3.5
+// Last updated on  2018-09-17
+//
+//                    Q u a n t u m  L e a P s
+//                    ------------------------
+//                    Modern Embedded Software
+//
+// Copyright (C) 2002-2018 Quantum Leaps, LLC. All rights reserved.
+//
+// This program is open source software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Alternatively, this program may be distributed and modified under the
+// terms of Quantum Leaps commercial licenses, which expressly supersede
+// the GNU General Public License and are specifically designed for
+// licensees interested in retaining the proprietary status of their code.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <www.gnu.org/licenses/>.
+//
+// Contact information:
+// <www.state-machine.com/licensing>
+// <info@state-machine.com>
+//****************************************************************************
+//
+// Generator of a binary QS capture file for testing the scheduling of
+// active objects by the multithreaded POSIX ports: the worker-thread pool
+// of the POSIX port (QF_POOL_THREADS) and the partitions of the POSIX-QV
+// port (QV_PARTITIONS). Several producer threads post
+// numbered events to every Worker AO. A Worker checks in every RTC step
+// that no other RTC step of it is in progress and that the events of every
+// producer arrive in the order of the posts, and it reports the thread
+// that executes the step. The QS trace is written to the capture file,
+// which the test scripts decode with QSPY.
+//
+// usage: gen_sched <capture.bin>
+//
+#include "qpcpp.hpp"
+
+#include "safe_std.h" // portable "safe" <stdio.h>/<string.h> facilities
+#include <stdlib.h>
+#include <atomic>
+#include <pthread.h>
+#include <sched.h>
+
+using namespace QP;
+
+Q_DEFINE_THIS_FILE
+
+enum SchedSignals {
+    WORK_SIG = Q_USER_SIG
+};
+
+enum SchedRecords {
+    WORK = QS_USER, // RTC step of a Worker: producer, number, thread
+    FAULT           // RTC steps overlapping or events out of order
+};
+
+enum {
+    N_WORKER = 12,  // Worker AOs
+    N_PROD   = 3,   // producer threads
+    N_EVT    = 500  // events posted by every producer to every Worker
+};
+
+// numbered event of a producer
+struct WorkEvt : public QEvt {
+    std::uint8_t  prod;
+    std::uint16_t seq;
+};
+
+// Worker declaration --------------------------------------------------------
+class Worker : public QActive {
+public:
+    Worker() : QActive(Q_STATE_CAST(&Worker::initial)) {}
+    static void dictionaries(void);
+
+private:
+    std::atomic<bool> m_busy;       // RTC step in progress?
+    std::uint16_t m_next[N_PROD];   // the next number from every producer
+    std::uint32_t m_nEvt;           // events received
+
+    static QState initial(Worker * const me, QEvt const * const e);
+    static QState active(Worker * const me, QEvt const * const e);
+};
+
+// Local objects -------------------------------------------------------------
+static Worker l_worker[N_WORKER];
+static FILE *l_file;                   // the capture file
+static std::atomic<bool> l_go;         // producers may start posting
+static std::atomic<int> l_nDone;       // Workers that got all the events
+static std::atomic<int> l_nThreads;    // threads that executed RTC steps
+
+// the small index of the current thread (assigned at the first RTC step)
+static int threadIdx(void) {
+    static thread_local int idx = -1;
+    if (idx < 0) {
+        idx = l_nThreads++;
+    }
+    return idx;
+}
+
+// Worker::SM ----------------------------------------------------------------
+void Worker::dictionaries(void) {
+    QS_FUN_DICTIONARY(&QHsm::top);
+    QS_FUN_DICTIONARY(&Worker::initial);
+    QS_FUN_DICTIONARY(&Worker::active);
+
+    QS_SIG_DICTIONARY(WORK_SIG, nullptr);
+
+    QS_USR_DICTIONARY(WORK);
+    QS_USR_DICTIONARY(FAULT);
+}
+//............................................................................
+QState Worker::initial(Worker * const me, QEvt const * const e) {
+    (void)e; // unused parameter
+    me->m_busy = false;
+    for (int p = 0; p < N_PROD; ++p) {
+        me->m_next[p] = 0U;
+    }
+    me->m_nEvt = 0U;
+    return Q_TRAN(&Worker::active);
+}
+//............................................................................
+QState Worker::active(Worker * const me, QEvt const * const e) {
+    QState status_;
+    switch (e->sig) {
+        case WORK_SIG: {
+            WorkEvt const * const w = Q_EVT_CAST(WorkEvt);
+            bool const overlap = me->m_busy.exchange(true);
+            bool const order   = (w->seq == me->m_next[w->prod]);
+            me->m_next[w->prod] = w->seq + 1U;
+
+            QS_BEGIN(WORK, me) // application-specific record
+                QS_OBJ(me);
+                QS_U8(0, w->prod);
+                QS_U16(0, w->seq);
+                QS_U8(0, threadIdx());
+            QS_END()
+            if (overlap || !order) {
+                QS_BEGIN(FAULT, me) // application-specific record
+                    QS_OBJ(me);
+                    QS_U8(0, overlap ? 1U : 0U);
+                    QS_U8(0, order ? 0U : 1U);
+                QS_END()
+            }
+
+            // widen the window for another RTC step of this Worker
+            for (int volatile i = 0; i < 2000; ++i) {
+            }
+
+            me->m_busy = false;
+            if (++me->m_nEvt == N_PROD*N_EVT) { // all the events?
+                if (++l_nDone == N_WORKER) {
+                    QF::stop();
+                }
+            }
+            status_ = Q_HANDLED();
+            break;
+        }
+        default: {
+            status_ = Q_SUPER(&QHsm::top);
+            break;
+        }
+    }
+    return status_;
+}
+
+//............................................................................
+// producer thread posting N_EVT numbered events to every Worker
+static void *producer(void *arg) {
+    std::uint8_t const prod =
+        static_cast<std::uint8_t>(reinterpret_cast<std::uintptr_t>(arg));
+    while (!l_go) { // wait for QF::run() to start the workers
+        sched_yield();
+    }
+    for (std::uint16_t seq = 0U; seq < N_EVT; ++seq) {
+        for (int k = 0; k < N_WORKER; ++k) {
+            WorkEvt *e = Q_NEW(WorkEvt, WORK_SIG);
+            e->prod = prod;
+            e->seq  = seq;
+            l_worker[k].POST(e, nullptr);
+        }
+    }
+    return nullptr;
+}
+
+//............................................................................
+int main(int argc, char *argv[]) {
+    static QEvt const *workerQueueSto[N_WORKER][N_PROD*N_EVT];
+    static QF_MPOOL_EL(WorkEvt) workPoolSto[N_WORKER*N_PROD*N_EVT];
+
+    if (argc < 2) {
+        FPRINTF_S(stderr, "%s\n", "usage: gen_sched <capture.bin>");
+        return -1;
+    }
+
+    QF::init();
+    Q_ALLEGE(QS_INIT(argv[1]));
+    QS_FILTER_ON(QS_UA_RECORDS); // only the user records
+
+    Worker::dictionaries();
+    for (int k = 0; k < N_WORKER; ++k) {
+        char name[16];
+        SNPRINTF_S(name, sizeof(name), "l_worker[%d]", k);
+        QS::obj_dict_pre_(&l_worker[k], name);
+    }
+
+    QF::poolInit(workPoolSto, sizeof(workPoolSto), sizeof(workPoolSto[0]));
+
+#ifdef QV_PARTITIONS
+    // contiguous blocks of Workers per partition (not the default prio % N)
+    for (int k = 0; k < N_WORKER; ++k) {
+        QF_setPartition(static_cast<std::uint_fast8_t>(k + 1),
+            static_cast<std::uint_fast8_t>(k*QV_PARTITIONS/N_WORKER));
+    }
+#endif
+
+    for (int k = 0; k < N_WORKER; ++k) {
+        l_worker[k].start(static_cast<std::uint_fast8_t>(k + 1),
+                          workerQueueSto[k], Q_DIM(workerQueueSto[k]),
+                          nullptr, 0U);
+    }
+
+    for (int p = 0; p < N_PROD; ++p) {
+        pthread_attr_t attr;
+        pthread_attr_init(&attr);
+        pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+        pthread_t thread;
+        Q_ALLEGE(pthread_create(&thread, &attr, &producer,
+            reinterpret_cast<void *>(static_cast<std::uintptr_t>(p))) == 0);
+        pthread_attr_destroy(&attr);
+    }
+
+    int_t const status = QF::run();
+    QS::onCleanup();
+    return status;
+}
+
+//----------------------------------------------------------------------------
+bool QS::onStartup(void const *arg) {
+    static std::uint8_t qsBuf[1024*1024]; // buffer for QS trace records
+
+    initBuf(qsBuf, sizeof(qsBuf));
+    FOPEN_S(l_file, static_cast<char const *>(arg), "wb");
+    return l_file != nullptr;
+}
+//............................................................................
+void QS::onCleanup(void) {
+    if (l_file != nullptr) { // not closed yet by QF::run()?
+        onFlush();
+        fclose(l_file);
+        l_file = nullptr;
+    }
+}
+//............................................................................
+void QS::onFlush(void) {
+    std::uint16_t nBytes = 0xFFFFU;
+    std::uint8_t const *block;
+    QS_CRIT_STAT_
+    QS_CRIT_ENTRY_();
+    while ((block = getBlock(&nBytes)) != nullptr) {
+        QS_CRIT_EXIT_();
+        fwrite(block, 1U, nBytes, l_file);
+        nBytes = 0xFFFFU;
+        QS_CRIT_ENTRY_();
+    }
+    QS_CRIT_EXIT_();
+}
+//............................................................................
+QSTimeCtr QS::onGetTime(void) {
+    static QSTimeCtr time; // in the critical section of the QS record
+    return ++time;
+}
+//............................................................................
+void QS::onReset(void) {
+}
+//............................................................................
+void QS::onCommand(std::uint8_t cmdId, std::uint32_t param1,
+                   std::uint32_t param2, std::uint32_t param3)
+{
+    (void)cmdId;
+    (void)param1;
+    (void)param2;
+    (void)param3;
+}
+
+//............................................................................
+void QF::onStartup(void) {
+    QF_setTickRate(1000U, 30); // 1ms clock tick
+}
+//............................................................................
+void QF::onCleanup(void) {
+}
+//............................................................................
+void QP::QF_onClockTick(void) {
+    l_go = true; // the workers are running now
+    QS::onFlush();
+}
+//............................................................................
+extern "C" Q_NORETURN Q_onAssert(char const * const module, int_t const loc) {
+    FPRINTF_S(stderr, "Assertion failed in %s:%d\n", module, loc);
+    exit(-1);
+}
@@ -0,0 +1,34 @@
+# helpers shared by the tests of the scheduling of AOs by the POSIX ports
+#
+import os
+import pty
+import subprocess
+
+TRACE = 'build/sched.bin'
+
+N_WORKER = 12 # Worker AOs (gen_sched.cpp)
+N_PROD   = 3  # producer threads
+N_EVT    = 500 # events of every producer to every Worker
+
+# decode the capture file with QSPY and return its screen output lines
+def qspy(exe):
+    # QSPY needs a terminal for the keyboard input
+    master, slave = pty.openpty()
+    try:
+        out = subprocess.run([os.path.abspath(exe), '-u0', '-f', TRACE],
+                             stdin=slave, stdout=subprocess.PIPE,
+                             timeout=120).stdout
+    finally:
+        os.close(slave)
+        os.close(master)
+    return out.decode().splitlines()
+
+# the WORK records "<time> WORK <obj> <prod> <seq> <thread>" as tuples
+# (obj, prod, seq, thread)
+def work(lines):
+    return [(f[2], int(f[3]), int(f[4]), int(f[5]))
+            for f in (ln.split() for ln in lines if ' WORK ' in ln)]
+
+def check(name, ok):
+    print(name + ': ' + ('PASS' if ok else 'FAIL'))
+    return ok
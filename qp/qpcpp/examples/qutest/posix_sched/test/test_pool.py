@@ -0,0 +1,39 @@
+# test of the worker-thread pool of the POSIX port (QF_POOL_THREADS)
+#
+# usage: python3 test_pool.py <gen_sched> <qspy>
+#
+# The capture produced by gen_sched contains a WORK record for every RTC
+# step of the Worker AOs and a FAULT record for every RTC step that found
+# another RTC step of the same Worker in progress or an event out of the
+# order of the posts.
+#
+import sys
+import subprocess
+from collections import defaultdict
+
+from sched_run import TRACE, N_WORKER, N_PROD, N_EVT, qspy, work, check
+
+N_POOL = 4 # QF_POOL_THREADS (Makefile)
+
+def main(gen, exe):
+    subprocess.run([gen, TRACE], check=True, timeout=60)
+    lines = qspy(exe)
+
+    seqs = defaultdict(list)
+    threads = set()
+    for obj, prod, seq, thr in work(lines):
+        seqs[(obj, prod)].append(seq)
+        threads.add(thr)
+
+    ok = check('no overlapping RTC steps or events out of order',
+               not any(' FAULT ' in ln for ln in lines))
+    ok &= check('all events delivered once and in order',
+                len(seqs) == N_WORKER * N_PROD
+                and all(s == list(range(N_EVT)) for s in seqs.values()))
+    ok &= check('RTC steps executed by at most %d threads' % N_POOL,
+                1 <= len(threads) <= N_POOL)
+
+    return 0 if ok else 1
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1], sys.argv[2]))
@@ -0,0 +1,47 @@
+# test of the partitions of the POSIX-QV port (QV_PARTITIONS)
+#
+# usage: python3 test_part.py <gen_sched> <qspy>
+#
+# gen_sched assigns the Worker l_worker[k] to the partition
+# k*QV_PARTITIONS/N_WORKER, so the event loop of every partition must
+# execute all the RTC steps of its block of Workers in one thread.
+#
+import sys
+import subprocess
+from collections import defaultdict
+
+sys.path.insert(0, '../test') # the helpers shared with test_pool.py
+from sched_run import TRACE, N_WORKER, N_PROD, N_EVT, qspy, work, check
+
+N_PART = 2 # QV_PARTITIONS (Makefile)
+
+def main(gen, exe):
+    subprocess.run([gen, TRACE], check=True, timeout=60)
+    lines = qspy(exe)
+
+    seqs = defaultdict(list)
+    threads = defaultdict(set) # threads of every Worker
+    for obj, prod, seq, thr in work(lines):
+        seqs[(obj, prod)].append(seq)
+        threads[obj].add(thr)
+
+    # the thread of every partition, if all its Workers ran in one thread
+    part = defaultdict(set)
+    for k in range(N_WORKER):
+        part[k * N_PART // N_WORKER] |= threads['l_worker<%d>' % k]
+
+    ok = check('no overlapping RTC steps or events out of order',
+               not any(' FAULT ' in ln for ln in lines))
+    ok &= check('all events delivered once and in order',
+                len(seqs) == N_WORKER * N_PROD
+                and all(s == list(range(N_EVT)) for s in seqs.values()))
+    ok &= check('Workers of a partition executed by one thread',
+                len(part) == N_PART
+                and all(len(t) == 1 for t in part.values()))
+    ok &= check('every partition in its own thread',
+                len(set().union(*part.values())) == N_PART)
+
+    return 0 if ok else 1
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1], sys.argv[2]))
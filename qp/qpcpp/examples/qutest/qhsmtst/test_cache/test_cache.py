@@ -0,0 +1,67 @@
+# test-script for QUTest unit testing harness
+# see https://www.state-machine.com/qtools/html
+
+# the scripts in ../test are run against the cached transitions as well
+
+# preamble...
+def on_reset():
+    glb_filter(GRP_SM)
+    current_obj(OBJ_SM, "the_hsm")
+
+# tests...
+test("QHsmTst cache init")
+init()
+expect("===RTC===> St-Init  Obj=the_hsm,State=QHsm::top->s2")
+expect("===RTC===> St-Entry Obj=the_hsm,State=s")
+expect("===RTC===> St-Entry Obj=the_hsm,State=s2")
+expect("===RTC===> St-Init  Obj=the_hsm,State=s2->s211")
+expect("===RTC===> St-Entry Obj=the_hsm,State=s21")
+expect("===RTC===> St-Entry Obj=the_hsm,State=s211")
+expect("@timestamp Init===> Obj=the_hsm,State=s211")
+expect("@timestamp Trg-Done QS_RX_EVENT")
+
+# the first transition is discovered and memoized, the next are replayed
+test("QHsmTst cache replay", NORESET)
+for i in range(3):
+    dispatch("A_SIG")
+    expect("@timestamp Disp===> Obj=the_hsm,Sig=A_SIG,State=s211")
+    expect("===RTC===> St-Exit  Obj=the_hsm,State=s211")
+    expect("===RTC===> St-Exit  Obj=the_hsm,State=s21")
+    expect("===RTC===> St-Entry Obj=the_hsm,State=s21")
+    expect("===RTC===> St-Init  Obj=the_hsm,State=s21->s211")
+    expect("===RTC===> St-Entry Obj=the_hsm,State=s211")
+    expect("@timestamp ===>Tran Obj=the_hsm,Sig=A_SIG,State=s21->s211")
+    expect("@timestamp Trg-Done QS_RX_EVENT")
+
+# the same source and target, but a different active state
+test("QHsmTst cache keyed by the active state", NORESET)
+for i in range(2):
+    dispatch("E_SIG")
+    expect("@timestamp Disp===> Obj=the_hsm,Sig=E_SIG,State=s211")
+    expect("===RTC===> St-Exit  Obj=the_hsm,State=s211")
+    expect("===RTC===> St-Exit  Obj=the_hsm,State=s21")
+    expect("===RTC===> St-Exit  Obj=the_hsm,State=s2")
+    expect("===RTC===> St-Entry Obj=the_hsm,State=s1")
+    expect("===RTC===> St-Entry Obj=the_hsm,State=s11")
+    expect("@timestamp ===>Tran Obj=the_hsm,Sig=E_SIG,State=s->s11")
+    expect("@timestamp Trg-Done QS_RX_EVENT")
+
+    dispatch("E_SIG")
+    expect("@timestamp Disp===> Obj=the_hsm,Sig=E_SIG,State=s11")
+    expect("===RTC===> St-Exit  Obj=the_hsm,State=s11")
+    expect("===RTC===> St-Exit  Obj=the_hsm,State=s1")
+    expect("===RTC===> St-Entry Obj=the_hsm,State=s1")
+    expect("===RTC===> St-Entry Obj=the_hsm,State=s11")
+    expect("@timestamp ===>Tran Obj=the_hsm,Sig=E_SIG,State=s->s11")
+    expect("@timestamp Trg-Done QS_RX_EVENT")
+
+    dispatch("C_SIG") # back to s211 for the next round
+    expect("@timestamp Disp===> Obj=the_hsm,Sig=C_SIG,State=s11")
+    expect("===RTC===> St-Exit  Obj=the_hsm,State=s11")
+    expect("===RTC===> St-Exit  Obj=the_hsm,State=s1")
+    expect("===RTC===> St-Entry Obj=the_hsm,State=s2")
+    expect("===RTC===> St-Init  Obj=the_hsm,State=s2->s211")
+    expect("===RTC===> St-Entry Obj=the_hsm,State=s21")
+    expect("===RTC===> St-Entry Obj=the_hsm,State=s211")
+    expect("@timestamp ===>Tran Obj=the_hsm,Sig=C_SIG,State=s1->s211")
+    expect("@timestamp Trg-Done QS_RX_EVENT")
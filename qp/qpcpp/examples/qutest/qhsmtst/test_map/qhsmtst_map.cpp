@@ -0,0 +1,366 @@
+//****************************************************************************
+// Purpose: QHsmTst state machine coded as the signal-mapped QP::QMapHsm
+// Last updated for version 6.7.0
+// Last updated on  2019-12-29
+//
+//                    Q u a n t u m  L e a P s
+//                    ------------------------
+//                    Modern Embedded Software
+//
+// Copyright (C) 2005-2019 Quantum Leaps. All rights reserved.
+//
+// This program is open source software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Alternatively, this program may be distributed and modified under the
+// terms of Quantum Leaps commercial licenses, which expressly supersede
+// the GNU General Public License and are specifically designed for
+// licensees interested in retaining the proprietary status of their code.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <www.gnu.org/licenses>.
+//
+// Contact information:
+// <www.state-machine.com/licensing>
+// <info@state-machine.com>
+//****************************************************************************
+#include "qpcpp.hpp"
+#include "qhsmtst.hpp"
+#include "qhsmtst_map.hpp"
+
+namespace QHSMTST {
+
+// The same state machine as ../src/qhsmtst.cpp, with every state coded
+// as a QP::QMapState, so that the scripts in ../test apply unchanged.
+// The states must be defined before the signal handlers, which use them
+// as transition targets.
+//
+class QHsmTst : public QP::QMapHsm {
+private:
+    bool m_foo;
+
+public:
+    QHsmTst()
+      : QMapHsm(Q_STATE_CAST(&QHsmTst::initial))
+    {}
+
+    static QP::QState initial(void * const me, QP::QEvt const * const e);
+
+#define QHSMTST_DISPLAY(name_, text_) \
+    static QP::QState name_(void * const, QP::QEvt const * const) { \
+        BSP_display(text_); \
+        return Q_RET_HANDLED; \
+    }
+
+    QHSMTST_DISPLAY(s_entry,    "s-ENTRY;")
+    QHSMTST_DISPLAY(s_exit,     "s-EXIT;")
+    QHSMTST_DISPLAY(s1_entry,   "s1-ENTRY;")
+    QHSMTST_DISPLAY(s1_exit,    "s1-EXIT;")
+    QHSMTST_DISPLAY(s1_I,       "s1-I;")
+    QHSMTST_DISPLAY(s11_entry,  "s11-ENTRY;")
+    QHSMTST_DISPLAY(s11_exit,   "s11-EXIT;")
+    QHSMTST_DISPLAY(s2_entry,   "s2-ENTRY;")
+    QHSMTST_DISPLAY(s2_exit,    "s2-EXIT;")
+    QHSMTST_DISPLAY(s21_entry,  "s21-ENTRY;")
+    QHSMTST_DISPLAY(s21_exit,   "s21-EXIT;")
+    QHSMTST_DISPLAY(s211_entry, "s211-ENTRY;")
+    QHSMTST_DISPLAY(s211_exit,  "s211-EXIT;")
+    QHSMTST_DISPLAY(s_BIG,      "s-BIG;")
+
+#undef QHSMTST_DISPLAY
+
+    static QP::QState s_init(void * const me, QP::QEvt const * const e);
+    static QP::QState s_I(void * const me, QP::QEvt const * const e);
+    static QP::QState s_E(void * const me, QP::QEvt const * const e);
+    static QP::QState s_TERMINATE(void * const me,
+                                  QP::QEvt const * const e);
+    static QP::QState s1_init(void * const me, QP::QEvt const * const e);
+    static QP::QState s1_A(void * const me, QP::QEvt const * const e);
+    static QP::QState s1_B(void * const me, QP::QEvt const * const e);
+    static QP::QState s1_C(void * const me, QP::QEvt const * const e);
+    static QP::QState s1_D(void * const me, QP::QEvt const * const e);
+    static QP::QState s1_F(void * const me, QP::QEvt const * const e);
+    static QP::QState s11_D(void * const me, QP::QEvt const * const e);
+    static QP::QState s11_G(void * const me, QP::QEvt const * const e);
+    static QP::QState s11_H(void * const me, QP::QEvt const * const e);
+    static QP::QState s2_init(void * const me, QP::QEvt const * const e);
+    static QP::QState s2_C(void * const me, QP::QEvt const * const e);
+    static QP::QState s2_F(void * const me, QP::QEvt const * const e);
+    static QP::QState s2_I(void * const me, QP::QEvt const * const e);
+    static QP::QState s21_init(void * const me, QP::QEvt const * const e);
+    static QP::QState s21_A(void * const me, QP::QEvt const * const e);
+    static QP::QState s21_B(void * const me, QP::QEvt const * const e);
+    static QP::QState s21_G(void * const me, QP::QEvt const * const e);
+    static QP::QState s211_D(void * const me, QP::QEvt const * const e);
+    static QP::QState s211_H(void * const me, QP::QEvt const * const e);
+};
+
+static QHsmTst l_hsmtst; // the only instance of the QHsmTst class
+
+// global-scope definitions -----------------------------------------
+QP::QHsm * const the_hsm = &l_hsmtst; // the opaque pointer
+
+//............................................................................
+// signal maps and state objects (the maps sorted by the signal)
+static constexpr QP::QMapSig s_map[] {
+    { QP::QMapHsm::Q_ENTRY_SIG, &QHsmTst::s_entry     },
+    { QP::QMapHsm::Q_EXIT_SIG,  &QHsmTst::s_exit      },
+    { QP::QMapHsm::Q_INIT_SIG,  &QHsmTst::s_init      },
+    { E_SIG,                    &QHsmTst::s_E         },
+    { I_SIG,                    &QHsmTst::s_I         },
+    { TERMINATE_SIG,            &QHsmTst::s_TERMINATE },
+    { BIG_SIG,                  &QHsmTst::s_BIG       }
+};
+Q_MAP_TOP_STATE(s, s_map);
+
+static constexpr QP::QMapSig s1_map[] {
+    { QP::QMapHsm::Q_ENTRY_SIG, &QHsmTst::s1_entry },
+    { QP::QMapHsm::Q_EXIT_SIG,  &QHsmTst::s1_exit  },
+    { QP::QMapHsm::Q_INIT_SIG,  &QHsmTst::s1_init  },
+    { A_SIG,                    &QHsmTst::s1_A     },
+    { B_SIG,                    &QHsmTst::s1_B     },
+    { C_SIG,                    &QHsmTst::s1_C     },
+    { D_SIG,                    &QHsmTst::s1_D     },
+    { F_SIG,                    &QHsmTst::s1_F     },
+    { I_SIG,                    &QHsmTst::s1_I     }
+};
+Q_MAP_STATE(s1, s, s1_map);
+
+static constexpr QP::QMapSig s11_map[] {
+    { QP::QMapHsm::Q_ENTRY_SIG, &QHsmTst::s11_entry },
+    { QP::QMapHsm::Q_EXIT_SIG,  &QHsmTst::s11_exit  },
+    { D_SIG,                    &QHsmTst::s11_D     },
+    { G_SIG,                    &QHsmTst::s11_G     },
+    { H_SIG,                    &QHsmTst::s11_H     }
+};
+Q_MAP_STATE(s11, s1, s11_map);
+
+static constexpr QP::QMapSig s2_map[] {
+    { QP::QMapHsm::Q_ENTRY_SIG, &QHsmTst::s2_entry },
+    { QP::QMapHsm::Q_EXIT_SIG,  &QHsmTst::s2_exit  },
+    { QP::QMapHsm::Q_INIT_SIG,  &QHsmTst::s2_init  },
+    { C_SIG,                    &QHsmTst::s2_C     },
+    { F_SIG,                    &QHsmTst::s2_F     },
+    { I_SIG,                    &QHsmTst::s2_I     }
+};
+Q_MAP_STATE(s2, s, s2_map);
+
+static constexpr QP::QMapSig s21_map[] {
+    { QP::QMapHsm::Q_ENTRY_SIG, &QHsmTst::s21_entry },
+    { QP::QMapHsm::Q_EXIT_SIG,  &QHsmTst::s21_exit  },
+    { QP::QMapHsm::Q_INIT_SIG,  &QHsmTst::s21_init  },
+    { A_SIG,                    &QHsmTst::s21_A     },
+    { B_SIG,                    &QHsmTst::s21_B     },
+    { G_SIG,                    &QHsmTst::s21_G     }
+};
+Q_MAP_STATE(s21, s2, s21_map);
+
+static constexpr QP::QMapSig s211_map[] {
+    { QP::QMapHsm::Q_ENTRY_SIG, &QHsmTst::s211_entry },
+    { QP::QMapHsm::Q_EXIT_SIG,  &QHsmTst::s211_exit  },
+    { D_SIG,                    &QHsmTst::s211_D     },
+    { H_SIG,                    &QHsmTst::s211_H     }
+};
+Q_MAP_STATE(s211, s21, s211_map);
+
+// the state handlers for the QUTEST fixture
+QP::QStateHandler const the_states[N_STATES] {
+    &QP::QMapHsm::state<s>,
+    &QP::QMapHsm::state<s1>,
+    &QP::QMapHsm::state<s11>,
+    &QP::QMapHsm::state<s2>,
+    &QP::QMapHsm::state<s21>,
+    &QP::QMapHsm::state<s211>
+};
+
+//............................................................................
+QP::QState QHsmTst::initial(void * const me, QP::QEvt const * const e) {
+    (void)e; // unused parameter
+    static_cast<QHsmTst *>(me)->m_foo = false;
+    BSP_display("top-INIT;");
+
+    QS_SIG_DICTIONARY(A_SIG, me);
+    QS_SIG_DICTIONARY(B_SIG, me);
+    QS_SIG_DICTIONARY(C_SIG, me);
+    QS_SIG_DICTIONARY(D_SIG, me);
+    QS_SIG_DICTIONARY(E_SIG, me);
+    QS_SIG_DICTIONARY(F_SIG, me);
+    QS_SIG_DICTIONARY(G_SIG, me);
+    QS_SIG_DICTIONARY(H_SIG, me);
+    QS_SIG_DICTIONARY(I_SIG, me);
+    QS_SIG_DICTIONARY(TERMINATE_SIG, me);
+    QS_SIG_DICTIONARY(IGNORE_SIG, me);
+    QS_SIG_DICTIONARY(BIG_SIG, me);
+
+#ifdef Q_SPY
+    // the state handlers get the names of their state objects
+    static char const * const names[N_STATES] {
+        "s", "s1", "s11", "s2", "s21", "s211"
+    };
+    for (std::uint_fast8_t i = 0U; i < N_STATES; ++i) {
+        QP::QS::fun_dict_pre_(
+            QP::QS::force_cast<void (*)(void)>(the_states[i]), names[i]);
+    }
+#endif // Q_SPY
+
+    return static_cast<QHsmTst *>(me)->tran(&QP::QMapHsm::state<s2>);
+}
+
+//............................................................................
+QP::QState QHsmTst::s_init(void * const me, QP::QEvt const * const e) {
+    (void)e; // unused parameter
+    BSP_display("s-INIT;");
+    return static_cast<QHsmTst *>(me)->tran(&QP::QMapHsm::state<s11>);
+}
+QP::QState QHsmTst::s_I(void * const me, QP::QEvt const * const e) {
+    (void)e; // unused parameter
+    QHsmTst * const hsm = static_cast<QHsmTst *>(me);
+    if (hsm->m_foo) {
+        hsm->m_foo = false;
+        BSP_display("s-I;");
+        return Q_RET_HANDLED;
+    }
+    return Q_RET_UNHANDLED;
+}
+QP::QState QHsmTst::s_E(void * const me, QP::QEvt const * const e) {
+    (void)e; // unused parameter
+    BSP_display("s-E;");
+    return static_cast<QHsmTst *>(me)->tran(&QP::QMapHsm::state<s11>);
+}
+QP::QState QHsmTst::s_TERMINATE(void * const me,
+                                QP::QEvt const * const e)
+{
+    (void)me; // unused parameter
+    (void)e;  // unused parameter
+    BSP_terminate(0);
+    return Q_RET_HANDLED;
+}
+
+//............................................................................
+QP::QState QHsmTst::s1_init(void * const me, QP::QEvt const * const e) {
+    (void)e; // unused parameter
+    BSP_display("s1-INIT;");
+    return static_cast<QHsmTst *>(me)->tran(&QP::QMapHsm::state<s11>);
+}
+QP::QState QHsmTst::s1_A(void * const me, QP::QEvt const * const e) {
+    (void)e; // unused parameter
+    BSP_display("s1-A;");
+    return static_cast<QHsmTst *>(me)->tran(&QP::QMapHsm::state<s1>);
+}
+QP::QState QHsmTst::s1_B(void * const me, QP::QEvt const * const e) {
+    (void)e; // unused parameter
+    BSP_display("s1-B;");
+    return static_cast<QHsmTst *>(me)->tran(&QP::QMapHsm::state<s11>);
+}
+QP::QState QHsmTst::s1_C(void * const me, QP::QEvt const * const e) {
+    (void)e; // unused parameter
+    BSP_display("s1-C;");
+    return static_cast<QHsmTst *>(me)->tran(&QP::QMapHsm::state<s2>);
+}
+QP::QState QHsmTst::s1_D(void * const me, QP::QEvt const * const e) {
+    (void)e; // unused parameter
+    QHsmTst * const hsm = static_cast<QHsmTst *>(me);
+    if (!hsm->m_foo) {
+        hsm->m_foo = true;
+        BSP_display("s1-D;");
+        return hsm->tran(&QP::QMapHsm::state<s>);
+    }
+    return Q_RET_UNHANDLED;
+}
+QP::QState QHsmTst::s1_F(void * const me, QP::QEvt const * const e) {
+    (void)e; // unused parameter
+    BSP_display("s1-F;");
+    return static_cast<QHsmTst *>(me)->tran(&QP::QMapHsm::state<s211>);
+}
+
+//............................................................................
+QP::QState QHsmTst::s11_D(void * const me, QP::QEvt const * const e) {
+    (void)e; // unused parameter
+    QHsmTst * const hsm = static_cast<QHsmTst *>(me);
+    if (hsm->m_foo) {
+        hsm->m_foo = false;
+        BSP_display("s11-D;");
+        return hsm->tran(&QP::QMapHsm::state<s1>);
+    }
+    return Q_RET_UNHANDLED;
+}
+QP::QState QHsmTst::s11_G(void * const me, QP::QEvt const * const e) {
+    (void)e; // unused parameter
+    BSP_display("s11-G;");
+    return static_cast<QHsmTst *>(me)->tran(&QP::QMapHsm::state<s211>);
+}
+QP::QState QHsmTst::s11_H(void * const me, QP::QEvt const * const e) {
+    (void)e; // unused parameter
+    BSP_display("s11-H;");
+    return static_cast<QHsmTst *>(me)->tran(&QP::QMapHsm::state<s>);
+}
+
+//............................................................................
+QP::QState QHsmTst::s2_init(void * const me, QP::QEvt const * const e) {
+    (void)e; // unused parameter
+    BSP_display("s2-INIT;");
+    return static_cast<QHsmTst *>(me)->tran(&QP::QMapHsm::state<s211>);
+}
+QP::QState QHsmTst::s2_C(void * const me, QP::QEvt const * const e) {
+    (void)e; // unused parameter
+    BSP_display("s2-C;");
+    return static_cast<QHsmTst *>(me)->tran(&QP::QMapHsm::state<s1>);
+}
+QP::QState QHsmTst::s2_F(void * const me, QP::QEvt const * const e) {
+    (void)e; // unused parameter
+    BSP_display("s2-F;");
+    return static_cast<QHsmTst *>(me)->tran(&QP::QMapHsm::state<s11>);
+}
+QP::QState QHsmTst::s2_I(void * const me, QP::QEvt const * const e) {
+    (void)e; // unused parameter
+    QHsmTst * const hsm = static_cast<QHsmTst *>(me);
+    if (!hsm->m_foo) {
+        hsm->m_foo = true;
+        BSP_display("s2-I;");
+        return Q_RET_HANDLED;
+    }
+    return Q_RET_UNHANDLED;
+}
+
+//............................................................................
+QP::QState QHsmTst::s21_init(void * const me, QP::QEvt const * const e) {
+    (void)e; // unused parameter
+    BSP_display("s21-INIT;");
+    return static_cast<QHsmTst *>(me)->tran(&QP::QMapHsm::state<s211>);
+}
+QP::QState QHsmTst::s21_A(void * const me, QP::QEvt const * const e) {
+    (void)e; // unused parameter
+    BSP_display("s21-A;");
+    return static_cast<QHsmTst *>(me)->tran(&QP::QMapHsm::state<s21>);
+}
+QP::QState QHsmTst::s21_B(void * const me, QP::QEvt const * const e) {
+    (void)e; // unused parameter
+    BSP_display("s21-B;");
+    return static_cast<QHsmTst *>(me)->tran(&QP::QMapHsm::state<s211>);
+}
+QP::QState QHsmTst::s21_G(void * const me, QP::QEvt const * const e) {
+    (void)e; // unused parameter
+    BSP_display("s21-G;");
+    return static_cast<QHsmTst *>(me)->tran(&QP::QMapHsm::state<s1>);
+}
+
+//............................................................................
+QP::QState QHsmTst::s211_D(void * const me, QP::QEvt const * const e) {
+    (void)e; // unused parameter
+    BSP_display("s211-D;");
+    return static_cast<QHsmTst *>(me)->tran(&QP::QMapHsm::state<s21>);
+}
+QP::QState QHsmTst::s211_H(void * const me, QP::QEvt const * const e) {
+    (void)e; // unused parameter
+    BSP_display("s211-H;");
+    return static_cast<QHsmTst *>(me)->tran(&QP::QMapHsm::state<s>);
+}
+
+} // namespace QHSMTST
@@ -0,0 +1,52 @@
+//****************************************************************************
+// Purpose: QHsmTst as QP::QMapHsm, extras for the QUTEST fixture
+// Last updated for version 6.7.0
+// Last updated on  2019-12-29
+//
+//                    Q u a n t u m  L e a P s
+//                    ------------------------
+//                    Modern Embedded Software
+//
+// Copyright (C) 2005-2019 Quantum Leaps. All rights reserved.
+//
+// This program is open source software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Alternatively, this program may be distributed and modified under the
+// terms of Quantum Leaps commercial licenses, which expressly supersede
+// the GNU General Public License and are specifically designed for
+// licensees interested in retaining the proprietary status of their code.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <www.gnu.org/licenses>.
+//
+// Contact information:
+// <www.state-machine.com/licensing>
+// <info@state-machine.com>
+//****************************************************************************
+#ifndef QHSMTST_MAP_HPP
+#define QHSMTST_MAP_HPP
+
+namespace QHSMTST {
+
+// signal beyond the bitmaps of the QMapStates, handled in the state "s"
+constexpr QP::QSignal BIG_SIG {
+    static_cast<QP::QSignal>(QP::Q_USER_SIG + QP::Q_MAP_BITS + 5U)
+};
+
+// the number of states of the test HSM
+constexpr std::uint_fast8_t N_STATES {6U};
+
+// state handlers of the test HSM in the order s, s1, s11, s2, s21, s211
+extern QP::QStateHandler const the_states[N_STATES];
+
+} // namespace QHSMTST
+
+#endif // QHSMTST_MAP_HPP
@@ -0,0 +1,48 @@
+# test-script for QUTest unit testing harness
+# see https://www.state-machine.com/qtools/html
+
+# the scripts in ../test are run with the QMapHsm version of QHsmTst too
+
+# state indices in the fixture and the signals of QHsmTst
+S, S1, S11, S2, S21, S211 = range(6)
+A_SIG, C_SIG, E_SIG, IGNORE_SIG, BIG_SIG = 4, 6, 8, 14, 4 + 64 + 5
+
+# preamble...
+def on_reset():
+    glb_filter(GRP_UA)
+    current_obj(OBJ_SM, "the_hsm")
+
+def probe(state, sig, superstate):
+    command(0, state, sig)
+    expect("@timestamp SUPER_STATE 0 " + superstate)
+    expect("@timestamp Trg-Done QS_RX_COMMAND")
+
+# tests...
+test("QMapHsm skips the superstates without the signal")
+init()
+expect("@timestamp BSP_DISPLAY top-INIT;")
+expect("@timestamp BSP_DISPLAY s-ENTRY;")
+expect("@timestamp BSP_DISPLAY s2-ENTRY;")
+expect("@timestamp BSP_DISPLAY s2-INIT;")
+expect("@timestamp BSP_DISPLAY s21-ENTRY;")
+expect("@timestamp BSP_DISPLAY s211-ENTRY;")
+expect("@timestamp Trg-Done QS_RX_EVENT")
+probe(S211, C_SIG, "s2")         # s21 skipped
+probe(S211, E_SIG, "s")          # s21 and s2 skipped
+probe(S211, IGNORE_SIG, "QHsm::top")
+probe(S211, A_SIG, "s21")        # handled in the immediate superstate
+probe(S11,  E_SIG, "s")
+probe(S11,  C_SIG, "s1")
+probe(S,    IGNORE_SIG, "QHsm::top")
+
+test("QMapHsm reports the immediate superstate", NORESET)
+probe(S211, 0, "s21")            # the empty signal, used to find the path
+probe(S11,  0, "s1")
+probe(S,    0, "QHsm::top")
+
+test("QMapHsm signal beyond the bitmaps", NORESET)
+probe(S211, BIG_SIG, "s21")      # no skipping beyond Q_MAP_BITS
+probe(S21,  BIG_SIG, "s2")
+dispatch("BIG_SIG")
+expect("@timestamp BSP_DISPLAY s-BIG;")
+expect("@timestamp Trg-Done QS_RX_EVENT")
@@ -0,0 +1,36 @@
+# test-script for QUTest unit testing harness
+# see https://www.state-machine.com/qtools/html
+
+# the scripts in ../test are run with the path buffer of the test HSM too
+
+# preamble...
+def on_reset():
+    glb_filter(GRP_UA)
+    current_obj(OBJ_SM, "the_hsm")
+
+# tests...
+test("QHsmTst path buffer deep enough")
+init()
+expect("@timestamp BSP_DISPLAY top-INIT;")
+expect("@timestamp BSP_DISPLAY s-ENTRY;")
+expect("@timestamp BSP_DISPLAY s2-ENTRY;")
+expect("@timestamp BSP_DISPLAY s2-INIT;")
+expect("@timestamp BSP_DISPLAY s21-ENTRY;")
+expect("@timestamp BSP_DISPLAY s211-ENTRY;")
+expect("@timestamp Trg-Done QS_RX_EVENT")
+
+test("QHsmTst path buffer too shallow", NORESET)
+command(1)
+expect("@timestamp Trg-Done QS_RX_COMMAND")
+dispatch("E_SIG") # s211 -> s11, the path fits in 3 entries
+expect("@timestamp BSP_DISPLAY s-E;")
+expect("@timestamp BSP_DISPLAY s211-EXIT;")
+expect("@timestamp BSP_DISPLAY s21-EXIT;")
+expect("@timestamp BSP_DISPLAY s2-EXIT;")
+expect("@timestamp BSP_DISPLAY s1-ENTRY;")
+expect("@timestamp BSP_DISPLAY s11-ENTRY;")
+expect("@timestamp Trg-Done QS_RX_EVENT")
+dispatch("F_SIG") # s1 -> s211, the path does not fit in 3 entries
+expect("@timestamp BSP_DISPLAY s1-F;")
+expect("@timestamp BSP_DISPLAY s11-EXIT;")
+expect("@timestamp =ASSERT= Mod=qep_hsm,Loc=510")
@@ -0,0 +1,112 @@
+//****************************************************************************
+// Purpose: Flattened dispatch tables of QMsmTst for the QUTEST fixture
+// Last updated for version 6.7.0
+// Last updated on  2019-12-29
+//
+//                    Q u a n t u m  L e a P s
+//                    ------------------------
+//                    Modern Embedded Software
+//
+// Copyright (C) 2005-2019 Quantum Leaps. All rights reserved.
+//
+// This program is open source software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Alternatively, this program may be distributed and modified under the
+// terms of Quantum Leaps commercial licenses, which expressly supersede
+// the GNU General Public License and are specifically designed for
+// licensees interested in retaining the proprietary status of their code.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <www.gnu.org/licenses>.
+//
+// Contact information:
+// <www.state-machine.com/licensing>
+// <info@state-machine.com>
+//****************************************************************************
+#include "qmsmtst.cpp" // the QMsmTst state machine generated by QM
+#include "qmsmtst_flat.hpp"
+
+namespace QMSMTST {
+
+// the signals handled in the states of QMsmTst (0-terminated)
+static constexpr QP::QSignal s_sigs[]    { I_SIG, E_SIG, TERMINATE_SIG, 0U };
+static constexpr QP::QSignal s1_sigs[]   { I_SIG, D_SIG, A_SIG, B_SIG,
+                                           F_SIG, C_SIG, 0U };
+static constexpr QP::QSignal s11_sigs[]  { H_SIG, D_SIG, G_SIG, 0U };
+static constexpr QP::QSignal s2_sigs[]   { I_SIG, F_SIG, C_SIG, 0U };
+static constexpr QP::QSignal s21_sigs[]  { G_SIG, A_SIG, B_SIG, 0U };
+static constexpr QP::QSignal s211_sigs[] { H_SIG, D_SIG, 0U };
+static constexpr QP::QSignal s211_bad[]  { H_SIG, 0U }; // D_SIG missing
+
+// the state objects of QMsmTst are protected
+struct QMsmTstFlat : public QMsmTst {
+    static constexpr QP::QMFlatState desc[] {
+        { &s_s,    QP::QM_FLAT_NONE, s_sigs    }, // 0
+        { &s1_s,   0U,               s1_sigs   }, // 1
+        { &s11_s,  1U,               s11_sigs  }, // 2
+        { &s2_s,   0U,               s2_sigs   }, // 3
+        { &s21_s,  3U,               s21_sigs  }, // 4
+        { &s211_s, 4U,               s211_sigs }  // 5
+    };
+    static constexpr QP::QMFlatState badDesc[] {
+        { &s_s,    QP::QM_FLAT_NONE, s_sigs    },
+        { &s1_s,   0U,               s1_sigs   },
+        { &s11_s,  1U,               s11_sigs  },
+        { &s2_s,   0U,               s2_sigs   },
+        { &s21_s,  3U,               s21_sigs  },
+        { &s211_s, 4U,               s211_bad  }
+    };
+    static constexpr QP::QMFlatState partDesc[] {
+        { &s_s,    QP::QM_FLAT_NONE, s_sigs    },
+        { &s1_s,   0U,               s1_sigs   },
+        { &s11_s,  1U,               s11_sigs  },
+        { &s2_s,   0U,               s2_sigs   },
+        { &s21_s,  3U,               s21_sigs  }
+    };
+};
+constexpr QP::QMFlatState QMsmTstFlat::desc[];
+constexpr QP::QMFlatState QMsmTstFlat::badDesc[];
+constexpr QP::QMFlatState QMsmTstFlat::partDesc[];
+
+enum : QP::QSignal { N_SIGS = MAX_SIG - A_SIG };
+
+static constexpr auto l_idx =
+    QP::QM_flatIdx<N_SIGS>(QMsmTstFlat::desc, A_SIG);
+static constexpr auto l_badIdx =
+    QP::QM_flatIdx<N_SIGS>(QMsmTstFlat::badDesc, A_SIG);
+static constexpr auto l_partIdx =
+    QP::QM_flatIdx<N_SIGS>(QMsmTstFlat::partDesc, A_SIG);
+
+static std::uint8_t l_rows[QP::QM_flatRows(Q_DIM(QMsmTstFlat::desc))];
+static std::uint8_t l_badRows[QP::QM_flatRows(Q_DIM(QMsmTstFlat::badDesc))];
+static std::uint8_t l_partRows[
+    QP::QM_flatRows(Q_DIM(QMsmTstFlat::partDesc))];
+
+static constexpr QP::QMFlatTbl l_flatTbl {
+    QMsmTstFlat::desc, l_idx.idx, Q_DIM(QMsmTstFlat::desc), A_SIG, N_SIGS,
+    l_rows, Q_DIM(l_rows)
+};
+static constexpr QP::QMFlatTbl l_badTbl {
+    QMsmTstFlat::badDesc, l_badIdx.idx, Q_DIM(QMsmTstFlat::badDesc),
+    A_SIG, N_SIGS, l_badRows, Q_DIM(l_badRows)
+};
+static constexpr QP::QMFlatTbl l_partTbl {
+    QMsmTstFlat::partDesc, l_partIdx.idx, Q_DIM(QMsmTstFlat::partDesc),
+    A_SIG, N_SIGS, l_partRows, Q_DIM(l_partRows)
+};
+
+QP::QMFlatTbl const * const the_flatTbls[3] {
+    &l_flatTbl,
+    &l_badTbl,
+    &l_partTbl
+};
+
+} // namespace QMSMTST
@@ -0,0 +1,47 @@
+//****************************************************************************
+// Purpose: Flattened dispatch tables of QMsmTst for the QUTEST fixture
+// Last updated for version 6.7.0
+// Last updated on  2019-12-29
+//
+//                    Q u a n t u m  L e a P s
+//                    ------------------------
+//                    Modern Embedded Software
+//
+// Copyright (C) 2005-2019 Quantum Leaps. All rights reserved.
+//
+// This program is open source software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Alternatively, this program may be distributed and modified under the
+// terms of Quantum Leaps commercial licenses, which expressly supersede
+// the GNU General Public License and are specifically designed for
+// licensees interested in retaining the proprietary status of their code.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <www.gnu.org/licenses>.
+//
+// Contact information:
+// <www.state-machine.com/licensing>
+// <info@state-machine.com>
+//****************************************************************************
+#ifndef QMSMTST_FLAT_HPP
+#define QMSMTST_FLAT_HPP
+
+namespace QMSMTST {
+
+// flattened dispatch tables of QMsmTst:
+// [0] complete and correct,
+// [1] the signal D_SIG missing in the state s211,
+// [2] the state s211 not covered
+extern QP::QMFlatTbl const * const the_flatTbls[3];
+
+} // namespace QMSMTST
+
+#endif // QMSMTST_FLAT_HPP
@@ -0,0 +1,68 @@
+# test-script for QUTest unit testing harness
+# see https://www.state-machine.com/qtools/html
+
+# the scripts in ../test are run with the flattened dispatch table as well
+
+# preamble...
+def on_reset():
+    glb_filter(GRP_UA)
+    current_obj(OBJ_SM, "the_msm")
+
+# tests...
+test("QMsmTst flat table, event ignored by all states")
+init()
+expect("@timestamp BSP_DISPLAY top-INIT;")
+expect("@timestamp BSP_DISPLAY s-ENTRY;")
+expect("@timestamp BSP_DISPLAY s2-ENTRY;")
+expect("@timestamp BSP_DISPLAY s2-INIT;")
+expect("@timestamp BSP_DISPLAY s21-ENTRY;")
+expect("@timestamp BSP_DISPLAY s211-ENTRY;")
+expect("@timestamp Trg-Done QS_RX_EVENT")
+dispatch("IGNORE_SIG")
+expect("@timestamp Trg-Done QS_RX_EVENT")
+dispatch("C_SIG") # handled two levels up, in s2
+expect("@timestamp BSP_DISPLAY s2-C;")
+expect("@timestamp BSP_DISPLAY s211-EXIT;")
+expect("@timestamp BSP_DISPLAY s21-EXIT;")
+expect("@timestamp BSP_DISPLAY s2-EXIT;")
+expect("@timestamp BSP_DISPLAY s1-ENTRY;")
+expect("@timestamp BSP_DISPLAY s1-INIT;")
+expect("@timestamp BSP_DISPLAY s11-ENTRY;")
+expect("@timestamp Trg-Done QS_RX_EVENT")
+dispatch("IGNORE_SIG") # the row of s11 found after the transition
+expect("@timestamp Trg-Done QS_RX_EVENT")
+
+test("QMsmTst flat table, state not covered", NORESET)
+command(0, 2)
+expect("@timestamp Trg-Done QS_RX_COMMAND")
+dispatch("F_SIG") # s1 -> s211, which is not in the table
+expect("@timestamp BSP_DISPLAY s1-F;")
+expect("@timestamp BSP_DISPLAY s11-EXIT;")
+expect("@timestamp BSP_DISPLAY s1-EXIT;")
+expect("@timestamp BSP_DISPLAY s2-ENTRY;")
+expect("@timestamp BSP_DISPLAY s21-ENTRY;")
+expect("@timestamp BSP_DISPLAY s211-ENTRY;")
+expect("@timestamp Trg-Done QS_RX_EVENT")
+dispatch("E_SIG") # searched from s211 as without the table
+expect("@timestamp BSP_DISPLAY s-E;")
+expect("@timestamp BSP_DISPLAY s211-EXIT;")
+expect("@timestamp BSP_DISPLAY s21-EXIT;")
+expect("@timestamp BSP_DISPLAY s2-EXIT;")
+expect("@timestamp BSP_DISPLAY s1-ENTRY;")
+expect("@timestamp BSP_DISPLAY s11-ENTRY;")
+expect("@timestamp Trg-Done QS_RX_EVENT")
+
+test("QMsmTst flat table, signal missing in the table")
+command(0, 1)
+expect("@timestamp Trg-Done QS_RX_COMMAND")
+init()
+expect("@timestamp BSP_DISPLAY top-INIT;")
+expect("@timestamp BSP_DISPLAY s-ENTRY;")
+expect("@timestamp BSP_DISPLAY s2-ENTRY;")
+expect("@timestamp BSP_DISPLAY s2-INIT;")
+expect("@timestamp BSP_DISPLAY s21-ENTRY;")
+expect("@timestamp BSP_DISPLAY s211-ENTRY;")
+expect("@timestamp Trg-Done QS_RX_EVENT")
+dispatch("D_SIG") # s211 skipped, but it handles D_SIG
+expect("@timestamp BSP_DISPLAY s211-D;")
+expect("@timestamp =ASSERT= Mod=qep_msm,Loc=305")
@@ -0,0 +1,475 @@
+//****************************************************************************
+// Purpose: Fixture for QUTEST
+// Last updated for version 6.3.5
+// Last updated on  2018-09-17
+//
+//                    Q u a n t u m  L e a P s
+//                    ------------------------
+//                    Modern Embedded Software
+//
+// Copyright (C) 2002-2018 Quantum Leaps, LLC. All rights reserved.
+//
+// This program is open source software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Alternatively, this program may be distributed and modified under the
+// terms of Quantum Leaps commercial licenses, which expressly supersede
+// the GNU General Public License and are specifically designed for
+// licensees interested in retaining the proprietary status of their code.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <www.gnu.org/licenses/>.
+//
+// Contact information:
+// <www.state-machine.com/licensing>
+// <info@state-machine.com>
+//****************************************************************************
+//
+// Generator of a binary QS capture file for testing the offline decoding
+// of QSPY (qspy -f <file>). The trace is produced by the actual QS target
+// code. It contains the Target info and dictionaries that appear also in
+// the middle of the trace (Target resets and objects registered late),
+// state machine records, user records, and some corrupted frames.
+//
+// With the size "stat", the capture contains instead the records of an
+// active object queue, a state machine, and a memory pool with the known
+// statistics (qspy -y) of the queue depth and latency, the RTC steps, and
+// the blocks in use.
+//
+// With the size "dict", the capture contains thousands of object, function
+// and signal dictionaries, some of them renamed later, and the records
+// that refer to all of them (see test_dict.py).
+//
+// usage: gen_trace <capture.bin> <size>|stat|dict [<initial time stamp>]
+//
+#include "qpcpp.hpp"
+#include "qs_pkg.hpp"
+
+#include "safe_std.h" // portable "safe" <stdio.h>/<string.h> facilities
+#include <stdlib.h>
+
+using namespace QP;
+
+Q_DEFINE_THIS_FILE
+
+enum GenSignals {
+    A_SIG = Q_USER_SIG,
+    B_SIG,
+    C_SIG
+};
+
+enum GenRecords {
+    ROUND = QS_USER // one dispatch round of a state machine
+};
+
+// Gen declaration -----------------------------------------------------------
+class Gen : public QHsm {
+public:
+    std::uint32_t m_ctr;
+
+    Gen() : QHsm(Q_STATE_CAST(&Gen::initial)), m_ctr(0U) {}
+    static void dictionaries(void);
+
+private:
+    static QState initial(Gen * const me, QEvt const * const e);
+    static QState s1(Gen * const me, QEvt const * const e);
+    static QState s11(Gen * const me, QEvt const * const e);
+    static QState s2(Gen * const me, QEvt const * const e);
+};
+
+// Local objects -------------------------------------------------------------
+enum { N_GEN = 64 };
+static Gen l_gen[N_GEN]; // state machines producing the trace
+static FILE *l_file;     // the capture file
+static QSTimeCtr l_time; // the time stamp of the trace
+static QSTimeCtr l_tick = 7U; // time stamp increment of every record
+static QEQueue l_queue;  // stands for the queue of an active object
+static QMPool l_pool;    // stands for an event pool
+
+// Gen::SM -------------------------------------------------------------------
+void Gen::dictionaries(void) {
+    QS_FUN_DICTIONARY(&Gen::initial);
+    QS_FUN_DICTIONARY(&Gen::s1);
+    QS_FUN_DICTIONARY(&Gen::s11);
+    QS_FUN_DICTIONARY(&Gen::s2);
+
+    QS_SIG_DICTIONARY(A_SIG, nullptr);
+    QS_SIG_DICTIONARY(B_SIG, nullptr);
+    QS_SIG_DICTIONARY(C_SIG, &l_gen[0]); // object-specific signal
+
+    QS_USR_DICTIONARY(ROUND);
+}
+//............................................................................
+QState Gen::initial(Gen * const me, QEvt const * const e) {
+    (void)e; // unused parameter
+    return Q_TRAN(&Gen::s11);
+}
+//............................................................................
+QState Gen::s1(Gen * const me, QEvt const * const e) {
+    QState status_;
+    switch (e->sig) {
+        case Q_ENTRY_SIG: {
+            status_ = Q_HANDLED();
+            break;
+        }
+        case Q_EXIT_SIG: {
+            status_ = Q_HANDLED();
+            break;
+        }
+        case B_SIG: {
+            status_ = Q_TRAN(&Gen::s2);
+            break;
+        }
+        default: {
+            status_ = Q_SUPER(&QHsm::top);
+            break;
+        }
+    }
+    return status_;
+}
+//............................................................................
+QState Gen::s11(Gen * const me, QEvt const * const e) {
+    QState status_;
+    switch (e->sig) {
+        case Q_ENTRY_SIG: {
+            status_ = Q_HANDLED();
+            break;
+        }
+        case A_SIG: {
+            ++me->m_ctr;
+            status_ = Q_HANDLED();
+            break;
+        }
+        default: {
+            status_ = Q_SUPER(Q_STATE_CAST(&Gen::s1));
+            break;
+        }
+    }
+    return status_;
+}
+//............................................................................
+QState Gen::s2(Gen * const me, QEvt const * const e) {
+    QState status_;
+    switch (e->sig) {
+        case C_SIG: {
+            status_ = Q_TRAN(&Gen::s11);
+            break;
+        }
+        default: {
+            status_ = Q_SUPER(&QHsm::top);
+            break;
+        }
+    }
+    return status_;
+}
+
+//............................................................................
+// object dictionaries of the state machines [lo..hi)
+static void objDictionaries(int lo, int hi) {
+    for (int i = lo; i < hi; ++i) {
+        char name[16];
+        SNPRINTF_S(name, sizeof(name), "l_gen[%d]", i);
+        QS::obj_dict_pre_(&l_gen[i], name);
+    }
+}
+
+//............................................................................
+// the records with known statistics, see test_stat.py
+static void statTrace(void) {
+    Gen * const sm = &l_gen[0];
+    QS_CRIT_STAT_
+
+    objDictionaries(0, 1);
+    QS::obj_dict_pre_(&l_queue, "l_queue");
+    QS::obj_dict_pre_(&l_pool, "l_pool");
+    l_tick = 0U; // every record gets the time stamp l_time set below
+
+    // RTC steps 1..999 and one outlier of 5000
+    for (QSTimeCtr i = 1U; i <= 1000U; ++i) {
+        l_time = i * 10000U;
+        QS_BEGIN_PRE_(QS_QEP_DISPATCH, nullptr, sm)
+            QS_TIME_PRE_();
+            QS_SIG_PRE_(A_SIG);
+            QS_OBJ_PRE_(sm);
+            QS_FUN_PRE_(&QHsm::top);
+        QS_END_PRE_()
+        l_time += (i < 1000U) ? i : 5000U;
+        QS_BEGIN_PRE_(QS_QEP_INTERN_TRAN, nullptr, sm)
+            QS_TIME_PRE_();
+            QS_SIG_PRE_(A_SIG);
+            QS_OBJ_PRE_(sm);
+            QS_FUN_PRE_(&QHsm::top);
+        QS_END_PRE_()
+    }
+    QS::onFlush();
+
+    // 10 times: 10 events posted (depth 1..10) and then taken out of the
+    // queue, the event i after 10*(i+1) ticks
+    for (QSTimeCtr r = 0U; r < 10U; ++r) {
+        QSTimeCtr const t0 = 20000000U + (r * 1000U);
+        for (QSTimeCtr i = 0U; i < 10U; ++i) {
+            l_time = t0 + i;
+            QS_BEGIN_PRE_(QS_QF_ACTIVE_POST, nullptr, &l_queue)
+                QS_TIME_PRE_();
+                QS_OBJ_PRE_(sm);       // the sender
+                QS_SIG_PRE_(B_SIG);
+                QS_OBJ_PRE_(&l_queue);
+                QS_2U8_PRE_(0U, 0U);
+                QS_EQC_PRE_(9U - i);   // free entries
+                QS_EQC_PRE_(9U - i);   // min free entries
+            QS_END_PRE_()
+        }
+        for (QSTimeCtr i = 0U; i < 10U; ++i) {
+            l_time = t0 + i + (10U * (i + 1U));
+            if (i < 9U) {
+                QS_BEGIN_PRE_(QS_QF_ACTIVE_GET, nullptr, &l_queue)
+                    QS_TIME_PRE_();
+                    QS_SIG_PRE_(B_SIG);
+                    QS_OBJ_PRE_(&l_queue);
+                    QS_2U8_PRE_(0U, 0U);
+                    QS_EQC_PRE_(i + 1U); // free entries
+                QS_END_PRE_()
+            }
+            else {
+                QS_BEGIN_PRE_(QS_QF_ACTIVE_GET_LAST, nullptr, &l_queue)
+                    QS_TIME_PRE_();
+                    QS_SIG_PRE_(B_SIG);
+                    QS_OBJ_PRE_(&l_queue);
+                    QS_2U8_PRE_(0U, 0U);
+                QS_END_PRE_()
+            }
+        }
+    }
+    QS::onFlush();
+
+    // 10 times: all 8 blocks of the pool taken and returned
+    for (QSTimeCtr r = 0U; r < 10U; ++r) {
+        l_time = 30000000U + (r * 1000U);
+        for (QSTimeCtr i = 0U; i < 8U; ++i) {
+            ++l_time;
+            QS_BEGIN_PRE_(QS_QF_MPOOL_GET, nullptr, &l_pool)
+                QS_TIME_PRE_();
+                QS_OBJ_PRE_(&l_pool);
+                QS_MPC_PRE_(7U - i); // free blocks
+                QS_MPC_PRE_(7U - i); // min free blocks
+            QS_END_PRE_()
+        }
+        for (QSTimeCtr i = 0U; i < 8U; ++i) {
+            ++l_time;
+            QS_BEGIN_PRE_(QS_QF_MPOOL_PUT, nullptr, &l_pool)
+                QS_TIME_PRE_();
+                QS_OBJ_PRE_(&l_pool);
+                QS_MPC_PRE_(i + 1U); // free blocks
+            QS_END_PRE_()
+        }
+    }
+}
+
+//............................................................................
+// the many dictionaries and their records, see test_dict.py
+enum {
+    N_DICT_OBJ = 6000, // objects, every 5th only in the -d dictionary file
+    N_DICT_FUN = 3000, // state handlers
+    N_DICT_SIG = 2000  // global signals, every object 10*k has its own
+};
+// fake addresses of the objects and state handlers (never dereferenced)
+static void const *dictObj(int i) {
+    return reinterpret_cast<void const *>(
+        static_cast<std::uintptr_t>(0x10000000U + (i * 16U)));
+}
+static void (*dictFun(int i))(void) {
+    return reinterpret_cast<void (*)(void)>(
+        static_cast<std::uintptr_t>(0x20000000U + (i * 16U)));
+}
+static void dispatchRecords(void) {
+    QS_CRIT_STAT_
+    for (int i = 0; i < N_DICT_OBJ; ++i) {
+        QS_BEGIN_PRE_(QS_QEP_DISPATCH, nullptr, nullptr)
+            QS_TIME_PRE_();
+            QS_SIG_PRE_(Q_USER_SIG + (i % N_DICT_SIG));
+            QS_OBJ_PRE_(dictObj(i));
+            QS_FUN_PRE_(dictFun(i % N_DICT_FUN));
+        QS_END_PRE_()
+        if ((i % 1000) == 999) {
+            QS::onFlush();
+        }
+    }
+}
+static void dictTrace(void) {
+    char name[16];
+    for (int i = 0; i < N_DICT_OBJ; ++i) {
+        if ((i % 5) != 4) {
+            SNPRINTF_S(name, sizeof(name), "obj%d", i);
+            QS::obj_dict_pre_(dictObj(i), name);
+        }
+        if ((i % 10) == 0) { // object-specific signal
+            SNPRINTF_S(name, sizeof(name), "LOC%d", i);
+            QS::sig_dict_pre_(Q_USER_SIG + (i % N_DICT_SIG), dictObj(i),
+                              name);
+        }
+        QS::onFlush();
+    }
+    for (int i = 0; i < N_DICT_FUN; ++i) {
+        SNPRINTF_S(name, sizeof(name), "fun%d", i);
+        QS::fun_dict_pre_(dictFun(i), name);
+        QS::onFlush();
+    }
+    for (int i = 0; i < N_DICT_SIG; ++i) {
+        SNPRINTF_S(name, sizeof(name), "SIG%d", i);
+        QS::sig_dict_pre_(Q_USER_SIG + i, nullptr, name);
+        QS::onFlush();
+    }
+    dispatchRecords();
+
+    // rename every 7th object and every 11th global signal
+    for (int i = 0; i < N_DICT_OBJ; i += 7) {
+        if ((i % 5) != 4) {
+            SNPRINTF_S(name, sizeof(name), "new%d", i);
+            QS::obj_dict_pre_(dictObj(i), name);
+            QS::onFlush();
+        }
+    }
+    for (int i = 0; i < N_DICT_SIG; i += 11) {
+        SNPRINTF_S(name, sizeof(name), "NSIG%d", i);
+        QS::sig_dict_pre_(Q_USER_SIG + i, nullptr, name);
+        QS::onFlush();
+    }
+    dispatchRecords();
+}
+
+//............................................................................
+int main(int argc, char *argv[]) {
+    static QEvt const aEvt = { A_SIG, 0U, 0U };
+    static QEvt const bEvt = { B_SIG, 0U, 0U };
+    static QEvt const cEvt = { C_SIG, 0U, 0U };
+
+    if (argc < 3) {
+        FPRINTF_S(stderr, "%s\n",
+            "usage: gen_trace <capture.bin> <size>|stat|dict "
+            "[<initial time stamp>]");
+        return -1;
+    }
+    long const size = atol(argv[2]);
+    if (argc > 3) { // the time stamp might wrap around in the trace
+        l_time = static_cast<QSTimeCtr>(strtoul(argv[3], nullptr, 0));
+    }
+
+    QF::init();
+    Q_ALLEGE(QS_INIT(argv[1]));
+    QS_FILTER_ON(QS_ALL_RECORDS);
+
+    Gen::dictionaries(); // Target info produced already in QS::initBuf()
+    if (strcmp(argv[2], "stat") == 0) {
+        statTrace();
+        QS::onCleanup();
+        return 0;
+    }
+    if (strcmp(argv[2], "dict") == 0) {
+        dictTrace();
+        QS::onCleanup();
+        return 0;
+    }
+    objDictionaries(0, N_GEN/4); // the remaining objects are added later
+    for (int i = 0; i < N_GEN; ++i) {
+        l_gen[i].init();
+    }
+
+    for (std::uint32_t round = 1U; ftell(l_file) < size; ++round) {
+        for (int k = 0; k < 10; ++k) {
+            Gen * const me = &l_gen[((round * 7U) + k) % N_GEN];
+            me->dispatch(&aEvt);
+            me->dispatch(&bEvt);
+            me->dispatch(&cEvt);
+
+            QS_BEGIN(ROUND, me) // application-specific record
+                QS_U32(8, round);
+                QS_STR("round");
+                QS_OBJ(me);
+                QS_U32(0, me->m_ctr);
+            QS_END()
+        }
+
+        if ((round % 50U) == 0U) { // register another object?
+            int const n = (N_GEN/4) + static_cast<int>(round / 50U);
+            if (n <= N_GEN) {
+                objDictionaries(n - 1, n);
+            }
+        }
+        if ((round % 400U) == 0U) { // Target reset clears the dictionaries
+            QS_target_info_(0xFFU);
+            Gen::dictionaries();
+            objDictionaries(0, N_GEN/2);
+        }
+        QS::onFlush();
+
+        if ((round % 300U) == 0U) { // a truncated frame (sequence gap)
+            static std::uint8_t const junk[] = { 0x7EU, 0x12U, 0x64U };
+            fwrite(&junk[1], 1U, sizeof(junk) - 1U, l_file);
+            fwrite(&junk[0], 1U, 1U, l_file);
+        }
+    }
+
+    QS::onCleanup();
+    return 0;
+}
+
+//----------------------------------------------------------------------------
+bool QS::onStartup(void const *arg) {
+    static std::uint8_t qsBuf[64*1024]; // buffer for QS trace records
+
+    initBuf(qsBuf, sizeof(qsBuf));
+    FOPEN_S(l_file, static_cast<char const *>(arg), "wb");
+    return l_file != nullptr;
+}
+//............................................................................
+void QS::onCleanup(void) {
+    onFlush();
+    fclose(l_file);
+}
+//............................................................................
+void QS::onFlush(void) {
+    std::uint16_t nBytes = 0xFFFFU;
+    std::uint8_t const *block;
+    while ((block = getBlock(&nBytes)) != nullptr) {
+        fwrite(block, 1U, nBytes, l_file);
+        nBytes = 0xFFFFU;
+    }
+}
+//............................................................................
+QSTimeCtr QS::onGetTime(void) {
+    return l_time += l_tick; // the same trace on every run
+}
+//............................................................................
+void QS::onReset(void) {
+}
+//............................................................................
+void QS::onCommand(std::uint8_t cmdId, std::uint32_t param1,
+                   std::uint32_t param2, std::uint32_t param3)
+{
+    (void)cmdId;
+    (void)param1;
+    (void)param2;
+    (void)param3;
+}
+
+//............................................................................
+void QF::onStartup(void) {
+}
+//............................................................................
+void QF::onCleanup(void) {
+}
+//............................................................................
+void QP::QF_onClockTick(void) {
+}
+//............................................................................
+extern "C" Q_NORETURN Q_onAssert(char const * const module, int_t const loc) {
+    FPRINTF_S(stderr, "Assertion failed in %s:%d\n", module, loc);
+    exit(-1);
+}
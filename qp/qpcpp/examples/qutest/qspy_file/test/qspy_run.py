@@ -0,0 +1,37 @@
+# helpers shared by the tests of the offline decoding of QS capture files
+#
+import os
+import pty
+import subprocess
+
+TRACE = 'build/trace.bin'
+TRACE_SIZE = 3*1024*1024 # more than the minimum chunk (256K) per -j job
+
+# run QSPY without the Back-End and return its screen output lines, except
+# for the lines that differ from run to run (timestamps and jobs)
+def qspy(exe, *opts, cwd=None):
+    # QSPY needs a terminal for the keyboard input
+    master, slave = pty.openpty()
+    try:
+        out = subprocess.run([os.path.abspath(exe), '-u0'] + list(opts),
+                             stdin=slave, stdout=subprocess.PIPE,
+                             cwd=cwd, timeout=120).stdout
+    finally:
+        os.close(slave)
+        os.close(master)
+    return [ln for ln in out.decode().splitlines()
+            if not ln.startswith(('-j ', 'Current timestamp:'))
+            and 'Opened File=' not in ln]
+
+# the decoded records, without the QSPY banner, options and 'QSPY Done'
+def records(lines):
+    return lines[lines.index('') + 1 : len(lines) - lines[::-1].index('') - 1]
+
+# produce the capture file with the gen_trace program, optionally with the
+# initial time stamp 't0'
+def gen_trace(gen, t0=0):
+    subprocess.run([gen, TRACE, str(TRACE_SIZE), str(t0)], check=True)
+
+def check(name, ok):
+    print(name + ': ' + ('PASS' if ok else 'FAIL'))
+    return ok
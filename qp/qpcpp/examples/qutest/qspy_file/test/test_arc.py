@@ -0,0 +1,135 @@
+# test of the indexed QS archive of QSPY (qspy -a, -x <archive> -w <filter>)
+#
+# usage: python3 test_arc.py <gen_trace> <qspy>
+#
+# The capture is decoded once with -a, which also saves the archive. The
+# queries of the archive must then print exactly the records of that
+# decoding which match the filter. The corrupted frames are not archived.
+# A second capture starts just before the 32-bit time stamp wraps around.
+#
+import glob
+import os
+import re
+import sys
+
+from qspy_run import TRACE, qspy, records, gen_trace, check
+
+ARC_DIR = 'build' # QSPY saves the archive in the current directory
+T0_WRAP = 2**32 - 300000 # the time stamp wraps around after the 1st reset
+
+# time stamp of each record, inherited by the records without their own
+def tstamps(lines):
+    t = None
+    for ln in lines:
+        if ln[:10].isdigit():
+            t = int(ln[:10])
+        yield t
+
+# (epoch, archive time) of each record: the time stamp extended to 64 bits
+# by counting the wrap-arounds, restarted by every Target reset
+def arc_times(lines):
+    epoch, raw, wraps, t = 0, 0, 0, 0
+    for ln in lines:
+        if 'Trg-RST' in ln:
+            epoch, raw, wraps, t = epoch + 1, 0, 0, 0
+        elif ln[:10].isdigit():
+            if int(ln[:10]) < raw:
+                wraps += 1
+            raw = int(ln[:10])
+            t = (wraps << 32) + raw
+        yield epoch, t
+
+# decode the capture once with -a and return the healthy records and the
+# archive saved
+def archive(exe):
+    for arc in glob.glob(os.path.join(ARC_DIR, 'qspy*.qsa')):
+        os.remove(arc)
+    ref = records(qspy(exe, '-f', os.path.abspath(TRACE), '-a',
+                       cwd=ARC_DIR))
+    arc = glob.glob(os.path.join(ARC_DIR, 'qspy*.qsa'))
+    return ([ln for ln in ref if '<COMMS> ERROR' not in ln],
+            arc[0] if len(arc) == 1 else None)
+
+# numbers of the blocks read and of all blocks from the query summary line
+def blocks(summary):
+    m = re.search(r'Query Blocks=(\d+)/(\d+),', summary)
+    return (int(m.group(1)), int(m.group(2))) if m else (0, -1)
+
+def main(gen, exe):
+    gen_trace(gen)
+    healthy, arc = archive(exe)
+    if not check('archive saved', arc is not None):
+        return 1
+
+    # all records, including the Target info and dictionaries
+    out = records(qspy(exe, '-x', arc))
+    ok = check('query of all records',
+               out[:-1] == healthy
+               and blocks(out[-1])[0] == blocks(out[-1])[1])
+
+    # record-ID and object
+    out = records(qspy(exe, '-x', arc,
+                       '-w', 'rec=QS_QEP_DISPATCH,obj=l_gen<5>'))
+    exp = [ln for ln in healthy if ' Disp===> Obj=l_gen<5>,' in ln]
+    ok &= check('query of record-ID and object',
+                len(exp) > 0 and out[:-1] == exp
+                and out[-1].endswith(',Matched=%d' % len(exp)))
+
+    # signal, decoded also by the records of other kinds
+    out = records(qspy(exe, '-x', arc, '-w', 'sig=B_SIG'))
+    exp = [ln for ln in healthy if ',Sig=B_SIG,' in ln]
+    ok &= check('query of signal',
+                len(exp) > 0 and out[:-1] == exp)
+
+    # time stamp range, which needs only some of the blocks
+    out = records(qspy(exe, '-x', arc, '-w', 't=100000-110000'))
+    exp = [ln for ln, t in zip(healthy, tstamps(healthy))
+           if (t is not None) and (100000 <= t <= 110000)
+           and not ln.startswith('           ')] # state records
+    ok &= check('query of time stamp range',
+                len(exp) > 0 and out[:-1] == exp
+                and blocks(out[-1])[0] < blocks(out[-1])[1])
+
+    # object not in the dictionaries
+    out = records(qspy(exe, '-x', arc, '-w', 'obj=l_gen<99>'))
+    ok &= check('query of unknown object',
+                out[-1].endswith(',Matched=0'))
+
+    # not an archive
+    out = qspy(exe, '-x', os.path.abspath(TRACE))
+    ok &= check('query of a file that is not an archive',
+                any('Not a QSPY archive' in ln for ln in out))
+
+    # the time stamp wrapping around in the 2nd epoch (after the 1st reset)
+    gen_trace(gen, T0_WRAP)
+    healthy, arc = archive(exe)
+    times = list(arc_times(healthy))
+    wrapped = [(e, t) for e, t in times if t >= 2**32]
+    ok &= check('archive of a time stamp wrap-around saved',
+                (arc is not None) and (len(wrapped) > 0)
+                and all(e == 2 for e, t in wrapped))
+
+    # the records after the wrap-around, and only those
+    out = records(qspy(exe, '-x', arc,
+                       '-w', 'epoch=2,t=%d-%d' % (2**32, 2**32 + 50000)))
+    exp = [ln for ln, (e, t) in zip(healthy, times)
+           if (e == 2) and (2**32 <= t <= 2**32 + 50000)]
+    ok &= check('query of time range after a wrap-around',
+                len(exp) > 0 and out[:-1] == exp
+                and blocks(out[-1])[0] < blocks(out[-1])[1])
+
+    # the raw time stamps after the wrap-around are not the archive time
+    out = records(qspy(exe, '-x', arc, '-w', 'epoch=2,t=1-50000'))
+    ok &= check('query of raw time stamps after a wrap-around',
+                out[-1].endswith(',Matched=0'))
+
+    # a whole epoch
+    out = records(qspy(exe, '-x', arc, '-w', 'epoch=1'))
+    exp = [ln for ln, (e, t) in zip(healthy, times) if e == 1]
+    ok &= check('query of an epoch',
+                len(exp) > 0 and out[:-1] == exp)
+
+    return 0 if ok else 1
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1], sys.argv[2]))
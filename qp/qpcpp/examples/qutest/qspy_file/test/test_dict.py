@@ -0,0 +1,101 @@
+# test of the dictionaries of QSPY with thousands of entries
+#
+# usage: python3 test_dict.py <gen_trace> <qspy>
+#
+# The capture produced by 'gen_trace <file> dict' contains the dictionaries
+# of 6000 objects, 3000 state handlers, 2000 global signals, and 600 signals
+# local to the objects 10*k. Every 5th object is missing in the capture and
+# comes from the dictionary file (-d) instead. All objects are dispatched
+# once, then every 7th object and every 11th global signal is renamed, and
+# all objects are dispatched once again.
+#
+import glob
+import os
+import struct
+import sys
+import subprocess
+
+from qspy_run import TRACE, qspy, records, check
+
+N_OBJ = 6000
+N_FUN = 3000
+N_SIG = 2000
+Q_USER_SIG = 4
+
+DICT = 'build/ext.dic'
+ARC_DIR = 'build' # QSPY saves the archive in the current directory
+
+# fake addresses of the objects (gen_trace.cpp)
+def obj_addr(i):
+    return 0x10000000 + (i * 16)
+
+def obj_name(i, renamed):
+    if (i % 5) == 4:
+        return 'ext%d' % i
+    return ('new%d' if renamed and (i % 7) == 0 else 'obj%d') % i
+
+def sig_name(i, renamed):
+    if (i % 10) == 0:
+        return 'LOC%d' % i
+    j = i % N_SIG
+    return ('NSIG%d' if renamed and (j % 11) == 0 else 'SIG%d') % j
+
+# the dictionary file in the format of QSPY_writeDict()
+def write_dict():
+    size = struct.calcsize('P') # the host runs gen_trace
+    with open(DICT, 'w') as f:
+        f.write('Obj-Dic:\n%d\n' % size)
+        for i in range(4, N_OBJ, 5):
+            f.write('0x%0*X ext%d\n' % (2 * size, obj_addr(i), i))
+        f.write('***\n')
+
+def main(gen, exe):
+    subprocess.run([gen, TRACE, 'dict'], check=True)
+    write_dict()
+
+    for arc in glob.glob(os.path.join(ARC_DIR, 'qspy*.qsa')):
+        os.remove(arc)
+    dic = os.path.abspath(DICT)
+    out = records(qspy(exe, '-f', os.path.abspath(TRACE), '-d' + dic, '-a',
+                       cwd=ARC_DIR))
+    disp = [ln[11:] for ln in out if ' Disp===> ' in ln]
+    exp = ['Disp===> Obj=%s,Sig=%s,State=fun%d'
+           % (obj_name(i, r), sig_name(i, r), i % N_FUN)
+           for r in (False, True) for i in range(N_OBJ)]
+
+    ok = check('dictionary file read',
+               not any('Dictionaries not found' in ln
+                       or 'Parsing OBJ dictionaries failed' in ln
+                       for ln in out))
+    ok &= check('all names of the first dispatches',
+                disp[:N_OBJ] == exp[:N_OBJ])
+    ok &= check('renamed objects and signals in the second dispatches',
+                disp[N_OBJ:] == exp[N_OBJ:])
+
+    # the archive queries look up the names in the dictionaries in effect
+    # at every record, so the old and new names split the records of an
+    # object (or signal) at its renaming
+    arc = glob.glob(os.path.join(ARC_DIR, 'qspy*.qsa'))
+    if not check('archive saved', len(arc) == 1):
+        return 1
+    def matched(filt):
+        res = records(qspy(exe, '-x', arc[0], '-d' + dic, '-w', filt))
+        return int(res[-1].rsplit('Matched=', 1)[1])
+
+    ok &= check('query of a renamed object by the old and new names',
+                matched('rec=QS_QEP_DISPATCH,obj=obj21') == 1
+                and matched('rec=QS_QEP_DISPATCH,obj=new21') == 1)
+    ok &= check('query of the last object',
+                matched('rec=QS_QEP_DISPATCH,obj=obj5998') == 2)
+    ok &= check('query of an object from the dictionary file',
+                matched('rec=QS_QEP_DISPATCH,obj=ext5999') == 2)
+    ok &= check('query of a renamed global signal by the old and new names',
+                matched('rec=QS_QEP_DISPATCH,sig=SIG11') == 3
+                and matched('rec=QS_QEP_DISPATCH,sig=NSIG11') == 3)
+    ok &= check('query of a signal local to an object',
+                matched('rec=QS_QEP_DISPATCH,obj=obj40,sig=LOC40') == 2)
+
+    return 0 if ok else 1
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1], sys.argv[2]))
@@ -0,0 +1,33 @@
+# test of the parallel decoding of QS capture files (qspy -f <file> -j)
+#
+# usage: python3 test_jobs.py <gen_trace> <qspy>
+#
+# The screen output of every parallel decoding must be identical to the
+# sequential decoding of the same capture, except for the lines that
+# mention the number of jobs.
+#
+import sys
+
+from qspy_run import TRACE, qspy, gen_trace, check
+
+def main(gen, exe):
+    gen_trace(gen)
+
+    ref = qspy(exe, '-f', TRACE)
+    ok = check('capture with resets, late dictionaries and errors',
+               sum('Trg-RST' in ln for ln in ref) > 1
+               and any('Obj-Dict' in ln and 'l_gen<36>' in ln for ln in ref)
+               and any('ERROR' in ln for ln in ref))
+
+    for jobs in ('-j1', '-j2', '-j3', '-j8', '-j'):
+        ok &= check('output of ' + jobs + ' same as sequential',
+                    qspy(exe, '-f', TRACE, jobs) == ref)
+
+    ok &= check('quiet output of -j4 same as sequential',
+                qspy(exe, '-f', TRACE, '-q', '-j4')
+                == qspy(exe, '-f', TRACE, '-q'))
+
+    return 0 if ok else 1
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1], sys.argv[2]))
@@ -0,0 +1,71 @@
+# test of the statistics of QSPY (qspy -f <file> -y)
+#
+# usage: python3 test_stat.py <gen_trace> <qspy>
+#
+# The capture produced by 'gen_trace <file> stat' contains the samples
+# listed below. QSPY reports the percentiles from log-linear histograms
+# (8 sub-buckets per power of two), so the expected p50/p90/p99 are the
+# exact percentiles rounded up to the top of their bucket (at most Max).
+#
+import sys
+import subprocess
+
+from qspy_run import TRACE, qspy, records, check
+
+# the largest value in the histogram bucket of x
+def bucket_top(x):
+    if x < 8:
+        return x
+    step = 1 << (x.bit_length() - 4)
+    return ((x // step) + 1) * step - 1
+
+# the "Name<p50=,p90=,p99=,Max=>" summary of the samples
+def summary(name, samples):
+    s = sorted(samples)
+    def pct(p):
+        return min(bucket_top(s[(len(s) * p + 99) // 100 - 1]), s[-1])
+    return '%s<p50=%d,p90=%d,p99=%d,Max=%d>' % (
+        name, pct(50), pct(90), pct(99), s[-1])
+
+# the blocks in use, counted from the most free blocks seen so far
+def in_use(free):
+    most, used = 0, []
+    for n in free:
+        most = max(most, n)
+        used.append(most - n)
+    return used
+
+def main(gen, exe):
+    subprocess.run([gen, TRACE, 'stat'], check=True)
+    out = [ln.strip() for ln in records(qspy(exe, '-f', TRACE, '-y0'))
+           if '<STAT->' in ln]
+
+    steps  = list(range(1, 1000)) + [5000]
+    depth  = list(range(1, 11)) * 10
+    delay  = [10 * (i + 1) for i in range(10)] * 10
+    inUse  = in_use(([7 - i for i in range(8)]
+                     + [i + 1 for i in range(8)]) * 10)
+
+    ok = check('report of all the objects',
+               '<STAT-> Final   AOs=1,SMs=1,MPs=1,Lost=0' in out)
+    ok &= check('queue depth and latency',
+                '<STAT-> AO=l_queue,Posts=100,Gets=100,'
+                + summary('Depth', depth) + ',Min=0,'
+                + summary('Latency', delay) in out)
+    ok &= check('RTC steps',
+                '<STAT-> SM=l_gen<0>,RTCs=1000,'
+                + summary('Step', steps) in out)
+    ok &= check('pool blocks in use',
+                '<STAT-> MP=l_pool,Gets=80,Puts=80,'
+                + summary('InUse', inUse) + ',Min=0' in out)
+
+    # the same, worked out by hand: 500 in [480..511], 900 in [896..959],
+    # 990 in [960..1023]
+    ok &= check('RTC step percentiles of a long tail',
+                any(ln.endswith('Step<p50=511,p90=959,p99=1023,Max=5000>')
+                    for ln in out))
+
+    return 0 if ok else 1
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1], sys.argv[2]))
@@ -0,0 +1,207 @@
+/// @file
+/// @brief Fixture for QUTEST of the batched clock ticks (QF::tickN_())
+/// @ingroup qs
+/// @cond
+///***************************************************************************
+/// Last updated for version 6.8.2
+/// Last updated on  2020-07-17
+///
+///                    Q u a n t u m  L e a P s
+///                    ------------------------
+///                    Modern Embedded Software
+///
+/// Copyright (C) 2005-2018 Quantum Leaps, LLC. All rights reserved.
+///
+/// This program is open source software: you can redistribute it and/or
+/// modify it under the terms of the GNU General Public License as published
+/// by the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Alternatively, this program may be distributed and modified under the
+/// terms of Quantum Leaps commercial licenses, which expressly supersede
+/// the GNU General Public License and are specifically designed for
+/// licensees interested in retaining the proprietary status of their code.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program. If not, see <www.gnu.org/licenses>.
+///
+/// Contact information:
+/// <www.state-machine.com/licensing>
+/// <info@state-machine.com>
+///***************************************************************************
+/// @endcond
+
+#include "qpcpp.hpp" // for QUTEST
+
+using namespace QP;
+
+Q_DEFINE_THIS_FILE
+
+//----------------------------------------------------------------------------
+enum TickNSignals {
+    TIMEOUT0_SIG = Q_USER_SIG, // the signal of the time event 0
+    TIMEOUT1_SIG,              // the signal of the time event 1
+    MAX_SIG
+};
+
+enum {
+    EXPIRED = QS_USER // the AO received a time event
+};
+
+enum {
+    ARM,    // command: arm the time event param1 for param2 ticks
+            //          with the interval param3
+    MARK,   // command: mark param1 clock ticks (as the tickless loop)
+    TICK_N, // command: process param1 clock ticks at once
+    TICKER  // command: post param1 clock ticks to the ticker AO
+};
+
+// Timer declaration ---------------------------------------------------------
+class Timer : public QActive {
+public:
+    QTimeEvt m_te0;
+    QTimeEvt m_te1;
+
+    Timer()
+      : QActive(Q_STATE_CAST(&Timer::initial)),
+        m_te0(this, TIMEOUT0_SIG, 0U),
+        m_te1(this, TIMEOUT1_SIG, 0U)
+    {}
+private:
+    static QState initial(Timer * const me, QEvt const * const e);
+    static QState active(Timer * const me, QEvt const * const e);
+};
+
+// Local objects -------------------------------------------------------------
+static Timer l_timer; // the single instance of the Timer AO
+static QActive * const AO_Timer = &l_timer;
+static QTicker l_ticker0(0U); // ticker AO for the tick rate 0
+static std::uint8_t const l_ticker = 0U; // the sender of the clock ticks
+
+// Timer::SM -----------------------------------------------------------------
+QState Timer::initial(Timer * const me, QEvt const * const e) {
+    (void)e; // unused parameter
+
+    QS_FUN_DICTIONARY(&QHsm::top);
+    QS_FUN_DICTIONARY(&Timer::initial);
+    QS_FUN_DICTIONARY(&Timer::active);
+
+    QS_OBJ_DICTIONARY(&me->m_te0);
+    QS_OBJ_DICTIONARY(&me->m_te1);
+
+    QS_SIG_DICTIONARY(TIMEOUT0_SIG, nullptr);
+    QS_SIG_DICTIONARY(TIMEOUT1_SIG, nullptr);
+
+    return Q_TRAN(&Timer::active);
+}
+//............................................................................
+QState Timer::active(Timer * const me, QEvt const * const e) {
+    QState status_;
+    switch (e->sig) {
+        case TIMEOUT0_SIG: // intentionally fall through
+        case TIMEOUT1_SIG: {
+            QS_BEGIN(EXPIRED, nullptr) // app-specific record
+                QS_U8(0, static_cast<std::uint8_t>(e->sig - TIMEOUT0_SIG));
+            QS_END()
+            status_ = Q_HANDLED();
+            break;
+        }
+        default: {
+            status_ = Q_SUPER(&QHsm::top);
+            break;
+        }
+    }
+    (void)me; // unused parameter
+    return status_;
+}
+
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[]) {
+    static QEvt const *timerQueueSto[20];
+
+    QF::init();   // initialize the framework and the underlying RT kernel
+
+    // initialize the QS software tracing
+    Q_ALLEGE(QS_INIT(argc > 1 ? argv[1] : nullptr));
+
+    // object dictionaries...
+    QS_OBJ_DICTIONARY(AO_Timer);
+    QS_OBJ_DICTIONARY(&l_ticker0);
+    QS_OBJ_DICTIONARY(&l_ticker);
+
+    // pause execution of the test and wait for the test script to continue
+    QS_TEST_PAUSE();
+
+    AO_Timer->start(1U,                  // QP priority of the AO
+                  timerQueueSto,         // event queue storage
+                  Q_DIM(timerQueueSto),  // queue length [events]
+                  nullptr, 0U);          // stack storage and size
+
+    l_ticker0.start(2U,                  // QP priority of the ticker
+                  nullptr, 0U,           // no event queue
+                  nullptr, 0U);          // no stack
+
+    return QF::run(); // run the QF application
+}
+
+//----------------------------------------------------------------------------
+void QS::onTestSetup(void) {
+    QS_USR_DICTIONARY(EXPIRED);
+}
+//............................................................................
+void QS::onTestTeardown(void) {
+    l_timer.m_te0.disarm();
+    l_timer.m_te1.disarm();
+}
+
+//............................................................................
+void QS::onCommand(uint8_t cmdId,
+                   uint32_t param1, uint32_t param2, uint32_t param3)
+{
+    switch (cmdId) {
+        case ARM: {
+            QTimeEvt &te = (param1 == 0U) ? l_timer.m_te0 : l_timer.m_te1;
+            te.armX(static_cast<QTimeEvtCtr>(param2),
+                    static_cast<QTimeEvtCtr>(param3));
+            break;
+        }
+        case MARK: { // the clock tick loop takes the ticks to process
+            QF_CRIT_ENTRY(dummy);
+            QF::tickMark_(0U, static_cast<QTimeEvtCtr>(param1));
+            QF_CRIT_EXIT(dummy);
+            break;
+        }
+        case TICK_N: {
+            QF::TICK_N(0U, static_cast<QTimeEvtCtr>(param1), &l_ticker);
+            break;
+        }
+        case TICKER: { // the ticker runs only after all the posts
+            for (uint32_t i = 0U; i < param1; ++i) {
+                l_ticker0.POST(nullptr, &l_ticker);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+//............................................................................
+//! callback function to "massage" the injected QP events (not used here)
+void QS::onTestEvt(QEvt *e) {
+    (void)e; // unused parameter
+}
+//............................................................................
+// callback function to output the posted QP events (not used here)
+void QS::onTestPost(void const *sender, QActive *recipient,
+                    QEvt const *e, bool status)
+{
+    (void)sender;
+    (void)recipient;
+    (void)e;
+    (void)status;
+}
@@ -0,0 +1,71 @@
+# test-script for QUTest unit testing harness
+# see https://www.state-machine.com/qtools/html
+
+# the commands of the fixture
+ARM = 0
+MARK = 1
+TICK_N = 2
+TICKER = 3
+
+def tick_n(n, *expired):
+    command(TICK_N, n)
+    for te in expired:
+        expect("@timestamp EXPIRED %d" % te)
+    expect("@timestamp Trg-Done QS_RX_COMMAND")
+
+def arm(te, n, interval=0):
+    command(ARM, te, n, interval)
+    expect("@timestamp Trg-Done QS_RX_COMMAND")
+
+# preamble...
+def on_reset():
+    expect_pause()
+    glb_filter(GRP_UA)
+    continue_test()
+
+# tests...
+test("time event armed before the ticks counted down by all of them")
+arm(0, 4)
+tick_n(3)
+tick_n(1, 0)
+
+test("time event armed after the mark not counted down by marked ticks")
+arm(0, 5)
+command(MARK, 3)
+expect("@timestamp Trg-Done QS_RX_COMMAND")
+arm(1, 5)
+tick_n(3)
+tick_n(2, 0)
+tick_n(2)
+tick_n(1, 1)
+
+test("periodic time event posted for every expiration")
+arm(0, 2, 3)
+tick_n(9, 0, 0, 0)
+tick_n(1)
+tick_n(1, 0)
+
+test("long timeouts processed in one batch")
+arm(0, 1000)
+arm(1, 300)
+tick_n(299)
+tick_n(700, 1)
+tick_n(1, 0)
+
+test("long timeout armed after a long mark")
+arm(0, 100)
+command(MARK, 70)
+expect("@timestamp Trg-Done QS_RX_COMMAND")
+arm(1, 50)
+tick_n(70)
+tick_n(30, 0)
+tick_n(19)
+tick_n(1, 1)
+
+test("ticks counted by the ticker beyond the range of the event queue")
+arm(0, 300)
+command(TICKER, 299)
+expect("@timestamp Trg-Done QS_RX_COMMAND")
+command(TICKER, 1)
+expect("@timestamp EXPIRED 0")
+expect("@timestamp Trg-Done QS_RX_COMMAND")
@@ -0,0 +1,109 @@
+/// @file
+/// @brief Fixture for QUTEST self-test
+/// @ingroup qs
+/// @cond
+///***************************************************************************
+/// Last updated for version 6.8.0
+/// Last updated on  2020-03-30
+///
+///                    Q u a n t u m  L e a P s
+///                    ------------------------
+///                    Modern Embedded Software
+///
+/// Copyright (C) 2005-2018 Quantum Leaps, LLC. All rights reserved.
+///
+/// This program is open source software: you can redistribute it and/or
+/// modify it under the terms of the GNU General Public License as published
+/// by the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Alternatively, this program may be distributed and modified under the
+/// terms of Quantum Leaps commercial licenses, which expressly supersede
+/// the GNU General Public License and are specifically designed for
+/// licensees interested in retaining the proprietary status of their code.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program. If not, see <www.gnu.org/licenses>.
+///
+/// Contact information:
+/// <www.state-machine.com/licensing>
+/// <info@state-machine.com>
+///***************************************************************************
+/// @endcond
+
+#include "qpcpp.hpp" // for QUTEST
+#include "qs_pkg.hpp" // for the pre-formatted QS records
+
+using namespace QP;
+
+Q_DEFINE_THIS_FILE
+
+//----------------------------------------------------------------------------
+enum {
+    TICK_STAT,     // command: produce a QS_QF_TICK_STAT record
+    TICK_STAT_BAD  // command: produce a malformed QS_QF_TICK_STAT record
+};
+
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[]) {
+    QF::init();  // initialize the framework
+
+    // initialize the QS software tracing
+    Q_ALLEGE(QS_INIT(argc > 1 ? argv[1] : nullptr));
+
+    // pause execution of the test and wait for the test script to continue
+    QS_TEST_PAUSE();
+
+    return QF::run(); // run the tests
+}
+
+//............................................................................
+void QS::onTestSetup(void) {
+}
+//............................................................................
+void QS::onTestTeardown(void) {
+}
+
+//............................................................................
+//! callback function to execute user commands
+void QS::onCommand(uint8_t cmdId,
+                   uint32_t param1, uint32_t param2, uint32_t param3)
+{
+    (void)param3; // unused parameter
+
+    // the same layout as the tick domain statistics in the POSIX port
+    QS_CRIT_STAT_
+    QS_BEGIN_PRE_(QS_QF_TICK_STAT, nullptr, nullptr)
+        QS_TIME_PRE_();                          // timestamp
+        QS_U8_PRE_(static_cast<uint8_t>(param1)); // tick rate of the domain
+        QS_U32_PRE_(param2);                     // # clock ticks processed
+        QS_U32_PRE_(2U);                         // # ticks a whole period late
+        QS_U32_PRE_(30U);                        // max lateness [us]
+        QS_U32_PRE_(400U);                       // max processing time [ns]
+        QS_U32_PRE_(250U);                       // average [ns]
+        if (cmdId == TICK_STAT_BAD) {
+            QS_U8_PRE_(0U);                      // one byte too many
+        }
+    QS_END_PRE_()
+}
+
+//............................................................................
+// callback function to "massage" the event, if necessary
+void QS::onTestEvt(QEvt *e) {
+    (void)e;
+}
+//............................................................................
+// callback function to output the posted QP events (not used here)
+void QS::onTestPost(void const *sender, QActive *recipient,
+                    QEvt const *e, bool status)
+{
+    (void)sender;
+    (void)recipient;
+    (void)e;
+    (void)status;
+}
@@ -0,0 +1,19 @@
+# test-script for QUTest unit testing harness
+# see https://www.state-machine.com/qtools/html
+
+# preamble...
+def on_reset():
+    expect_pause()
+    glb_filter(GRP_UA) # includes the QS_QF_TICK_STAT record (70)
+    continue_test()
+
+# tests...
+test("QS_QF_TICK_STAT decoded")
+command(0, 1, 100)
+expect("@timestamp Tick<1> Stat Ticks=100,Ovr=2,MaxLate=30,MaxBusy=400,AvgBusy=250")
+expect("@timestamp Trg-Done QS_RX_COMMAND")
+
+test("QS_QF_TICK_STAT named in the errors", NORESET)
+command(1, 0, 5)
+expect("   <COMMS> ERROR    1 bytes unused in Rec=QS_QF_TICK_STAT")
+expect("*Trg-Done QS_RX_COMMAND") # the malformed record took a timestamp
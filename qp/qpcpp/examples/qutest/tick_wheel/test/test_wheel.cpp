@@ -0,0 +1,287 @@
+/// @file
+/// @brief Fixture for QUTEST of the timing wheel against a reference model
+/// @ingroup qs
+/// @cond
+///***************************************************************************
+/// Last updated for version 6.8.2
+/// Last updated on  2020-07-17
+///
+///                    Q u a n t u m  L e a P s
+///                    ------------------------
+///                    Modern Embedded Software
+///
+/// Copyright (C) 2005-2018 Quantum Leaps, LLC. All rights reserved.
+///
+/// This program is open source software: you can redistribute it and/or
+/// modify it under the terms of the GNU General Public License as published
+/// by the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Alternatively, this program may be distributed and modified under the
+/// terms of Quantum Leaps commercial licenses, which expressly supersede
+/// the GNU General Public License and are specifically designed for
+/// licensees interested in retaining the proprietary status of their code.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program. If not, see <www.gnu.org/licenses>.
+///
+/// Contact information:
+/// <www.state-machine.com/licensing>
+/// <info@state-machine.com>
+///***************************************************************************
+/// @endcond
+
+
+#include "qpcpp.hpp" // for QUTEST
+
+using namespace QP;
+
+Q_DEFINE_THIS_FILE
+
+//----------------------------------------------------------------------------
+// The fixture performs random armX()/disarm()/rearm()/currCtr() operations
+// on the time events between the clock ticks QF::TICK_X() and compares all
+// the results and the expirations with a reference model of the time event
+// list that the timing wheel (QF_TIMEEVT_WHEEL) replaces. In the model,
+// every armed time event counts down by 1 in each clock tick and expires
+// when its counter reaches zero (then reloaded with the interval).
+
+enum WheelSignals {
+    TIMEOUT_SIG = Q_USER_SIG // the signal of all the time events
+};
+
+enum {
+    MISMATCH = QS_USER, // the wheel differs from the model
+    RESULT              // the summary of a run
+};
+
+enum {
+    RUN // command: param2 ticks with random operations seeded by param1
+};
+
+enum MismatchKind { // the operation found different from the model
+    DISARM,
+    REARM,
+    CURR_CTR,
+    EXPIRED,
+    ACTIVE
+};
+
+enum {
+    N_TE = 16,       // time events
+    MAX_REPORTED = 8 // the mismatches reported in detail
+};
+
+// Local objects -------------------------------------------------------------
+static QActiveDummy l_dummy; // the recipient of all the time events
+static std::uint8_t const l_ticker = 0U; // the sender of the clock ticks
+
+// the time events of the dummy AO
+struct WheelTimeEvt : public QTimeEvt {
+    WheelTimeEvt() : QTimeEvt(&l_dummy, TIMEOUT_SIG, 0U) {}
+};
+static WheelTimeEvt l_te[N_TE];
+
+// the reference model of every time event
+struct ModelTimeEvt {
+    QTimeEvtCtr ctr;      // 0 when disarmed
+    QTimeEvtCtr interval; // 0 for a one-shot time event
+};
+static ModelTimeEvt l_model[N_TE];
+
+static std::uint32_t l_posted;  // the time events posted in the tick
+static std::uint32_t l_rnd;     // the state of the random generator
+static std::uint32_t l_nErr;    // the mismatches in the run
+
+//............................................................................
+static std::uint32_t random(void) { // xorshift32
+    l_rnd ^= l_rnd << 13;
+    l_rnd ^= l_rnd >> 17;
+    l_rnd ^= l_rnd << 5;
+    return l_rnd;
+}
+//............................................................................
+// a random number of ticks, mostly short to expire often
+static QTimeEvtCtr randomTicks(void) {
+    std::uint32_t const max = ((random() & 3U) != 0U)
+        ? 8U
+        : static_cast<std::uint32_t>(static_cast<QTimeEvtCtr>(~0U));
+    return static_cast<QTimeEvtCtr>(1U + (random() % max));
+}
+//............................................................................
+static void mismatch(std::uint32_t const tick, MismatchKind const kind,
+                     std::uint_fast8_t const te,
+                     std::uint32_t const expected, std::uint32_t const actual)
+{
+    ++l_nErr;
+    if (l_nErr <= MAX_REPORTED) {
+        QS_BEGIN(MISMATCH, nullptr) // app-specific record
+            QS_U32(0, tick);
+            QS_U8(0, kind);
+            QS_U8(0, te);
+            QS_U32(0, expected);
+            QS_U32(0, actual);
+        QS_END()
+    }
+}
+//............................................................................
+// one random operation on a random time event, checked against the model
+static void randomOp(std::uint32_t const tick) {
+    std::uint_fast8_t const k =
+        static_cast<std::uint_fast8_t>(random() % N_TE);
+    QTimeEvt &te = l_te[k];
+    ModelTimeEvt &m = l_model[k];
+
+    switch (random() % 4U) {
+        case 0: { // arm (only a disarmed time event may be armed)
+            if (m.ctr == 0U) {
+                m.ctr = randomTicks();
+                m.interval = ((random() & 1U) != 0U) ? randomTicks() : 0U;
+                te.armX(m.ctr, m.interval);
+            }
+            break;
+        }
+        case 1: {
+            bool const armed = (m.ctr != 0U);
+            m.ctr = 0U;
+            if (te.disarm() != armed) {
+                mismatch(tick, DISARM, k, armed, !armed);
+            }
+            break;
+        }
+        case 2: {
+            bool const armed = (m.ctr != 0U);
+            m.ctr = randomTicks();
+            if (te.rearm(m.ctr) != armed) {
+                mismatch(tick, REARM, k, armed, !armed);
+            }
+            break;
+        }
+        default: {
+            QTimeEvtCtr const ctr = te.currCtr();
+            if (ctr != m.ctr) {
+                mismatch(tick, CURR_CTR, k, m.ctr, ctr);
+            }
+            break;
+        }
+    }
+}
+//............................................................................
+static void run(std::uint32_t const seed, std::uint32_t const nTicks) {
+    std::uint32_t nExpired = 0U;
+    l_rnd = (seed != 0U) ? seed : 1U;
+    l_nErr = 0U;
+
+    for (std::uint32_t tick = 0U; tick < nTicks; ++tick) {
+        for (std::uint32_t n = random() % 4U; n > 0U; --n) {
+            randomOp(tick);
+        }
+
+        // the expirations in this tick according to the model
+        std::uint32_t expected = 0U;
+        bool idle = true;
+        for (std::uint_fast8_t k = 0U; k < N_TE; ++k) {
+            ModelTimeEvt &m = l_model[k];
+            if (m.ctr != 0U) {
+                --m.ctr;
+                if (m.ctr == 0U) {
+                    expected |= (1U << k);
+                    ++nExpired;
+                    m.ctr = m.interval;
+                }
+                if (m.ctr != 0U) {
+                    idle = false;
+                }
+            }
+        }
+
+        l_posted = 0U;
+        QF::TICK_X(0U, &l_ticker);
+        if (l_posted != expected) {
+            mismatch(tick, EXPIRED, 0U, expected, l_posted);
+        }
+        if (QF::noTimeEvtsActiveX(0U) != idle) {
+            mismatch(tick, ACTIVE, 0U, idle, !idle);
+        }
+    }
+
+    QS_BEGIN(RESULT, nullptr) // app-specific record
+        QS_U32(0, nTicks);
+        QS_U32(0, nExpired);
+        QS_U32(0, l_nErr);
+    QS_END()
+}
+
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[]) {
+    QF::init();   // initialize the framework and the underlying RT kernel
+
+    // initialize the QS software tracing
+    Q_ALLEGE(QS_INIT(argc > 1 ? argv[1] : nullptr));
+
+    // object dictionaries...
+    QS_OBJ_DICTIONARY(&l_dummy);
+    QS_OBJ_DICTIONARY(&l_ticker);
+
+    // pause execution of the test and wait for the test script to continue
+    QS_TEST_PAUSE();
+
+    l_dummy.start(1U,            // QP priority of the dummy AO
+                  nullptr, 0U,   // no event queue
+                  nullptr, 0U);  // no stack
+
+    return QF::run(); // run the QF application
+}
+
+//----------------------------------------------------------------------------
+void QS::onTestSetup(void) {
+    QS_SIG_DICTIONARY(TIMEOUT_SIG, nullptr);
+    QS_USR_DICTIONARY(MISMATCH);
+    QS_USR_DICTIONARY(RESULT);
+}
+//............................................................................
+void QS::onTestTeardown(void) {
+    for (std::uint_fast8_t k = 0U; k < N_TE; ++k) {
+        l_te[k].disarm();
+        l_model[k].ctr = 0U;
+    }
+}
+
+//............................................................................
+void QS::onCommand(uint8_t cmdId,
+                   uint32_t param1, uint32_t param2, uint32_t param3)
+{
+    (void)param3; // unused parameter
+    switch (cmdId) {
+        case RUN: {
+            run(param1, param2);
+            break;
+        }
+        default:
+            break;
+    }
+}
+//............................................................................
+//! callback function to "massage" the injected QP events (not used here)
+void QS::onTestEvt(QEvt *e) {
+    (void)e; // unused parameter
+}
+//............................................................................
+// callback function to collect the time events posted in the clock tick
+void QS::onTestPost(void const *sender, QActive *recipient,
+                    QEvt const *e, bool status)
+{
+    (void)sender;
+    (void)recipient;
+    (void)status;
+    for (std::uint_fast8_t k = 0U; k < N_TE; ++k) {
+        if (e == &l_te[k]) {
+            l_posted |= (1U << k);
+        }
+    }
+}
@@ -0,0 +1,27 @@
+# test-script for QUTest unit testing harness
+# see https://www.state-machine.com/qtools/html
+
+# the commands of the fixture
+RUN = 0
+
+# random operations in nTicks clock ticks, all as in the reference model
+def run(seed, nTicks):
+    command(RUN, seed, nTicks)
+    expect("@timestamp RESULT %d * 0" % nTicks)
+    expect("@timestamp Trg-Done QS_RX_COMMAND")
+
+# preamble...
+def on_reset():
+    expect_pause()
+    glb_filter(GRP_UA)
+    continue_test()
+
+# tests...
+test("random operations with short timeouts")
+run(1, 2000)
+
+test("random operations across many counter wrap-arounds")
+run(0x2545F491, 20000)
+
+test("random operations with another seed")
+run(0xDEADBEEF, 20000)
@@ -65,6 +65,17 @@
     #define Q_SIGNAL_SIZE 2U
 #endif
 
+#ifndef Q_MAX_NEST_DEPTH
+    //! The maximum nesting depth of states in QP::QHsm; default 6
+    /// @description
+    /// This macro can be defined in the QEP port file (qep_port.hpp) or on
+    /// the command line to configure the depth of the transition path of
+    /// QP::QHsm, which is allocated on the stack in every dispatch(), unless
+    /// the state machine class declares its own depth with a path buffer
+    /// (see the macro Q_PATH_STATIC and QP::QHsmPath).
+    #define Q_MAX_NEST_DEPTH 6
+#endif
+
 //****************************************************************************
 // Aliases for basic numerical types; MISRA-C++ 2008 rule 3-9-2(req).
 
@@ -192,6 +203,12 @@ namespace QP {
         friend std::uint8_t QF_EVT_REF_CTR_ (QEvt const * const e) noexcept;
         friend void QF_EVT_REF_CTR_INC_(QEvt const * const e) noexcept;
         friend void QF_EVT_REF_CTR_DEC_(QEvt const * const e) noexcept;
+        friend void QF_EVT_REF_CTR_ADD_(QEvt const * const e,
+                                        std::uint_fast8_t const n) noexcept;
+#ifdef QF_ATOMIC_EVT_REF_CTR
+        friend std::uint8_t QF_EVT_REF_CTR_DROP_(QEvt const * const e)
+            noexcept;
+#endif
     };
 
 #else // QEvt is a POD (Plain Old Datatype)
@@ -218,6 +235,12 @@ namespace QP {
 struct QMState;
 struct QMTranActTable;
 class QXThread;
+#ifdef Q_TRAN_CACHE
+class QHsmTranCache;
+#endif // Q_TRAN_CACHE
+#ifdef Q_FLAT_TABLE
+struct QMFlatTbl;
+#endif // Q_FLAT_TABLE
 
 //! Type returned from state-handler functions
 using QState = std::uint_fast8_t;
@@ -244,6 +267,24 @@ union QHsmAttr {
 };
 
 
+#ifdef Q_PATH_STATIC
+//****************************************************************************
+//! Transition path buffer of the depth @p DEPTH_ for one QP::QHsm
+/// @description
+/// A state machine class that needs a different nesting depth of states
+/// than #Q_MAX_NEST_DEPTH (or no path array on the stack at all) declares
+/// a QHsmPath member of the depth it needs and attaches it with
+/// QP::QHsm::setPathBuf() in its constructor. Each state machine owns its
+/// buffer, so the buffer is never used by two transitions at once, under
+/// any kernel and port (see NOTE02 in qep_hsm.cpp).
+template<std::uint_fast8_t DEPTH_>
+struct QHsmPath {
+    static_assert((3U <= DEPTH_) && (DEPTH_ <= 127U),
+                  "the path depth must be in the range 3..127");
+    QStateHandler buf[DEPTH_]; //!< the path of one state machine
+};
+#endif // Q_PATH_STATIC
+
 //****************************************************************************
 //! Hierarchical State Machine base class
 ///
@@ -269,6 +310,13 @@ union QHsmAttr {
 class QHsm {
     QHsmAttr m_state;  //!< current active state (state-variable)
     QHsmAttr m_temp;   //!< temporary: transition chain, target state, etc.
+#ifdef Q_TRAN_CACHE
+    QHsmTranCache *m_tranCache; //!< transition-path cache (nullptr if none)
+#endif // Q_TRAN_CACHE
+#ifdef Q_PATH_STATIC
+    QStateHandler *m_path;        //!< own path buffer (nullptr if none)
+    std::int_fast8_t m_pathDepth; //!< the depth of the m_path buffer
+#endif // Q_PATH_STATIC
 
 public:
     //! virtual destructor
@@ -297,6 +345,45 @@ public:
     //! @note used in the QM code generation
     QStateHandler childState(QStateHandler const parent) noexcept;
 
+#ifdef Q_PATH_STATIC
+    //! Use the transition path buffer @p path, which determines the
+    //! maximum nesting depth of states of this state machine
+    /// @description
+    /// By default, every dispatch() keeps the transition path in an array
+    /// of #Q_MAX_NEST_DEPTH elements on the stack. A state machine class can
+    /// declare its own depth with a QP::QHsmPath member instead, so that
+    /// dispatch() puts no path array on the stack.
+    ///
+    /// @attention
+    /// The buffer must belong to this state machine alone. A buffer shared
+    /// by two state machines would be overrun by preemption, by parallel
+    /// threads, or by an entry or exit action dispatching the other one.
+    ///
+    /// @usage
+    /// @code
+    /// class MySm : public QP::QActive {
+    ///     QP::QHsmPath<10U> m_path10; // up to 10 levels
+    ///     ...
+    /// };
+    /// MySm::MySm() : QActive(Q_STATE_CAST(&MySm::initial)) {
+    ///     setPathBuf(m_path10);
+    /// }
+    /// @endcode
+    template<std::uint_fast8_t N_>
+    void setPathBuf(QHsmPath<N_> &path) noexcept {
+        m_path = &path.buf[0];
+        m_pathDepth = static_cast<std::int_fast8_t>(N_);
+    }
+#endif // Q_PATH_STATIC
+
+#ifdef Q_TRAN_CACHE
+    //! Attach the transition-path cache @p cache to this state machine
+    //! (nullptr detaches the cache)
+    void setTranCache(QHsmTranCache * const cache) noexcept {
+        m_tranCache = cache;
+    }
+#endif // Q_TRAN_CACHE
+
     //! the top-state.
     static QState top(void * const me, QEvt const * const e) noexcept;
 
@@ -453,11 +540,34 @@ protected:
 
 private:
     //!< maximum nesting depth of states in HSM
-    static constexpr std::int_fast8_t MAX_NEST_DEPTH_{6};
+    static constexpr std::int_fast8_t MAX_NEST_DEPTH_{Q_MAX_NEST_DEPTH};
+    static_assert((3 <= MAX_NEST_DEPTH_) && (MAX_NEST_DEPTH_ <= 127),
+                  "Q_MAX_NEST_DEPTH must be in the range 3..127");
+
+#ifdef Q_PATH_STATIC
+    //! internal helper function to dispatch an event with the path array
+    //! on the stack (for the state machines without their own path buffer)
+    void dispatchStk_(QEvt const * const e);
+#endif // Q_PATH_STATIC
+
+    //! internal helper function to dispatch an event with the given
+    //! transition @p path buffer of the dimension @p depth
+    void dispatch_(QEvt const * const e,
+                   QStateHandler * const path,
+                   std::int_fast8_t const depth);
 
     //! internal helper function to take a transition in QP::QHsm
-    std::int_fast8_t hsm_tran(QStateHandler (&path)[MAX_NEST_DEPTH_]);
+    std::int_fast8_t hsm_tran(QStateHandler * const path,
+                              std::int_fast8_t const depth);
+
+#ifdef Q_TRAN_CACHE
+    //! internal helper function to memoize a transition path in QP::QHsm
+    void tranCacheRecord_(QStateHandler const source,
+                          QStateHandler const * const path,
+                          std::int_fast8_t const ip) noexcept;
 
+    friend class QHsmTranCache;
+#endif // Q_TRAN_CACHE
     friend class QMsm;
     friend class QActive;
     friend class QMActive;
@@ -472,6 +582,56 @@ private:
 #endif // Q_UTEST
 };
 
+#ifdef Q_TRAN_CACHE
+
+#ifndef Q_TRAN_CACHE_SIZE
+    //! the number of transition paths in a QP::QHsmTranCache
+    #define Q_TRAN_CACHE_SIZE 16U
+#endif
+
+//****************************************************************************
+//! Cache of the transition paths of QHsm state machines
+/// @description
+/// QHsmTranCache memoizes the exit and entry sequences of the transitions
+/// taken in QP::QHsm state machines, so that the repeated transitions
+/// replay the sequences without discovering the LCA with the empty-signal
+/// probes of the state handlers. A cache is attached to a state machine
+/// with QP::QHsm::setTranCache() and can be shared by all instances of
+/// the same class, as long as they are dispatched in the same thread.
+///
+/// @note
+/// The cache is direct-mapped and keyed by the current state, the source
+/// and the target of a transition. The cache assumes that the superstate of
+/// every state is fixed, which is the case in all QHsm state machines.
+///
+class QHsmTranCache {
+public:
+    //! constructor of an empty cache
+    QHsmTranCache() noexcept;
+
+private:
+    //! cached transition path
+    struct Entry {
+        QStateHandler leaf;    //!< active state when the transition fired
+        QStateHandler source;  //!< source of the transition
+        QStateHandler target;  //!< target of the transition
+        std::uint8_t  nExit;   //!< number of states to exit
+        std::uint8_t  nEnter;  //!< number of states to enter
+        QStateHandler exit[QHsm::MAX_NEST_DEPTH_];  //!< exit sequence
+        QStateHandler enter[QHsm::MAX_NEST_DEPTH_]; //!< entry path (reverse)
+    };
+
+    //! the slot of the cache for the given transition
+    Entry &slot_(QStateHandler const leaf, QStateHandler const source,
+                 QStateHandler const target) noexcept;
+
+    Entry m_entry[Q_TRAN_CACHE_SIZE]; //!< the cached transition paths
+
+    friend class QHsm;
+};
+
+#endif // Q_TRAN_CACHE
+
 //****************************************************************************
 //! QM State Machine implementation strategy
 /// @description
@@ -511,6 +671,12 @@ public:
     //! Obtain the current active child state of a given parent (read only)
     QMState const *childStateObj(QMState const * const parent) const noexcept;
 
+#ifdef Q_FLAT_TABLE
+    //! Attach the flattened dispatch table @p tbl to this state machine
+    //! (nullptr detaches the table)
+    void setFlatTbl(QMFlatTbl const * const tbl) noexcept;
+#endif // Q_FLAT_TABLE
+
 protected:
     //! Protected constructor
     explicit QMsm(QStateHandler const initial) noexcept;
@@ -542,6 +708,16 @@ private:
     //! Internal helper function to enter state history
     QState enterHistory_(QMState const * const hist);
 
+#ifdef Q_FLAT_TABLE
+    //! Internal helper function to look up the first state that handles
+    //! the signal @p sig in the flattened dispatch table
+    QMState const *flatSource_(QMState const * const s,
+                               QSignal const sig) noexcept;
+
+    QMFlatTbl const *m_flatTbl;  //!< flattened dispatch table (or nullptr)
+    std::uint_fast8_t m_flatRow; //!< row of the current state in m_flatTbl
+#endif // Q_FLAT_TABLE
+
     //! maximum depth of implemented entry levels for transitions to history
     static constexpr std::int_fast8_t MAX_ENTRY_DEPTH_ {4};
 
@@ -575,6 +751,152 @@ struct QMTranActTable {
     QActionHandler const act[1];
 };
 
+#ifdef Q_FLAT_TABLE
+
+//! "no state" index in the flattened dispatch tables of QP::QMsm
+enum : std::uint8_t { QM_FLAT_NONE = 0xFFU };
+
+//! Description of a QP::QMsm state for the flattened dispatch table
+/// @description
+/// The descriptions of all states of a QMsm (except the states of
+/// submachines) form a constexpr array, from which QP::QM_flatIdx()
+/// generates the flattened dispatch table at compile time.
+///
+struct QMFlatState {
+    QMState const *state;  //!< the state object
+    std::uint8_t   parent; //!< index of the superstate (or QM_FLAT_NONE)
+    QSignal const *sigs;   //!< signals handled by the state (0-terminated)
+};
+
+//! Flattened dispatch table for the QP::QMsm State Machine.
+/// @description
+/// The table maps every (state, signal) pair to the index of the first
+/// state, from the state up the hierarchy, that handles the signal.
+/// The table is constant and can be placed in ROM.
+///
+/// @usage
+/// @code
+/// static constexpr QP::QSignal s1_sigs[] { A_SIG, B_SIG, 0U };
+/// . . .
+/// static constexpr QP::QMFlatState l_desc[] {
+///     { &QMsmTst::s_s,  QP::QM_FLAT_NONE, s_sigs  }, // index 0
+///     { &QMsmTst::s1_s, 0U,               s1_sigs }, // index 1
+///     . . .
+/// };
+/// static constexpr auto l_idx = QP::QM_flatIdx<MAX_SIG - A_SIG>(l_desc,
+///                                                               A_SIG);
+/// static std::uint8_t l_rows[QP::QM_flatRows(Q_DIM(l_desc))];
+/// static constexpr QP::QMFlatTbl l_flatTbl {
+///     l_desc, l_idx.idx, Q_DIM(l_desc), A_SIG, MAX_SIG - A_SIG,
+///     l_rows, Q_DIM(l_rows)
+/// };
+/// . . .
+/// me->setFlatTbl(&l_flatTbl); // before dispatching any events
+/// @endcode
+///
+struct QMFlatTbl {
+    QMFlatState  const *desc;    //!< the state descriptions
+    std::uint8_t const *idx;     //!< nStates x nSigs handling-state indices
+    std::uint8_t        nStates; //!< number of states described
+    QSignal             sig0;    //!< the first signal in the table
+    QSignal             nSigs;   //!< number of signals in the table
+    std::uint8_t       *rows;    //!< hash of the state objects to the rows
+    std::uint16_t       nRows;   //!< size of rows[] (see QP::QM_flatRows())
+};
+
+//! size of the hash of the rows in a QP::QMFlatTbl for @p nStates states
+/// (the smallest power of 2 at least twice @p nStates)
+constexpr std::uint16_t QM_flatRows(std::uint_fast16_t const nStates,
+                                    std::uint_fast16_t const n = 1U)
+{
+    return (n >= (2U * nStates))
+           ? static_cast<std::uint16_t>(n)
+           : QM_flatRows(nStates, 2U * n);
+}
+
+//! index array of a flattened dispatch table (see QP::QM_flatIdx())
+template<std::uint_fast16_t NSTATE_, std::uint_fast16_t NSIG_>
+struct QMFlatIdx {
+    std::uint8_t idx[NSTATE_ * NSIG_]; //!< handling-state indices
+};
+
+//! compile-time sequence of indices (C++11 replacement of index_sequence)
+template<std::uint_fast16_t... I_>
+struct QMIdxSeq_ {
+    using type = QMIdxSeq_;
+};
+
+//! concatenation of two compile-time sequences of indices
+template<class A_, class B_>
+struct QMIdxCat_;
+
+template<std::uint_fast16_t... I_, std::uint_fast16_t... J_>
+struct QMIdxCat_<QMIdxSeq_<I_...>, QMIdxSeq_<J_...>>
+    : QMIdxSeq_<I_..., (sizeof...(I_) + J_)...>
+{};
+
+//! compile-time sequence of indices 0..N_-1 (of logarithmic depth)
+template<std::uint_fast16_t N_>
+struct QMMakeIdx_
+    : QMIdxCat_<typename QMMakeIdx_<N_ / 2U>::type,
+                typename QMMakeIdx_<N_ - (N_ / 2U)>::type>
+{};
+
+template<>
+struct QMMakeIdx_<0U> : QMIdxSeq_<> {};
+
+template<>
+struct QMMakeIdx_<1U> : QMIdxSeq_<0U> {};
+
+//! does the 0-terminated signal list @p sigs contain @p sig?
+constexpr bool QM_flatHas_(QSignal const * const sigs, QSignal const sig) {
+    return (*sigs == 0U)
+           ? false
+           : ((*sigs == sig) ? true : QM_flatHas_(sigs + 1, sig));
+}
+
+//! index of the first state from @p s up that handles the signal @p sig
+constexpr std::uint8_t QM_flatFind_(QMFlatState const * const desc,
+                                    std::uint8_t const s,
+                                    QSignal const sig)
+{
+    return (s == QM_FLAT_NONE)
+           ? static_cast<std::uint8_t>(QM_FLAT_NONE)
+           : (QM_flatHas_(desc[s].sigs, sig)
+              ? s
+              : QM_flatFind_(desc, desc[s].parent, sig));
+}
+
+//! generate the index array for the signals sig0..sig0+NSIG_-1
+template<std::uint_fast16_t NSIG_, std::uint_fast16_t NSTATE_,
+         std::uint_fast16_t... I_>
+constexpr QMFlatIdx<NSTATE_, NSIG_> QM_flatIdx_(
+    QMFlatState const (&desc)[NSTATE_], QSignal const sig0,
+    QMIdxSeq_<I_...>)
+{
+    return QMFlatIdx<NSTATE_, NSIG_>{{
+        QM_flatFind_(desc, static_cast<std::uint8_t>(I_ / NSIG_),
+                     static_cast<QSignal>(sig0 + (I_ % NSIG_)))...
+    }};
+}
+
+//! Generate the flattened dispatch table of a QMsm at compile time
+/// @description
+/// Generates the (states x signals) array of the indices of the states
+/// that handle the signals sig0..sig0+NSIG_-1 from the descriptions
+/// @p desc of all states. The array is used in a QP::QMFlatTbl.
+///
+template<std::uint_fast16_t NSIG_, std::uint_fast16_t NSTATE_>
+constexpr QMFlatIdx<NSTATE_, NSIG_> QM_flatIdx(
+    QMFlatState const (&desc)[NSTATE_], QSignal const sig0)
+{
+    static_assert(NSTATE_ < QM_FLAT_NONE, "too many states");
+    return QM_flatIdx_<NSIG_>(desc, sig0,
+                              typename QMMakeIdx_<NSTATE_ * NSIG_>::type());
+}
+
+#endif // Q_FLAT_TABLE
+
 
 //****************************************************************************
 //! Provides miscellaneous QEP services.
@@ -589,6 +911,171 @@ public:
 //! Offset or the user signals
 constexpr enum_t Q_USER_SIG {4};
 
+#ifdef Q_MAP_HSM
+
+//! number of the user signals (from Q_USER_SIG) in the QP::QMapState bitmaps
+constexpr QSignal Q_MAP_BITS {64U};
+
+#ifndef Q_MAP_INLINE
+    //! inline specifier of QP::QMapHsm::handle_(), see NOTE03 in qep_hsm.cpp
+    #ifdef __GNUC__
+        #define Q_MAP_INLINE inline __attribute__((always_inline))
+    #else
+        #define Q_MAP_INLINE inline
+    #endif
+#endif
+
+//! Entry of the signal map of a QP::QMapState
+struct QMapSig {
+    QSignal       sig;     //!< the signal (including entry/exit/init)
+    QStateHandler handler; //!< the handler of the signal in the state
+};
+
+//! State object for the QP::QMapHsm class (signal-mapped state machine).
+/// @description
+/// Instead of a switch statement, every state of a QMapHsm has a constant
+/// map of the signals it handles, sorted by signal, and a bitmap of the
+/// user signals in the map. The state objects are generated at compile time
+/// with the macros Q_MAP_STATE() and Q_MAP_TOP_STATE() and can be placed
+/// in ROM.
+///
+struct QMapState {
+    QMapState const *superstate;   //!< superstate (nullptr for QHsm::top)
+    QStateHandler    superHandler; //!< state handler of the superstate
+    QMapSig const   *sigs;         //!< the signal map (sorted by signal)
+    std::uint8_t     nSigs;        //!< number of signals in the map
+    std::uint32_t    bits[Q_MAP_BITS / 32U]; //!< bitmap of the user signals
+};
+
+//! is the signal map @p sigs of @p n entries sorted by the signal?
+constexpr bool QMap_sorted_(QMapSig const * const sigs,
+                            std::uint_fast8_t const n)
+{
+    return (n < 2U)
+           ? true
+           : ((sigs[0].sig < sigs[1].sig) && QMap_sorted_(sigs + 1, n - 1U));
+}
+
+//! the @p word of the bitmap of the user signals in the signal map @p sigs
+constexpr std::uint32_t QMap_bits_(QMapSig const * const sigs,
+                                   std::uint_fast8_t const n,
+                                   std::uint_fast8_t const word)
+{
+    return (n == 0U)
+        ? 0U
+        : ((((sigs->sig >= static_cast<QSignal>(Q_USER_SIG))
+             && (((sigs->sig - Q_USER_SIG) >> 5U) == word))
+            ? (static_cast<std::uint32_t>(1U)
+               << ((sigs->sig - Q_USER_SIG) & 0x1FU))
+            : 0U)
+           | QMap_bits_(sigs + 1, n - 1U, word));
+}
+
+//****************************************************************************
+//! Signal-mapped Hierarchical State Machine
+/// @description
+/// QMapHsm is a QP::QHsm, whose states are described by the constant
+/// QP::QMapState objects rather than coded as switch statements. The state
+/// handler of the state object @c s_ is QMapHsm::state<s_>, which can be
+/// used in tran(), tran_hist(), isIn() and as a superstate, exactly like
+/// any other state handler. The signal handlers in the maps return with
+/// the usual Q_HANDLED(), Q_UNHANDLED() and Q_TRAN() conventions.
+///
+/// When a state does not handle a user signal, its state handler consults
+/// the bitmaps of the superstates and returns directly the first superstate
+/// that handles the signal, so that QHsm::dispatch() skips the levels in
+/// between without calling their state handlers (see NOTE03 in
+/// qep_hsm.cpp).
+///
+/// @usage
+/// @code
+/// static constexpr QP::QMapSig s_map[] {
+///     { QP::QMapHsm::Q_ENTRY_SIG, &MyHsm::s_entry },
+///     { E_SIG,                    &MyHsm::s_E     } // sorted by signal
+/// };
+/// Q_MAP_TOP_STATE(s, s_map);
+/// static constexpr QP::QMapSig s1_map[] {
+///     { A_SIG,                    &MyHsm::s1_A    }
+/// };
+/// Q_MAP_STATE(s1, s, s1_map);
+/// . . .
+/// QP::QState MyHsm::s1_A(void * const me, QP::QEvt const * const e) {
+///     return static_cast<MyHsm *>(me)->tran(&QP::QMapHsm::state<s>);
+/// }
+/// @endcode
+///
+class QMapHsm : public QHsm {
+public:
+    // the reserved signals for the signal maps of the states
+    using QHsm::Q_ENTRY_SIG;
+    using QHsm::Q_EXIT_SIG;
+    using QHsm::Q_INIT_SIG;
+
+    //! the state handler of the state object @p S_
+    template<QMapState const &S_>
+    static QState state(void * const me, QEvt const * const e) {
+        return static_cast<QMapHsm *>(me)->handle_(S_, e);
+    }
+
+protected:
+    //! protected constructor of QMapHsm
+    explicit QMapHsm(QStateHandler const initial) noexcept
+      : QHsm(initial)
+    {}
+
+private:
+    //! Internal helper function to handle the event @p e in the state @p s
+    QState handle_(QMapState const &s, QEvt const * const e);
+
+    //! Internal helper function to test whether the state @p s can handle
+    //! the user signal @p sig
+    static bool has_(QMapState const &s, QSignal const sig) noexcept {
+        QSignal const i = static_cast<QSignal>(sig - Q_USER_SIG);
+        return (i < Q_MAP_BITS)
+               ? ((s.bits[i >> 5U]
+                   & (static_cast<std::uint32_t>(1U) << (i & 0x1FU))) != 0U)
+               : true; // not in the bitmap, must search the map
+    }
+};
+
+//............................................................................
+Q_MAP_INLINE QState QMapHsm::handle_(QMapState const &s,
+                                     QEvt const * const e)
+{
+    QSignal const sig = e->sig;
+
+    if ((sig < static_cast<QSignal>(Q_USER_SIG)) || has_(s, sig)) {
+        // binary search of the signal map...
+        std::uint_fast8_t lo = 0U;
+        std::uint_fast8_t hi = s.nSigs;
+        while (lo < hi) {
+            std::uint_fast8_t const mid = (lo + hi) >> 1U;
+            if (s.sigs[mid].sig < sig) {
+                lo = mid + 1U;
+            }
+            else {
+                hi = mid;
+            }
+        }
+        if ((lo < s.nSigs) && (s.sigs[lo].sig == sig)) {
+            return (*s.sigs[lo].handler)(this, e);
+        }
+
+        // reserved signals (including the empty signal) report the
+        // immediate superstate (see NOTE03 in qep_hsm.cpp)
+        return super(s.superHandler);
+    }
+
+    // skip the superstates that don't handle the signal...
+    QMapState const *c = &s;
+    while ((c->superstate != nullptr) && (!has_(*c->superstate, sig))) {
+        c = c->superstate;
+    }
+    return super(c->superHandler);
+}
+
+#endif // Q_MAP_HSM
+
 } // namespace QP
 
 //****************************************************************************
@@ -633,6 +1120,30 @@ constexpr enum_t Q_USER_SIG {4};
 //! in the transition-action-tables
 #define Q_ACTION_NULL         (nullptr)
 
+#ifdef Q_MAP_HSM
+
+//! Macro to generate the state object @p state_ of a QP::QMapHsm with
+//! the superstate object @p super_ and the signal map @p map_
+#define Q_MAP_STATE(state_, super_, map_) \
+    static_assert(QP::QMap_sorted_((map_), Q_DIM(map_)), \
+                  "signal map not sorted"); \
+    constexpr QP::QMapState state_ { &(super_), \
+        &QP::QMapHsm::state<super_>, (map_), Q_DIM(map_), { \
+        QP::QMap_bits_((map_), Q_DIM(map_), 0U), \
+        QP::QMap_bits_((map_), Q_DIM(map_), 1U) } }
+
+//! Macro to generate the state object @p state_ of a QP::QMapHsm nested
+//! directly in QHsm::top with the signal map @p map_
+#define Q_MAP_TOP_STATE(state_, map_) \
+    static_assert(QP::QMap_sorted_((map_), Q_DIM(map_)), \
+                  "signal map not sorted"); \
+    constexpr QP::QMapState state_ { nullptr, \
+        &QP::QHsm::top, (map_), Q_DIM(map_), { \
+        QP::QMap_bits_((map_), Q_DIM(map_), 0U), \
+        QP::QMap_bits_((map_), Q_DIM(map_), 1U) } }
+
+#endif // Q_MAP_HSM
+
 
 //****************************************************************************
 // Macros for coding QMsm-style state machines...
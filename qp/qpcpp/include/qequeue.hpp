@@ -60,6 +60,12 @@
     #define QF_EQUEUE_CTR_SIZE 1U
 #endif
 
+#ifdef QF_EQUEUE_LANES
+    #if (QF_EQUEUE_LANES < 2U) || (QF_EQUEUE_LANES > 8U)
+        #error "QF_EQUEUE_LANES defined incorrectly, expected 2U..8U"
+    #endif
+#endif // QF_EQUEUE_LANES
+
 
 namespace QP {
 
@@ -264,11 +270,93 @@ private:
     friend class QActive;
     friend class QXThread;
     friend class QTicker;
+#ifdef QF_EQUEUE_LANES
+    friend class QELanes;
+#endif // QF_EQUEUE_LANES
 #ifdef Q_UTEST
     friend class QS;
 #endif // Q_UTEST
 };
 
+#ifdef QF_EQUEUE_LANES
+
+//****************************************************************************
+//! Priority lanes of the event queue of an active object
+/// @description
+/// QELanes extends the event queue of an active object (see
+/// QP::QActive::setLanes()) with the lanes 1..#QF_EQUEUE_LANES-1 of higher
+/// priority than the lane 0, which is the regular event queue of the active
+/// object. Every lane is a FIFO QP::QEQueue with its own storage and its own
+/// low-watermark (QP::QELanes::getLaneMin()). The events are placed into the
+/// lanes by their signals (QP::QELanes::setLaneMap()) and are taken from
+/// the highest non-empty lane first.
+///
+/// @usage
+/// @code
+/// static std::uint8_t const l_laneOf[MAX_SIG] { . . . }; // lane of signal
+/// static QP::QEvt const *l_ctrlSto[8];
+/// static QP::QELanes l_lanes;
+/// . . .
+/// l_lanes.initLane(1U, l_ctrlSto, Q_DIM(l_ctrlSto));
+/// l_lanes.setLaneMap(l_laneOf, MAX_SIG);
+/// AO_Gateway->setLanes(&l_lanes); // before starting the AO
+/// AO_Gateway->start(. . .);
+/// @endcode
+///
+class QELanes {
+public:
+    //! public default constructor (no lanes initialized, all signals in
+    //! the lane 0)
+    QELanes(void) noexcept;
+
+    //! Initializes the lane @p lane (1..#QF_EQUEUE_LANES-1) with the ring
+    //! buffer @p qSto[] of @p qLen entries (capacity qLen + 1)
+    void initLane(std::uint_fast8_t const lane,
+                  QEvt const *qSto[], std::uint_fast16_t const qLen) noexcept;
+
+    //! Sets the lanes @p laneOf[] of the signals 0..@p nSigs-1 (the signals
+    //! from @p nSigs up are placed in the lane 0)
+    void setLaneMap(std::uint8_t const * const laneOf,
+                    QSignal const nSigs) noexcept;
+
+    //! the lane of the signal @p sig
+    std::uint_fast8_t laneOf(QSignal const sig) const noexcept {
+        return (sig < m_nSigs)
+               ? static_cast<std::uint_fast8_t>(m_laneOf[sig])
+               : 0U;
+    }
+
+    //! the minimum number of free entries ever in the lane @p lane
+    //! (1..#QF_EQUEUE_LANES-1)
+    QEQueueCtr getLaneMin(std::uint_fast8_t const lane) const noexcept {
+        return m_lane[lane - 1U].getNMin();
+    }
+
+private:
+    //! disallow copying of QELanes
+    QELanes(QELanes const &) = delete;
+
+    //! disallow assignment of QELanes
+    QELanes & operator=(QELanes const &) = delete;
+
+    //! the lanes 1..#QF_EQUEUE_LANES-1
+    QEQueue m_lane[QF_EQUEUE_LANES - 1U];
+
+    //! the lanes of the signals 0..m_nSigs-1
+    std::uint8_t const *m_laneOf;
+
+    //! number of signals in m_laneOf[]
+    QSignal m_nSigs;
+
+    //! bitmask of the non-empty lanes (bit n-1 for the lane n)
+    std::uint8_t m_ready;
+
+    friend class QF;
+    friend class QActive;
+};
+
+#endif // QF_EQUEUE_LANES
+
 } // namespace QP
 
 #endif // QEQUEUE_HPP
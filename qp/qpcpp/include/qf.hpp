@@ -75,6 +75,28 @@
     #define QF_TIMEEVT_CTR_SIZE  2U
 #endif
 
+#ifdef QF_TIMEEVT_WHEEL
+#ifndef QF_TIMEEVT_WHEEL_BITS
+    //! macro to override the number of slots (as log-base-2) in every
+    //! level of the hierarchical timing wheel (see #QF_TIMEEVT_WHEEL).
+    //! Valid values [2U..8U]; default 6U (64 slots per level)
+    #define QF_TIMEEVT_WHEEL_BITS 6U
+#elif (QF_TIMEEVT_WHEEL_BITS < 2U) || (8U < QF_TIMEEVT_WHEEL_BITS)
+    #error "QF_TIMEEVT_WHEEL_BITS defined incorrectly, expected [2U..8U]"
+#endif
+#endif // QF_TIMEEVT_WHEEL
+
+#ifdef QF_EVT_BURST
+    #if (QF_EVT_BURST < 2U) || (QF_EVT_BURST > 255U)
+        #error "QF_EVT_BURST defined incorrectly, expected 2U..255U"
+    #endif
+#endif // QF_EVT_BURST
+
+#ifdef QF_EVT_COALESCE
+    #if (QF_EVT_COALESCE < 8U) || (QF_EVT_COALESCE > 1024U)
+        #error "QF_EVT_COALESCE defined incorrectly, expected 8U..1024U"
+    #endif
+#endif // QF_EVT_COALESCE
 
 //****************************************************************************
 namespace QP {
@@ -114,6 +136,13 @@ namespace QP {
 #endif
 
 class QEQueue; // forward declaration
+#ifdef QF_EQUEUE_LANES
+class QELanes; // forward declaration
+#endif
+
+//! Pointer to a predicate selecting the deferred events to recall by their
+//! signals (see QP::QActive::recallIf())
+using QRecallPred = bool (*)(QSignal const sig);
 
 //****************************************************************************
 //! QActive active object (based on QP::QHsm implementation)
@@ -179,6 +208,29 @@ public: // for access from extern "C" functions
     //! QF priority (1..#QF_MAX_ACTIVE) of this active object.
     std::uint8_t m_prio;
 
+#ifdef QF_EVT_BURST
+    //! maximum number of events (1..#QF_EVT_BURST) removed from the queue
+    //! and dispatched in one burst; 1 by default (see QActive::setBurst())
+    std::uint8_t m_burst;
+#endif
+
+#ifdef QF_EQUEUE_LANES
+    //! priority lanes of the event queue (nullptr if not used)
+    QELanes *m_lanes;
+#endif
+
+#ifdef QF_EVT_COALESCE
+    //! bitmask of the signals (0..#QF_EVT_COALESCE-1), whose static events
+    //! are coalesced on posting (see QP::QActive::setCoalesce())
+    std::uint8_t m_coalesce[(QF_EVT_COALESCE + 7U) / 8U];
+
+    //! bitmask of the signals, whose static events are pending in the queue
+    std::uint8_t m_pending[(QF_EVT_COALESCE + 7U) / 8U];
+
+    //! number of posts merged with the pending events (wraps around)
+    std::uint16_t m_nMerged;
+#endif
+
 #ifdef QXK_HPP // QXK kernel used?
     //! QF start priority (1..#QF_MAX_ACTIVE) of this active object.
     std::uint8_t m_startPrio;
@@ -247,6 +299,24 @@ public:
     //! Flush the specified deferred queue 'eq'.
     std::uint_fast16_t flushDeferred(QEQueue * const eq) const noexcept;
 
+#ifndef QF_LOCKFREE_EQUEUE
+    //! Recall up to @p n oldest deferred events from a given event queue
+    //! at once (in their original order).
+    std::uint_fast16_t recallN(QEQueue * const eq,
+                               std::uint_fast16_t const n) noexcept;
+
+    //! Recall all deferred events from a given event queue at once
+    //! (in their original order).
+    std::uint_fast16_t recallAll(QEQueue * const eq) noexcept {
+        return recallN(eq, ~static_cast<std::uint_fast16_t>(0U));
+    }
+
+    //! Recall all deferred events selected by the predicate @p pred from
+    //! a given event queue at once (in their original order).
+    std::uint_fast16_t recallIf(QEQueue * const eq,
+                                QRecallPred const pred) noexcept;
+#endif // QF_LOCKFREE_EQUEUE
+
     //! Get the priority of the active object.
     std::uint_fast8_t getPrio(void) const noexcept {
         return static_cast<std::uint_fast8_t>(m_prio);
@@ -275,6 +345,33 @@ public:
     //! Get an event from the event queue of an active object.
     QEvt const *get_(void) noexcept;
 
+#ifdef QF_EQUEUE_LANES
+    //! Attach the priority lanes @p lanes to the event queue of the active
+    //! object (before starting the active object)
+    void setLanes(QELanes * const lanes) noexcept {
+        m_lanes = lanes;
+    }
+#endif // QF_EQUEUE_LANES
+
+#ifdef QF_EVT_BURST
+    //! Set the maximum number of events dispatched in one burst
+    void setBurst(std::uint_fast8_t const burst) noexcept;
+
+    //! Get a burst of events from the event queue of an active object.
+    std::uint_fast8_t getBurst_(QEvt const ** const evts) noexcept;
+#endif // QF_EVT_BURST
+
+#ifdef QF_EVT_COALESCE
+    //! Enable or disable coalescing of the static events with signal @p sig
+    //! posted to the active object
+    void setCoalesce(enum_t const sig, bool const enable) noexcept;
+
+    //! Get the number of posts merged with the pending events (wraps around)
+    std::uint_fast16_t getMerged(void) const noexcept {
+        return static_cast<std::uint_fast16_t>(m_nMerged);
+    }
+#endif // QF_EVT_COALESCE
+
 // duplicated API to be used exclusively inside ISRs (useful in some QP ports)
 #ifdef QF_ISR_API
 #ifdef Q_SPY
@@ -287,6 +384,41 @@ public:
 #endif // Q_SPY
 #endif // QF_ISR_API
 
+private:
+    //! Internal helper function to remove the front event from the event
+    //! queue of an active object (inside the critical section)
+    QEvt const *getNoCrit_(void) noexcept;
+
+    //! Internal helper function to post an event to the front of the event
+    //! queue of an active object (inside the critical section)
+    bool postLIFONoCrit_(QEvt const * const e) noexcept;
+
+    //! Internal helper function to recall many deferred events at once
+    std::uint_fast16_t recall_(QEQueue * const eq,
+                               std::uint_fast16_t const n,
+                               QRecallPred const pred) noexcept;
+
+#ifdef QF_EQUEUE_LANES
+    //! Internal helper function to find the queue (lane) accounting for
+    //! a posted event with the signal @p sig
+    QEQueue &laneQueue_(QSignal const sig) noexcept;
+
+    //! Internal helper function to insert the event @p e into the lane
+    //! @p eq (other than the lane 0) of the non-empty event queue
+    void laneInsert_(QEQueue &eq, QEvt const * const e,
+                     bool const lifo) noexcept;
+#endif // QF_EQUEUE_LANES
+
+#ifdef QF_EVT_COALESCE
+    //! Internal helper function to merge the post of the event @p e with
+    //! an identical event already pending in the event queue
+    bool merge_(QEvt const * const e) noexcept;
+
+    //! Internal helper function to update the pending signals when the
+    //! event @p e enters (@p pending == true) or leaves the event queue
+    void pend_(QEvt const * const e, bool const pending) noexcept;
+#endif // QF_EVT_COALESCE
+
 // friendships...
 private:
     friend class QF;
@@ -421,6 +553,22 @@ private:
     /// keeps timing out periodically.
     QTimeEvtCtr m_interval;
 
+#ifdef QF_TIMEEVT_WHEEL
+    //! the link pointing to this time event in the timing wheel
+    /// @description
+    /// This is either the head of a wheel slot or the m_next attribute of
+    /// the previous time event in the slot, which allows unlinking the time
+    /// event in constant time.
+    QTimeEvt * volatile *m_pprev;
+
+    //! the tick number (at the associated tick rate) of the expiration
+    /// @description
+    /// In the timing wheel configuration the m_ctr down-counter is not
+    /// decremented in every tick. Instead, the time event expires when
+    /// the tick counter of the wheel reaches m_due.
+    QTimeEvtCtr m_due;
+#endif // QF_TIMEEVT_WHEEL
+
 public:
 
     //! The Time Event constructor.
@@ -463,6 +611,16 @@ private:
         return static_cast<QTimeEvt *>(m_act);
     }
 
+#ifdef QF_TIMEEVT_WHEEL
+    //! link the time event into the timing wheel to expire in @p nTicks
+    //! (must be called inside a critical section)
+    void wheelLink_(QTimeEvtCtr const nTicks) noexcept;
+
+    //! unlink the time event from the timing wheel
+    //! (must be called inside a critical section)
+    void wheelUnlink_(void) noexcept;
+#endif // QF_TIMEEVT_WHEEL
+
     friend class QF;
     friend class QS;
 #ifdef QXK_HPP
@@ -536,10 +694,31 @@ public:
                        void const * const sender) noexcept;
 #endif // Q_SPY
 
+#if (defined QF_ATOMIC_TICKER) || (defined QF_TICKLESS)
+#ifndef Q_SPY
+    static void tickN_(std::uint_fast8_t const tickRate,
+                       QTimeEvtCtr const nTicks) noexcept;
+#else
+    //! Processes all armed time events for @p nTicks clock ticks at once.
+    static void tickN_(std::uint_fast8_t const tickRate,
+                       QTimeEvtCtr const nTicks,
+                       void const * const sender) noexcept;
+#endif // Q_SPY
+
+    //! Marks the clock ticks to be processed by the next QP::QF::tickN_()
+    static void tickMark_(std::uint_fast8_t const tickRate,
+                          QTimeEvtCtr const nTicks) noexcept;
+#endif // (defined QF_ATOMIC_TICKER) || (defined QF_TICKLESS)
+
     //! Returns true if all time events are inactive and false
     //! any time event is active.
     static bool noTimeEvtsActiveX(std::uint_fast8_t const tickRate) noexcept;
 
+    //! Returns the number of clock ticks until the nearest expiration of
+    //! any time event at the given tick rate (0 if none is armed).
+    static QTimeEvtCtr nextTimeoutX(std::uint_fast8_t const tickRate)
+        noexcept;
+
     //! This function returns the minimum of free entries of the given
     //! event pool.
     static std::uint_fast16_t getPoolMin(std::uint_fast8_t const poolId)
@@ -606,6 +785,25 @@ private:
     //! heads of linked lists of time events, one for every clock tick rate
     static QTimeEvt timeEvtHead_[QF_MAX_TICK_RATE];
 
+#ifdef QF_TIMEEVT_WHEEL
+#ifdef Q_SPY
+    //! Process the current slots of the timing wheel at the tick @p now
+    static void wheelTick_(std::uint_fast8_t const tickRate,
+                           QTimeEvtCtr const now,
+                           void const * const sender) noexcept;
+#else
+    static void wheelTick_(std::uint_fast8_t const tickRate,
+                           QTimeEvtCtr const now) noexcept;
+#endif // Q_SPY
+#endif // QF_TIMEEVT_WHEEL
+
+#ifdef QF_PUBLISH_BATCH
+    //! Post an event to all subscribers in a single critical section
+    static void publishBatch_(QEvt const * const e,
+                              QSubscrList const subscrList,
+                              void const * const sender) noexcept;
+#endif // QF_PUBLISH_BATCH
+
     friend class QActive;
     friend class QTimeEvt;
     friend class QS;
@@ -629,6 +827,12 @@ std::uint_fast16_t const QF_NO_MARGIN = 0xFFFFU;
 /// level and move it into the thread-level, where you can prioritize it
 /// as low as you wish.
 ///
+/// @note
+/// With #QF_ATOMIC_TICKER, the ticks posted to QP::QTicker are only
+/// counted atomically (no critical section after the first tick) and
+/// all ticks accumulated until the ticker runs are processed in a single
+/// pass over the time events (QP::QF::tickN_()).
+///
 class QTicker : public QActive {
 public:
     explicit QTicker(std::uint_fast8_t const tickRate) noexcept; // ctor
@@ -644,6 +848,12 @@ public:
                void const * const sender) noexcept override;
 #endif
     void postLIFO(QEvt const * const e) noexcept override;
+
+#ifdef QF_ATOMIC_TICKER
+private:
+    //! the number of ticks posted, but not processed yet
+    QTimeEvtCtr volatile m_nTicks;
+#endif // QF_ATOMIC_TICKER
 };
 
 } // namespace QP
@@ -803,6 +1013,12 @@ public:
     /// @sa QP::QF::tickX_()
     #define TICK_X(tickRate_, sender_) tickX_((tickRate_), (sender_))
 
+    //! Invoke the clock tick processing QP::QF::tickN_() for @p nTicks_
+    //! clock ticks at once
+    /// @sa TICK_X(), QP::QF::tickN_()
+    #define TICK_N(tickRate_, nTicks_, sender_) \
+        tickN_((tickRate_), (nTicks_), (sender_))
+
     //! Invoke the event publishing facility QP::QF::publish_(). This macro
     /// @description
     /// This macro is the recommended way of publishing events, because it
@@ -889,6 +1105,8 @@ public:
     #define POST(e_, dummy_)            post_((e_), QP::QF_NO_MARGIN)
     #define POST_X(e_, margin_, dummy_) post_((e_), (margin_))
     #define TICK_X(tickRate_, dummy_)   tickX_((tickRate_))
+    #define TICK_N(tickRate_, nTicks_, dummy_) \
+        tickN_((tickRate_), (nTicks_))
 
 #endif // Q_SPY
 
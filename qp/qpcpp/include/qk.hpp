@@ -201,6 +201,7 @@ public:
     } while (false)
 
     // QK-specific native event queue operations...
+    #define QF_NATIVE_EQUEUE_ // AO queues fully managed by QF
     #define QACTIVE_EQUEUE_WAIT_(me_) \
         Q_ASSERT_ID(110, (me_)->m_eQueue.m_frontEvt != nullptr)
 
@@ -51,6 +51,12 @@
     #define QF_MPOOL_CTR_SIZE 2
 #endif
 
+#ifdef QF_EPOOL_MAGAZINE
+    #if (QF_EPOOL_MAGAZINE < 2U) || (QF_EPOOL_MAGAZINE > 255U)
+        #error "QF_EPOOL_MAGAZINE defined incorrectly, expected 2U..255U"
+    #endif
+#endif
+
 namespace QP {
 #if (QF_MPOOL_SIZ_SIZE == 1U)
     using QMPoolSize = std::uint8_t;
@@ -132,6 +138,12 @@ private:
     /// @sa QP::QF::getPoolMin().
     QMPoolCtr m_nMin;
 
+#ifdef QF_EPOOL_MAGAZINE
+    //! number of blocks not held by the application, that is, the blocks
+    //! in the free list plus the blocks cached in the per-thread magazines
+    QMPoolCtr volatile m_nAvail;
+#endif
+
 public:
     QMPool(void); //!< public default constructor
 
@@ -156,6 +168,23 @@ public:
     void putFromISR(void * const b) noexcept;
 #endif // QF_ISR_API
 
+// API for the per-thread magazines of event pools (see QF::newX_())
+#ifdef QF_EPOOL_MAGAZINE
+    //! Reserves one block for the application, honoring the @p margin
+    bool reserve(std::uint_fast16_t const margin) noexcept;
+
+    //! Releases one block reserved with QP::QMPool::reserve()
+    void release(void) noexcept;
+
+    //! Moves up to @p n free blocks to @p blocks[] in one critical section
+    std::uint_fast16_t getN(void ** const blocks,
+                            std::uint_fast16_t const n) noexcept;
+
+    //! Returns @p n blocks from @p blocks[] in one critical section
+    void putN(void * const * const blocks,
+              std::uint_fast16_t const n) noexcept;
+#endif // QF_EPOOL_MAGAZINE
+
 private:
     //! disallow copying of QMPools
     QMPool(QMPool const &) = delete;
@@ -91,7 +91,8 @@ enum QSpyRecords : std::uint8_t {
     QS_QF_EQUEUE_GET,     //!< get an event and queue still not empty
     QS_QF_EQUEUE_GET_LAST,//!< get the last event from the queue
 
-    QS_QF_RESERVED2,
+    // [23] Additional Active Object (AO) records
+    QS_QF_ACTIVE_POST_MERGE, //!< an AO merged a post with a pending event
 
     // [24] Memory Pool (MP) records
     QS_QF_MPOOL_GET,      //!< a memory block was removed from memory pool
@@ -159,8 +160,10 @@ enum QSpyRecords : std::uint8_t {
     QS_PEEK_DATA,         //!< reports the data from the PEEK query
     QS_ASSERT_FAIL,       //!< assertion failed in the code
 
-    // [70] Reserved QS records
-    QS_RESERVED_70,
+    // [70] Additional QF records
+    QS_QF_TICK_STAT,      //!< processing statistics of a tick domain
+
+    // [71] Reserved QS records
     QS_RESERVED_71,
     QS_RESERVED_72,
     QS_RESERVED_73,
@@ -237,16 +240,30 @@ enum QSpyUserRecords : std::uint8_t {
 #endif
 
 #if (QS_TIME_SIZE == 1U)
-    #define QS_TIME_PRE_() (QP::QS::u8_raw_(QP::QS::onGetTime()))
+    #define QS_TIME_PRE_() (QP::QS::u8_raw_(QS_REC_TIME_()))
 #elif (QS_TIME_SIZE == 2U)
-    #define QS_TIME_PRE_() (QP::QS::u16_raw_(QP::QS::onGetTime()))
+    #define QS_TIME_PRE_() (QP::QS::u16_raw_(QS_REC_TIME_()))
 #elif (QS_TIME_SIZE == 4U)
     //! Internal macro to output time stamp to a QS record
-    #define QS_TIME_PRE_() (QP::QS::u32_raw_(QP::QS::onGetTime()))
+    #define QS_TIME_PRE_() (QP::QS::u32_raw_(QS_REC_TIME_()))
 #else
     #error "QS_TIME_SIZE defined incorrectly, expected 1U, 2U, or 4U"
 #endif
 
+#ifndef QS_THREAD_BUF
+    //! Internal macro to obtain the time stamp of the current QS record
+    #define QS_REC_TIME_() (QP::QS::onGetTime())
+#else
+    // per-thread QS buffers: the time stamp of a record in a thread buffer
+    // is also its merge key, see QP::QSThrBuf
+    #define QS_REC_TIME_() (QP::QS::recTime_())
+
+    #ifndef QS_THREAD_REC_MAX
+        //! The maximum size [bytes] of a QS record in a thread buffer
+        #define QS_THREAD_REC_MAX 256U
+    #endif
+#endif // QS_THREAD_BUF
+
 
 //****************************************************************************
 namespace QP {
@@ -269,6 +286,10 @@ using QSCtr = std::uint_fast16_t;
 //! QP::QS::getByte() function.
 constexpr std::uint16_t QS_EOD  = 0xFFFFU;
 
+#ifdef QS_THREAD_BUF
+struct QSThrBuf;
+#endif
+
 //! QS logging facilities
 /// @description
 /// This class groups together QS services. It has only static members and
@@ -382,6 +403,19 @@ public:
     static std::uint8_t const *getBlock(
                                std::uint16_t * const pNbytes) noexcept;
 
+#ifdef QS_THREAD_BUF
+    //! Give the calling thread its own QS buffer @p tb (see QP::QSThrBuf)
+    static void initThrBuf(QSThrBuf * const tb,
+                           std::uint8_t * const sto,
+                           std::uint_fast16_t const stoSize) noexcept;
+
+    //! Merge the records from the thread buffers into the QS buffer
+    static void mergeThrBufs_(void) noexcept;
+
+    //! The time stamp of the current QS record
+    static QSTimeCtr recTime_(void) noexcept;
+#endif // QS_THREAD_BUF
+
     // platform-dependent callback functions to be implemented by clients ....
 
     //! Callback to startup the QS facility
@@ -520,6 +554,12 @@ public:
 
     static QS priv_;
 
+#ifdef QS_THREAD_BUF
+    static QSThrBuf *thrList_;         //!< list of the thread buffers
+    static thread_local QSThrBuf *thr_; //!< buffer of the calling thread
+    static thread_local QS *tx_;        //!< where the records are written
+#endif
+
     static struct QSrxPriv {
         void *currObj[MAX_OBJ]; //!< current objects
         std::uint8_t *buf;      //!< pointer to the start of the ring buffer
@@ -533,6 +573,41 @@ public:
     } rxPriv_;
 };
 
+#ifdef QS_THREAD_BUF
+//****************************************************************************
+//! Private QS buffer of a thread
+/// @description
+/// A thread that owns a QSThrBuf (see QP::QS::initThrBuf()) writes its QS
+/// records into the thread buffer without entering the QS critical section.
+/// Every record is stored there as a complete QS frame preceded by its time
+/// stamp (the merge key) and length. QP::QS::getBlock() merges the records
+/// from all thread buffers into the QS buffer in the time stamp order and
+/// assigns them the global sequence numbers. (The records of the threads
+/// without a thread buffer bypass the merge, so they are not ordered with
+/// the buffered records.)
+///
+/// @note A record is dropped when its thread buffer has less than
+/// #QS_THREAD_REC_MAX bytes free, so no record may be longer than that.
+///
+struct QSThrBuf {
+    QS tx;                  //!< state of the thread buffer (writer)
+    QS sink;                //!< discards the records that don't fit
+    std::uint8_t sinkBuf[8]; //!< storage of the sink
+    QSThrBuf *next;         //!< next thread buffer in QP::QS::thrList_
+    QSCtr start;            //!< offset of the record being written
+    QSCtr commit;           //!< offset of the end of the complete records
+    QSCtr tail;             //!< offset of the next record to merge
+    QSTimeCtr key;          //!< time stamp of the record being written
+                            //!< (or of the previous record)
+    std::uint8_t state;     //!< 0:idle, 1:taking time stamp, 2:writing
+    std::uint32_t nDropped; //!< number of records dropped
+};
+
+inline QSTimeCtr QS::recTime_(void) noexcept {
+    return (thr_ != nullptr) ? thr_->key : onGetTime();
+}
+#endif // QS_THREAD_BUF
+
 //****************************************************************************
 // QS receive channel
 
@@ -695,8 +770,8 @@ constexpr std::uint8_t QUTEST_ON_POST {124U};
 /// QP::QS_QF_ACTIVE_DEFER, QP::QS_QF_ACTIVE_RECALL,
 /// QP::QS_QF_ACTIVE_SUBSCRIBE, QP::QS_QF_ACTIVE_UNSUBSCRIBE,
 /// QP::QS_QF_ACTIVE_POST, QP::QS_QF_ACTIVE_POST_LIFO,
-/// QP::QS_QF_ACTIVE_GET, QP::QS_QF_ACTIVE_GET_LAST, and
-/// QP::QS_QF_ACTIVE_RECALL_ATTEMPT.
+/// QP::QS_QF_ACTIVE_GET, QP::QS_QF_ACTIVE_GET_LAST,
+/// QP::QS_QF_ACTIVE_RECALL_ATTEMPT, and QP::QS_QF_ACTIVE_POST_MERGE.
 ///
 /// @sa Example of using QS filters in #QS_FILTER_ON documentation
 #define QS_FILTER_AO_OBJ(obj_) \
@@ -796,16 +871,16 @@ constexpr std::uint8_t QUTEST_ON_POST {124U};
             || (QP::QS::priv_.locFilter[QP::QS::AP_OBJ] == (obj_)))) \
     {                                                                \
         QS_CRIT_STAT_                                                \
-        QS_CRIT_ENTRY_();                                            \
+        QS_REC_CRIT_ENTRY_();                                        \
         QP::QS::beginRec_(static_cast<std::uint_fast8_t>(rec_));     \
         QS_TIME_PRE_();
 
 //! End a QS record with exiting critical section.
 /// @sa example for #QS_BEGIN
 /// @note Must always be used in pair with #QS_BEGIN
-#define QS_END()           \
-        QP::QS::endRec_(); \
-        QS_CRIT_EXIT_();   \
+#define QS_END()             \
+        QP::QS::endRec_();   \
+        QS_REC_CRIT_EXIT_(); \
     }
 
 //! Begin a QS user record without entering critical section.
@@ -890,6 +965,27 @@ constexpr std::uint8_t QUTEST_ON_POST {124U};
 
 #endif // separate QS critical section not defined
 
+#ifndef QS_THREAD_BUF
+    //! Internal macro for entering the critical section around a QS record
+    #define QS_REC_CRIT_ENTRY_() QS_CRIT_ENTRY_()
+
+    //! Internal macro for exiting the critical section around a QS record
+    #define QS_REC_CRIT_EXIT_()  QS_CRIT_EXIT_()
+#else
+    // records written to a thread buffer need no critical section
+    #define QS_REC_CRIT_ENTRY_()               \
+        if (QP::QS::thr_ == nullptr) {         \
+            QS_CRIT_ENTRY_();                  \
+        }
+    #define QS_REC_CRIT_EXIT_()                \
+        if (QP::QS::thr_ == nullptr) {         \
+            QS_CRIT_EXIT_();                   \
+        }                                      \
+        else {                                 \
+            QS_REC_DONE();                     \
+        }
+#endif // QS_THREAD_BUF
+
 
 //****************************************************************************
 // Macros for use in the client code
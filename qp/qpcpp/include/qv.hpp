@@ -101,6 +101,7 @@ extern "C" {
     #define QF_SCHED_UNLOCK_()    (static_cast<void>(0))
 
     // QV-specific native event queue operations...
+    #define QF_NATIVE_EQUEUE_ // AO queues fully managed by QF
     #define QACTIVE_EQUEUE_WAIT_(me_) \
         Q_ASSERT_ID(110, (me_)->m_eQueue.m_frontEvt != nullptr)
     #define QACTIVE_EQUEUE_SIGNAL_(me_) \
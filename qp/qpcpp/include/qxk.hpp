@@ -213,6 +213,8 @@ public:
     } while (false)
 
     // QXK-specific native event queue operations...
+    // NOTE: QF_NATIVE_EQUEUE_ is not defined, because the QXThread
+    // subscribers must be posted only through QXThread::post_()
     #define QACTIVE_EQUEUE_WAIT_(me_) \
         Q_ASSERT_ID(110, (me_)->m_eQueue.m_frontEvt != nullptr)
 
@@ -38,6 +38,9 @@
 
 // expose features from the 2008 POSIX standard (IEEE Standard 1003.1-2008)
 #define _POSIX_C_SOURCE 200809L
+#if (defined QV_PARTITIONS) && (!defined _GNU_SOURCE)
+    #define _GNU_SOURCE     // for pthread_setaffinity_np()
+#endif
 
 #define QP_IMPL             // this is QP implementation
 #include "qf_port.hpp"      // QF port
@@ -60,14 +63,24 @@
 #include <termios.h>
 #include <unistd.h>
 #include <signal.h>
+#ifdef QF_TICKLESS
+    #include <time.h>       // for clock_gettime()
+#endif
 
 namespace QP {
 
 Q_DEFINE_THIS_MODULE("qf_port")
 
 /* Global objects ==========================================================*/
+#ifndef QV_PARTITIONS
 QPSet  QV_readySet_;        // QV-ready set of active objects
 pthread_cond_t QV_condVar_; // Cond.var. to signal events
+#else
+QPSet QV_partReady_[QV_PARTITIONS];          // ready sets of the partitions
+pthread_cond_t QV_partCond_[QV_PARTITIONS];  // cond.vars. to wake up
+bool QV_partIdle_[QV_PARTITIONS];            // partition waiting for events?
+std::uint8_t QV_partOf_[QF_MAX_ACTIVE + 1U]; // partition of each AO
+#endif // QV_PARTITIONS
 
 // Local objects *************************************************************
 static pthread_mutex_t l_pThreadMutex; // POSIX mutex for the QF crit. section
@@ -80,6 +93,25 @@ enum { NANOSLEEP_NSEC_PER_SEC = 1000000000 }; // see NOTE05
 static void *ticker_thread(void *arg);
 static void sigIntHandler(int /* dummy */);
 
+#ifdef QF_TICKLESS
+// monotonic clock and "tickless" clock tick loop (shared with POSIX)
+#include "../posix/qf_clock.hpp"
+#endif // QF_TICKLESS
+
+#ifdef QV_PARTITIONS
+// partitioned QV event loops, see NOTE3 in qf_port.hpp
+static std::uint8_t l_partSet[QF_MAX_ACTIVE + 1U]; // partition+1 (0: default)
+static int_t l_partCpu[QV_PARTITIONS];      // CPU of each partition (-1: any)
+static bool l_partCpuSet[QV_PARTITIONS];    // CPU assigned explicitly?
+
+static void partLoop(std::uint_fast8_t const part);
+static void *part_thread(void *arg);
+#endif // QV_PARTITIONS
+
+#ifdef QF_EVT_BURST
+static void burstDispatch(QActive * const a); // see NOTE06
+#endif
+
 //****************************************************************************
 void QF::init(void) {
     // lock memory so we're never swapped out to disk
@@ -88,13 +120,24 @@ void QF::init(void) {
     // init the global mutex with the default non-recursive initializer
     pthread_mutex_init(&l_pThreadMutex, NULL);
 
+#ifndef QV_PARTITIONS
     // init the global condition variable with the default initializer
     pthread_cond_init(&QV_condVar_, NULL);
+#else
+    // init the condition variables of all partitions
+    for (std::uint_fast8_t k = 0U; k < QV_PARTITIONS; ++k) {
+        pthread_cond_init(&QV_partCond_[k], NULL);
+    }
+#endif // QV_PARTITIONS
 
     l_tick.tv_sec = 0;
     l_tick.tv_nsec = NANOSLEEP_NSEC_PER_SEC/100L; // default clock tick
     l_tickPrio = sched_get_priority_min(SCHED_FIFO); // default tick prio
 
+#ifdef QF_TICKLESS
+    ticklessInit(); // initialize the "tickless" clock
+#endif
+
     // install the SIGINT (Ctrl-C) signal handler
     struct sigaction sig_act;
     sig_act.sa_handler = &sigIntHandler;
@@ -158,6 +201,20 @@ int_t QF::run(void) {
         pthread_attr_destroy(&attr);
     }
 
+#ifdef QV_PARTITIONS
+    // start the event loops of the other partitions, see NOTE3
+    pthread_t partThread[QV_PARTITIONS];
+    for (std::uint_fast8_t k = 1U; k < QV_PARTITIONS; ++k) {
+        Q_ALLEGE_ID(310, pthread_create(&partThread[k], NULL, &part_thread,
+            reinterpret_cast<void *>(static_cast<std::uintptr_t>(k))) == 0);
+    }
+
+    partLoop(0U); // the event loop of the partition 0 in this thread
+
+    for (std::uint_fast8_t k = 1U; k < QV_PARTITIONS; ++k) {
+        pthread_join(partThread[k], NULL);
+    }
+#else
     // the combined event-loop and background-loop of the QV kernel */
     QF_CRIT_STAT_
     QF_CRIT_ENTRY_();
@@ -178,9 +235,13 @@ int_t QF::run(void) {
             // 2. dispatch the event to the AO's state machine.
             // 3. determine if event is garbage and collect it if so
             //
+#ifdef QF_EVT_BURST
+            burstDispatch(a); // up to the burst limit of 'a' (NOTE06)
+#else
             QEvt const *e = a->get_();
             a->dispatch(e);
             gc(e);
+#endif
 
             QF_CRIT_ENTRY_();
 
@@ -200,10 +261,17 @@ int_t QF::run(void) {
         }
     }
     QF_CRIT_EXIT_();
+#endif // QV_PARTITIONS
     onCleanup();  // cleanup callback
     QS_EXIT();    // cleanup the QSPY connection
 
+#ifndef QV_PARTITIONS
     pthread_cond_destroy(&QV_condVar_); // cleanup the condition variable
+#else
+    for (std::uint_fast8_t k = 0U; k < QV_PARTITIONS; ++k) {
+        pthread_cond_destroy(&QV_partCond_[k]);
+    }
+#endif
     pthread_mutex_destroy(&l_pThreadMutex); // cleanup the global mutex
 
     return 0; // return success
@@ -222,9 +290,27 @@ void QF_setTickRate(std::uint32_t ticksPerSec, int_t tickPrio) {
 void QF::stop(void) {
     l_isRunning = false; // terminate the main event-loop thread
 
+#ifdef QF_TICKLESS
+    QF_CRIT_STAT_
+    QF_CRIT_ENTRY_();
+    pthread_cond_signal(&l_tickCond); // wake up the tick loop
+    QF_CRIT_EXIT_();
+#endif
+
+#ifndef QV_PARTITIONS
     // unblock the event-loop so it can terminate
     QV_readySet_.insert(1);
     pthread_cond_signal(&QV_condVar_);
+#else
+    // unblock the event-loops of all partitions so they can terminate
+    QF_CRIT_STAT_
+    QF_CRIT_ENTRY_();
+    for (std::uint_fast8_t k = 0U; k < QV_PARTITIONS; ++k) {
+        QV_partIdle_[k] = false;
+        pthread_cond_signal(&QV_partCond_[k]);
+    }
+    QF_CRIT_EXIT_();
+#endif
 }
 //............................................................................
 void QF_consoleSetup(void) {
@@ -270,6 +356,11 @@ void QActive::start(std::uint_fast8_t const prio,
 
     m_eQueue.init(qSto, qLen);
     m_prio = static_cast<std::uint8_t>(prio); // set the QF prio of this AO
+#ifdef QV_PARTITIONS
+    QV_partOf_[prio] = (l_partSet[prio] != 0U)
+        ? static_cast<std::uint8_t>(l_partSet[prio] - 1U)
+        : static_cast<std::uint8_t>(prio % QV_PARTITIONS);
+#endif
     QF::add_(this); // make QF aware of this AO
 
     this->init(par); // execute initial transition (virtual call)
@@ -283,7 +374,11 @@ void QActive::stop(void) {
     // make sure the AO is no longer in "ready set"
     QF_CRIT_STAT_
     QF_CRIT_ENTRY_();
+#ifndef QV_PARTITIONS
     QV_readySet_.rmove(m_prio);
+#else
+    QV_partReady_[QV_partOf_[m_prio]].rmove(m_prio);
+#endif
     QF_CRIT_EXIT_();
 
     QF::remove_(this); // remove this AO from QF
@@ -292,13 +387,111 @@ void QActive::stop(void) {
 
 //****************************************************************************
 static void *ticker_thread(void * /*arg*/) { // for pthread_create()
+#ifndef QF_TICKLESS
     while (l_isRunning) { // the clock tick loop...
         nanosleep(&l_tick, NULL); // sleep for the number of ticks, NOTE05
         QF_onClockTick(); // clock tick callback (must call QF_TICK_X())
     }
+#else
+    ticklessLoop(&l_pThreadMutex); // "tickless" loop, see NOTE2
+#endif
     return nullptr; // return success
 }
 
+#ifdef QV_PARTITIONS
+//****************************************************************************
+void QF_setPartition(std::uint_fast8_t const prio,
+                     std::uint_fast8_t const part)
+{
+    Q_REQUIRE_ID(700, (0U < prio) && (prio <= QF_MAX_ACTIVE)
+                      && (part < QV_PARTITIONS));
+    l_partSet[prio] = static_cast<std::uint8_t>(part + 1U);
+}
+//............................................................................
+void QF_setPartitionCpu(std::uint_fast8_t const part, int_t const cpu) {
+    Q_REQUIRE_ID(710, part < QV_PARTITIONS);
+    l_partCpu[part] = cpu;
+    l_partCpuSet[part] = true;
+}
+//............................................................................
+static void *part_thread(void *arg) { // for pthread_create()
+    partLoop(static_cast<std::uint_fast8_t>(
+                 reinterpret_cast<std::uintptr_t>(arg)));
+    return nullptr; // return success
+}
+//............................................................................
+// the event-loop of one QV partition, see NOTE3 in qf_port.hpp
+static void partLoop(std::uint_fast8_t const part) {
+    // pin the calling thread to the CPU of the partition
+    int_t const cpu = l_partCpuSet[part]
+                      ? l_partCpu[part]
+                      : static_cast<int_t>(part);
+    long const nCpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if ((cpu >= 0) && (nCpus > 0)) {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(static_cast<int>(cpu % nCpus), &cpus);
+        if (pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus)
+            != 0)
+        {
+            // pinning failed, the partition runs on any CPU
+        }
+    }
+
+    QPSet &readySet = QV_partReady_[part];
+    QF_CRIT_STAT_
+    QF_CRIT_ENTRY_();
+    while (l_isRunning) {
+
+        if (readySet.notEmpty()) {
+            std::uint_fast8_t p = readySet.findMax();
+            QActive *a = QF::active_[p];
+            QF_CRIT_EXIT_();
+
+            // the active object 'a' must still be registered in QF
+            // (e.g., it must not be stopped)
+            Q_ASSERT_ID(320, a != nullptr);
+
+            // perform the run-to-completion (RTC) step...
+#ifdef QF_EVT_BURST
+            burstDispatch(a); // up to the burst limit of 'a' (NOTE06)
+#else
+            QEvt const *e = a->get_();
+            a->dispatch(e);
+            QF::gc(e);
+#endif
+
+            QF_CRIT_ENTRY_();
+
+            if (a->m_eQueue.isEmpty()) { /* empty queue? */
+                readySet.rmove(p);
+            }
+        }
+        else { // wait until events are posted to this partition
+            QV_partIdle_[part] = true;
+            while (QV_partIdle_[part]) {
+                pthread_cond_wait(&QV_partCond_[part], &l_pThreadMutex);
+            }
+        }
+    }
+    QF_CRIT_EXIT_();
+}
+#endif // QV_PARTITIONS
+
+#ifdef QF_EVT_BURST
+//****************************************************************************
+// remove a burst of events from the queue of the active object @p a
+// and dispatch them, see NOTE06
+static void burstDispatch(QActive * const a) {
+    QEvt const *evts[QF_EVT_BURST];
+    std::uint_fast8_t const n = a->getBurst_(evts); // the queue not empty
+    for (std::uint_fast8_t i = 0U; i < n; ++i) {
+        a->dispatch(evts[i]);
+        QF::gc(evts[i]);
+    }
+}
+#endif // QF_EVT_BURST
+
 //****************************************************************************
 static void sigIntHandler(int /* dummy */) {
     QF::onCleanup();
@@ -349,4 +542,16 @@ static void sigIntHandler(int /* dummy */) {
 // deliver only 2*actual-system-tick granularity. To compensate for this,
 // you would need to reduce (by 2) the constant NANOSLEEP_NSEC_PER_SEC.
 //
+// NOTE06:
+// With QF_EVT_BURST, the QV event loop removes up to QActive::setBurst()
+// events from the queue of the highest-priority AO ready to run in one
+// critical section and dispatches them one after another, before it checks
+// again for the AOs of higher priority. The burst limit of an AO therefore
+// bounds the additional latency of the higher-priority AOs (in the same
+// partition with QV_PARTITIONS) to the duration of that many RTC steps of
+// the AO. Bursts are opt-in per AO (QActive::setBurst(), default 1) and
+// exclude postLIFO()/recall() to the AO, since the recalled event would
+// otherwise be dispatched behind the rest of the burst already taken off
+// the queue.
+//
 
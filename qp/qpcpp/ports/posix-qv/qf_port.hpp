@@ -81,8 +81,39 @@ void QF_leaveCriticalSection_(void);
 // (NOTE: ticksPerSec==0 disables the "ticker thread"
 void QF_setTickRate(uint32_t ticksPerSec, int_t tickPrio);
 
+#ifndef QF_TICKLESS
 // clock tick callback (NOTE not called when "ticker thread" is not running)
 void QF_onClockTick(void);
+#else
+// "tickless" clock tick callback (provided in the app), called once for
+// all nTicks clock ticks elapsed since the last call, see NOTE2
+void QF_onClockTick(QTimeEvtCtr const nTicks);
+#endif // QF_TICKLESS
+
+#ifdef QF_TICKLESS
+// statistics of the "tickless" clock tick processing, see NOTE2
+struct QF_TickStat {
+    std::uint32_t nWakeups;  // # wake-ups of the clock tick loop
+    std::uint32_t nTicks;    // # clock ticks processed (QF_onClockTick())
+    std::uint32_t nSkipped;  // # clock ticks skipped (no time events armed)
+    std::uint32_t nOverruns; // # clock ticks processed a whole tick late
+    std::uint32_t maxLate;   // maximum lateness of a clock tick [us]
+};
+
+// obtain the statistics of the "tickless" clock tick processing
+void QF_getTickStat(QF_TickStat * const stat);
+#endif // QF_TICKLESS
+
+#ifdef QV_PARTITIONS
+// assign the AO of priority prio to the QV partition part (0..
+// QV_PARTITIONS-1); must be called before QActive::start(), see NOTE3
+void QF_setPartition(std::uint_fast8_t const prio,
+                     std::uint_fast8_t const part);
+
+// pin the thread of the QV partition part to the CPU cpu
+// (cpu < 0 means no pinning); must be called before QF::run()
+void QF_setPartitionCpu(std::uint_fast8_t const part, int_t const cpu);
+#endif // QV_PARTITIONS
 
 // abstractions for console access...
 void QF_consoleSetup(void);
@@ -103,13 +134,26 @@ int  QF_consoleWaitForKey(void);
     #define QF_SCHED_UNLOCK_()    ((void)0)
 
     // event queue operations...
+    #define QF_NATIVE_EQUEUE_ // AO queues fully managed by QF
     #define QACTIVE_EQUEUE_WAIT_(me_) \
         Q_ASSERT((me_)->m_eQueue.m_frontEvt != nullptr)
 
+#ifndef QV_PARTITIONS
     #define QACTIVE_EQUEUE_SIGNAL_(me_) do { \
         QV_readySet_.insert((me_)->m_prio); \
         pthread_cond_signal(&QV_condVar_); \
     } while (false)
+#else
+    // wake up the partition of the AO only when it waits for events, NOTE3
+    #define QACTIVE_EQUEUE_SIGNAL_(me_) do { \
+        std::uint_fast8_t const part_ = QV_partOf_[(me_)->m_prio]; \
+        QV_partReady_[part_].insert((me_)->m_prio); \
+        if (QV_partIdle_[part_]) { \
+            QV_partIdle_[part_] = false; \
+            pthread_cond_signal(&QV_partCond_[part_]); \
+        } \
+    } while (false)
+#endif // QV_PARTITIONS
 
     // event pool operations...
     #define QF_EPOOL_TYPE_  QMPool
@@ -122,11 +166,30 @@ int  QF_consoleWaitForKey(void);
         ((e_) = static_cast<QEvt *>((p_).get((m_))))
     #define QF_EPOOL_PUT_(p_, e_)     ((p_).put(e_))
 
+#ifdef QF_TICKLESS
+    // "tickless" clock: compensate for the clock ticks not processed yet
+    #define QF_TIMEEVT_ARM_(tickRate_, nTicks_) \
+        QF_ticklessArm_((tickRate_), (nTicks_))
+
+    namespace QP {
+        // adjust the number of ticks of a time event being armed
+        QTimeEvtCtr QF_ticklessArm_(std::uint_fast8_t const tickRate,
+                                    QTimeEvtCtr const nTicks) noexcept;
+    } // namespace QP
+#endif // QF_TICKLESS
+
     #include <pthread.h>   // POSIX-thread API
 
     namespace QP {
+#ifndef QV_PARTITIONS
         extern QPSet QV_readySet_; // QV-ready set of active objects
         extern pthread_cond_t QV_condVar_; // Cond.var. to signal events
+#else
+        extern QPSet QV_partReady_[QV_PARTITIONS]; // ready sets of partitions
+        extern pthread_cond_t QV_partCond_[QV_PARTITIONS]; // to wake up
+        extern bool QV_partIdle_[QV_PARTITIONS]; // partition waiting?
+        extern std::uint8_t QV_partOf_[QF_MAX_ACTIVE + 1U]; // AO partition
+#endif // QV_PARTITIONS
     } // namespace QP
 
 #endif // QP_IMPL
@@ -161,6 +224,46 @@ int  QF_consoleWaitForKey(void);
 // implementation, such as POSIX threads, should support the priority-
 // inheritance protocol.
 //
+// NOTE2:
+// Defining the macro QF_TICKLESS replaces the fixed-period clock tick loop
+// of the ticker thread with a "tickless" loop. The loop finds out from the
+// armed time events when the nearest timeout expires (QF::nextTimeoutX())
+// and sleeps until that absolute deadline on CLOCK_MONOTONIC, so no clock
+// ticks are generated while no timeouts are pending. After every wake-up
+// the loop calls QF_onClockTick(nTicks) once with the number of clock
+// ticks that elapsed since the last processed tick (catching up after
+// oversleeping), which must process them all in one pass with
+// QF::TICK_N(0U, nTicks, &sender). The ticks that elapsed with no time
+// events armed at all are skipped.
+// Arming a time event wakes up the loop when the new timeout is sooner
+// and compensates for the elapsed clock ticks, which the loop has not
+// taken for processing yet (see QF_TIMEEVT_ARM_()). The loop takes the
+// ticks and marks them with QF::tickMark_() in one critical section, so
+// QF::TICK_N() does not count down the time events armed afterwards once
+// more. The lateness of the processed ticks is
+// collected in the QF_TickStat statistics (see QF_getTickStat()).
+//
+// Please note that in this mode QF_onClockTick() is NOT called periodically,
+// so it should not be used for polling of I/O (such as the console).
+// Also, the compensation is exact only for the tick rate 0, which must be
+// serviced in every QF_onClockTick() call. The loop is implemented in
+// ports/posix/qf_clock.hpp, which is shared by the POSIX and POSIX-QV ports.
+//
+// NOTE3:
+// Defining the macro QV_PARTITIONS as the number of partitions (e.g.,
+// -DQV_PARTITIONS=2U) runs that many cooperative QV event loops, each in
+// its own thread pinned to one CPU (see QF_setPartitionCpu(), by default
+// partition k runs on the CPU k). Every active object belongs to exactly one
+// partition (see QF_setPartition(), by default the partition
+// prio % QV_PARTITIONS) and the event loop of a partition executes
+// the RTC steps of its AOs one at a time, highest-priority first, exactly
+// like the single QV loop. Therefore the AOs within a partition never
+// preempt each other, while AOs in different partitions run in parallel.
+// Posting an event to an AO in another partition wakes up that partition
+// only when it waits for events, so the posts within a busy partition
+// never signal the condition variable. The partition 0 runs in the thread
+// that calls QF::run().
+//
 
 #endif // QF_PORT_HPP
 
@@ -0,0 +1,211 @@
+/// @file
+/// @brief clock tick facilities shared by the POSIX and POSIX-QV ports
+/// @cond
+///***************************************************************************
+/// Last updated for version 6.8.2
+/// Last updated on  2020-07-17
+///
+///                    Q u a n t u m  L e a P s
+///                    ------------------------
+///                    Modern Embedded Software
+///
+/// Copyright (C) 2005-2020 Quantum Leaps. All rights reserved.
+///
+/// This program is open source software: you can redistribute it and/or
+/// modify it under the terms of the GNU General Public License as published
+/// by the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Alternatively, this program may be distributed and modified under the
+/// terms of Quantum Leaps commercial licenses, which expressly supersede
+/// the GNU General Public License and are specifically designed for
+/// licensees interested in retaining the proprietary status of their code.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program. If not, see <www.gnu.org/licenses>.
+///
+/// Contact information:
+/// <www.state-machine.com/licensing>
+/// <info@state-machine.com>
+///***************************************************************************
+/// @endcond
+///
+/// @note
+/// This file is not a separate module. It is included only in qf_port.cpp
+/// of the POSIX and POSIX-QV ports, inside the namespace QP and after the
+/// port's l_tick, l_isRunning and NANOSLEEP_NSEC_PER_SEC (<time.h> must be
+/// included already).
+///
+#ifndef QF_CLOCK_HPP
+#define QF_CLOCK_HPP
+
+//****************************************************************************
+// the current time of the monotonic clock [ns]
+static std::uint64_t monotonicNow(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (static_cast<std::uint64_t>(ts.tv_sec) * NANOSLEEP_NSEC_PER_SEC)
+           + static_cast<std::uint64_t>(ts.tv_nsec);
+}
+
+#ifdef QF_TICKLESS
+
+static pthread_cond_t l_tickCond;  // cond.var. to wake up the tick loop
+static std::uint64_t l_tickPeriod; // clock tick period [ns] (0 - stopped)
+static std::uint64_t l_tickEpoch;  // time of the clock tick number 0 [ns]
+static std::uint64_t l_tickCtr;    // # clock ticks processed (or skipped)
+static std::uint64_t l_tickWake;   // tick to wake up at (0 - not sleeping)
+static QF_TickStat l_tickStat;     // statistics of the tick processing
+
+//............................................................................
+// initialize the "tickless" clock (called from QF::init())
+static void ticklessInit(void) {
+    // the tick loop sleeps until absolute deadlines on CLOCK_MONOTONIC
+    pthread_condattr_t cattr;
+    pthread_condattr_init(&cattr);
+    pthread_condattr_setclock(&cattr, CLOCK_MONOTONIC);
+    pthread_cond_init(&l_tickCond, &cattr);
+    pthread_condattr_destroy(&cattr);
+}
+//............................................................................
+// the "tickless" clock tick loop, see QF_TICKLESS in qf_port.hpp
+// ('critMutex' is the mutex of the QF critical section)
+static void ticklessLoop(pthread_mutex_t * const critMutex) {
+    QF_CRIT_STAT_
+    QF_CRIT_ENTRY_();
+    l_tickPeriod = (static_cast<std::uint64_t>(l_tick.tv_sec)
+                    * NANOSLEEP_NSEC_PER_SEC)
+                   + static_cast<std::uint64_t>(l_tick.tv_nsec);
+    l_tickEpoch  = monotonicNow();
+    l_tickCtr    = 0U;
+    l_tickWake   = 0U;
+
+    // the first clock tick due for processing, that is, not suppressed
+    // intentionally while sleeping until the nearest timeout
+    std::uint64_t due = 0U;
+
+    while (l_isRunning) {
+        std::uint64_t const now = monotonicNow();
+        std::uint64_t const elapsed = (now - l_tickEpoch) / l_tickPeriod;
+
+        // any clock ticks elapsed, but not processed yet?
+        if (elapsed > l_tickCtr) {
+            bool armed = false;
+            for (std::uint_fast8_t r = 0U; r < QF_MAX_TICK_RATE; ++r) {
+                armed = armed || !QF::noTimeEvtsActiveX(r);
+            }
+
+            std::uint64_t n = elapsed - l_tickCtr; // ticks to process
+            std::uint64_t const first = (due > l_tickCtr) // not suppressed
+                                        ? due
+                                        : (l_tickCtr + 1U);
+
+            if (!armed) { // no time events armed? skip the elapsed ticks
+                l_tickStat.nSkipped += static_cast<std::uint32_t>(n);
+                l_tickCtr = elapsed;
+            }
+            else { // process the elapsed clock ticks at once
+                // QTimeEvtCtr might not hold all elapsed ticks, in which
+                // case the rest is processed in the next pass of the loop
+                if (n > static_cast<QTimeEvtCtr>(~0U)) {
+                    n = static_cast<QTimeEvtCtr>(~0U);
+                }
+                l_tickCtr += n;
+                l_tickStat.nTicks += static_cast<std::uint32_t>(n);
+
+                // the ticks from 'first' to 'l_tickCtr' were due, but only
+                // the 'elapsed' tick is less than a whole tick late
+                if (first <= l_tickCtr) {
+                    std::uint64_t const late =
+                        now - (l_tickEpoch + (first * l_tickPeriod));
+                    l_tickStat.nOverruns +=
+                        static_cast<std::uint32_t>(l_tickCtr - first);
+                    if ((late / 1000U) > l_tickStat.maxLate) {
+                        l_tickStat.maxLate = static_cast<std::uint32_t>(
+                                                 late / 1000U);
+                    }
+                }
+
+                // the time events armed from now on are compensated for
+                // the ticks after 'l_tickCtr' only (see QF_ticklessArm_())
+                // so the ticks up to 'l_tickCtr' must not count them down
+                QTimeEvtCtr const k = static_cast<QTimeEvtCtr>(n);
+                QF::tickMark_(0U, k);
+                QF_CRIT_EXIT_();
+
+                QF_onClockTick(k); // clock tick callback (TICK_N())
+                QF_CRIT_ENTRY_();
+            }
+        }
+        else { // all elapsed ticks processed, sleep until the next timeout
+            std::uint64_t nTicks = 0U;
+            for (std::uint_fast8_t r = 0U; r < QF_MAX_TICK_RATE; ++r) {
+                std::uint64_t const n = QF::nextTimeoutX(r);
+                if ((n != 0U) && ((nTicks == 0U) || (n < nTicks))) {
+                    nTicks = n;
+                }
+            }
+
+            if (nTicks == 0U) { // no timeouts? sleep until woken up
+                l_tickWake = ~static_cast<std::uint64_t>(0U);
+                due = l_tickWake;
+                pthread_cond_wait(&l_tickCond, critMutex);
+            }
+            else {
+                l_tickWake = l_tickCtr + nTicks;
+                due = l_tickWake;
+                std::uint64_t const deadline =
+                    l_tickEpoch + (l_tickWake * l_tickPeriod);
+                struct timespec ts;
+                ts.tv_sec  = static_cast<time_t>(
+                                 deadline / NANOSLEEP_NSEC_PER_SEC);
+                ts.tv_nsec = static_cast<long>(
+                                 deadline % NANOSLEEP_NSEC_PER_SEC);
+                pthread_cond_timedwait(&l_tickCond, critMutex, &ts);
+            }
+            l_tickWake = 0U; // not sleeping any more
+            ++l_tickStat.nWakeups;
+        }
+    }
+    l_tickPeriod = 0U; // the tick loop stopped
+    QF_CRIT_EXIT_();
+}
+//............................................................................
+QTimeEvtCtr QF_ticklessArm_(std::uint_fast8_t const tickRate,
+                            QTimeEvtCtr const nTicks) noexcept
+{
+    std::uint64_t ctr = nTicks;
+
+    if (l_tickPeriod != 0U) { // the tick loop running?
+        // compensate for the elapsed ticks not processed yet (rate 0 only)
+        if (tickRate == 0U) {
+            ctr += ((monotonicNow() - l_tickEpoch) / l_tickPeriod)
+                   - l_tickCtr;
+            if (ctr > static_cast<QTimeEvtCtr>(~0U)) { // out of range?
+                ctr = static_cast<QTimeEvtCtr>(~0U);
+            }
+        }
+
+        // the tick loop sleeping past the new timeout?
+        if ((l_tickWake != 0U) && ((l_tickCtr + ctr) < l_tickWake)) {
+            pthread_cond_signal(&l_tickCond);
+        }
+    }
+    return static_cast<QTimeEvtCtr>(ctr);
+}
+//............................................................................
+void QF_getTickStat(QF_TickStat * const stat) {
+    QF_CRIT_STAT_
+    QF_CRIT_ENTRY_();
+    *stat = l_tickStat;
+    QF_CRIT_EXIT_();
+}
+
+#endif // QF_TICKLESS
+
+#endif // QF_CLOCK_HPP
@@ -60,6 +60,14 @@
 #include <termios.h>
 #include <unistd.h>
 #include <signal.h>
+#if (defined QF_TICKLESS) || (defined QF_TICK_DOMAINS)
+    #include <time.h>        // for clock_gettime()
+    #include <errno.h>       // for EINTR
+#endif
+#ifdef QF_LOCKFREE_EQUEUE
+    #include <linux/futex.h> // for FUTEX_WAIT_PRIVATE/FUTEX_WAKE_PRIVATE
+    #include <sys/syscall.h> // for SYS_futex
+#endif
 
 namespace QP {
 
@@ -77,7 +85,51 @@ static int_t l_tickPrio;
 enum { NANOSLEEP_NSEC_PER_SEC = 1000000000 }; // see NOTE05
 
 static void sigIntHandler(int /* dummy */);
+#ifndef QF_POOL_THREADS
 static void *ao_thread(void *arg); // thread routine for all AOs
+#else
+// AOs executed by a pool of worker threads, see NOTE5 in qf_port.hpp
+static_assert(QF_POOL_THREADS <= QF_MAX_ACTIVE,
+              "QF_POOL_THREADS must not exceed QF_MAX_ACTIVE");
+static QPSet l_poolReady[QF_POOL_THREADS];     // AOs ready at each worker
+static pthread_cond_t l_poolCond[QF_POOL_THREADS]; // to wake up a worker
+static bool l_poolIdle[QF_POOL_THREADS];       // worker waiting for AOs?
+static std::uint8_t l_poolHome[QF_MAX_ACTIVE + 1U]; // home worker of AOs
+static bool l_poolBusy[QF_MAX_ACTIVE + 1U];    // AO ready or running?
+
+static void *pool_thread(void *arg); // thread routine for all workers
+static void poolWake(std::uint_fast8_t const w);
+#endif // QF_POOL_THREADS
+
+#ifdef QF_EVT_BURST
+static void burstDispatch(QActive * const act); // see NOTE07
+#endif
+
+#if (defined Q_SPY) && (defined QS_THREAD_BUF)
+#ifndef QS_THREAD_BUF_SIZE
+    #define QS_THREAD_BUF_SIZE 1024U
+#endif
+// private QS buffers of the AO threads, see NOTE4 in qf_port.hpp
+static QSThrBuf l_qsThrBuf[QF_MAX_ACTIVE + 1U];
+static std::uint8_t l_qsThrSto[QF_MAX_ACTIVE + 1U][QS_THREAD_BUF_SIZE];
+// private QS buffers of the ticker thread [0] and the tick domains [r+1]
+static QSThrBuf l_qsTickBuf[QF_MAX_TICK_RATE + 1U];
+static std::uint8_t l_qsTickSto[QF_MAX_TICK_RATE + 1U][QS_THREAD_BUF_SIZE];
+#endif
+
+#if (defined QF_TICKLESS) || (defined QF_TICK_DOMAINS)
+// monotonic clock and "tickless" clock tick loop (shared with POSIX-QV)
+#include "qf_clock.hpp"
+#endif
+
+#ifdef QF_TICK_DOMAINS
+// independently clocked tick domains, see NOTE6 in qf_port.hpp
+static std::uint64_t l_domPeriod[QF_MAX_TICK_RATE]; // [ns] (0 - no domain)
+static int_t l_domPrio[QF_MAX_TICK_RATE];           // p-thread priorities
+static QF_TickDomainStat l_domStat[QF_MAX_TICK_RATE]; // statistics
+
+static void *tickDomain_thread(void *arg); // thread routine for domains
+#endif // QF_TICK_DOMAINS
 
 // QF functions ==============================================================
 void QF::init(void) {
@@ -98,6 +150,10 @@ void QF::init(void) {
     l_tick.tv_nsec = NANOSLEEP_NSEC_PER_SEC/100L; // default clock tick
     l_tickPrio = sched_get_priority_min(SCHED_FIFO); // default tick prio
 
+#ifdef QF_TICKLESS
+    ticklessInit(); // initialize the "tickless" clock
+#endif
+
     // install the SIGINT (Ctrl-C) signal handler
     struct sigaction sig_act;
     sig_act.sa_handler = &sigIntHandler;
@@ -127,16 +183,60 @@ int_t QF::run(void) {
         // setting priority failed, probably due to insufficient privieges
     }
 
+#if (defined Q_SPY) && (defined QS_THREAD_BUF)
+    // the ticker thread gets its own QS buffer, see NOTE4 in qf_port.hpp
+    QS::initThrBuf(&l_qsTickBuf[0], &l_qsTickSto[0][0],
+                   sizeof(l_qsTickSto[0]));
+#endif
+
     // unlock the startup mutex to unblock any active objects started before
     // calling QF::run()
     pthread_mutex_unlock(&l_startupMutex);
 
     l_isRunning = true;
+
+#ifdef QF_POOL_THREADS
+    // start the worker threads executing the active objects, NOTE5
+    for (std::uint_fast8_t w = 0U; w < QF_POOL_THREADS; ++w) {
+        pthread_cond_init(&l_poolCond[w], 0);
+    }
+    for (std::uint_fast8_t w = 0U; w < QF_POOL_THREADS; ++w) {
+        pthread_attr_t attr;
+        pthread_attr_init(&attr);
+        pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+        pthread_t thread;
+        Q_ALLEGE_ID(310, pthread_create(&thread, &attr, &pool_thread,
+            reinterpret_cast<void *>(static_cast<std::uintptr_t>(w))) == 0);
+        pthread_attr_destroy(&attr);
+    }
+#endif // QF_POOL_THREADS
+
+#ifdef QF_TICK_DOMAINS
+    // start the threads of the independently clocked tick domains, NOTE6
+    for (std::uint_fast8_t r = 0U; r < QF_MAX_TICK_RATE; ++r) {
+        if (l_domPeriod[r] != 0U) {
+            pthread_attr_t attr;
+            pthread_attr_init(&attr);
+            pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+            pthread_t thread;
+            Q_ALLEGE_ID(340, pthread_create(&thread, &attr,
+                &tickDomain_thread,
+                reinterpret_cast<void *>(static_cast<std::uintptr_t>(r)))
+                == 0);
+            pthread_attr_destroy(&attr);
+        }
+    }
+#endif // QF_TICK_DOMAINS
+
+#ifndef QF_TICKLESS
     while (l_isRunning) { // the clock tick loop...
         QF_onClockTick(); // clock tick callback (must call QF_TICK_X())
 
         nanosleep(&l_tick, NULL); // sleep for the number of ticks, NOTE05
     }
+#else
+    ticklessLoop(&QF_pThreadMutex_); // "tickless" loop, see NOTE3
+#endif
     onCleanup(); // cleanup callback
     pthread_mutex_destroy(&l_startupMutex);
     pthread_mutex_destroy(&QF_pThreadMutex_);
@@ -151,7 +251,22 @@ void QF_setTickRate(std::uint32_t ticksPerSec, int_t tickPrio) {
 }
 //............................................................................
 void QF::stop(void) {
+#if (!defined QF_TICKLESS) && (!defined QF_POOL_THREADS)
+    l_isRunning = false; // stop the loop in QF::run()
+#else
+    QF_CRIT_STAT_
+    QF_CRIT_ENTRY_();
     l_isRunning = false; // stop the loop in QF::run()
+#ifdef QF_TICKLESS
+    pthread_cond_signal(&l_tickCond); // wake up the tick loop
+#endif
+#ifdef QF_POOL_THREADS
+    for (std::uint_fast8_t w = 0U; w < QF_POOL_THREADS; ++w) {
+        pthread_cond_signal(&l_poolCond[w]); // wake up the worker
+    }
+#endif
+    QF_CRIT_EXIT_();
+#endif
 }
 //............................................................................
 void QF::thread_(QActive *act) {
@@ -166,15 +281,38 @@ void QF::thread_(QActive *act) {
     for (;;) // for-ever
 #endif
     {
+#ifdef QF_EVT_BURST
+        burstDispatch(act); // wait for events and dispatch them (NOTE07)
+#else
         QEvt const *e = act->get_(); // wait for event
         act->dispatch(e); // dispatch to the active object's state machine
         gc(e); // check if the event is garbage, and collect it if so
+#endif
     }
 #ifdef QF_ACTIVE_STOP
     remove_(act); // remove this object from QF
 #endif
 }
 
+#ifdef QF_EVT_BURST
+//............................................................................
+// wait for a burst of events for the active object @p act, dispatch them
+// and collect the garbage, see NOTE07
+static void burstDispatch(QActive * const act) {
+    QEvt const *evts[QF_EVT_BURST];
+    std::uint_fast8_t const n = act->getBurst_(evts); // wait for events
+    for (std::uint_fast8_t i = 0U; i < n; ++i) {
+#ifdef QF_ACTIVE_STOP
+        if (act->m_thread) // the AO not stopped by the previous event?
+#endif
+        {
+            act->dispatch(evts[i]); // dispatch to the AO's state machine
+        }
+        QF::gc(evts[i]); // check if the event is garbage, and collect it
+    }
+}
+#endif // QF_EVT_BURST
+
 //............................................................................
 void QF_consoleSetup(void) {
     struct termios tio;   // modified terminal attributes
@@ -213,15 +351,28 @@ void QActive::start(std::uint_fast8_t const prio,
     // p-threads allocate stack internally
     Q_REQUIRE_ID(600, stkSto == nullptr);
 
+#ifndef QF_LOCKFREE_EQUEUE
     pthread_cond_init(&m_osObject, 0);
+#else
+    m_osObject = 0; // the AO thread is not parked on the futex
+#endif
 
     m_eQueue.init(qSto, qLen);
     m_prio = static_cast<std::uint8_t>(prio); // set the QF prio of this AO
+#ifdef QF_POOL_THREADS
+    l_poolHome[prio] = static_cast<std::uint8_t>(prio % QF_POOL_THREADS);
+    l_poolBusy[prio] = false;
+#ifdef QF_ACTIVE_STOP
+    m_thread = true;
+#endif
+    static_cast<void>(stkSize); // the AOs run on the worker threads
+#endif
     QF::add_(this); // make QF aware of this AO
 
     this->init(par); // execute initial transition (virtual call)
     QS_FLUSH(); // flush the QS trace buffer to the host
 
+#ifndef QF_POOL_THREADS
     pthread_attr_t attr;
     pthread_attr_init(&attr);
 
@@ -255,20 +406,440 @@ void QActive::start(std::uint_fast8_t const prio,
             pthread_create(&thread, &attr, &ao_thread, this) == 0);
     }
     pthread_attr_destroy(&attr);
+#endif // QF_POOL_THREADS
 }
 //............................................................................
 #ifdef QF_ACTIVE_STOP
 void QActive::stop(void) {
     unsubscribeAll(); // unsubscribe this AO from all events
-    m_thread = false; // stop the thread loop (see QF::thread_)
+    m_thread = false; // stop the thread loop (see QF::thread_ or NOTE5)
+}
+#endif
+
+#ifdef QF_LOCKFREE_EQUEUE
+//****************************************************************************
+// Lock-free MPSC event queues of active objects, see NOTE06
+
+// access the ring-buffer cell @p i_ of the event queue @p q_, where the
+// index m_end designates the extra m_frontEvt location
+#define QF_LFQ_CELL_(q_, i_) \
+    (((i_) == (q_).m_end) ? &(q_).m_frontEvt : &QF_PTR_AT_((q_).m_ring, (i_)))
+
+// advance the ring-buffer index @p i_ counter clockwise
+#define QF_LFQ_NEXT_(q_, i_) (((i_) == 0U) ? (q_).m_end : ((i_) - 1U))
+
+//............................................................................
+void QF_lfqWakeup_(int * const ftx) noexcept {
+    // was the consumer thread parked (or about to park)?
+    if (__atomic_exchange_n(ftx, 0, __ATOMIC_SEQ_CST) != 0) {
+        syscall(SYS_futex, ftx, FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+    }
+}
+
+//............................................................................
+#ifdef Q_SPY
+bool QActive::post_(QEvt const * const e,
+                    std::uint_fast16_t const margin,
+                    void const * const sender) noexcept
+#else
+bool QActive::post_(QEvt const * const e,
+                    std::uint_fast16_t const margin) noexcept
+#endif
+{
+    /// @pre event pointer must be valid
+    Q_REQUIRE_ID(100, e != nullptr);
+
+    // reserve one free entry in the ring, honoring the requested margin
+    QEQueueCtr nFree = __atomic_load_n(&m_eQueue.m_nFree, __ATOMIC_RELAXED);
+    bool status;
+    for (;;) {
+        if (margin == QF_NO_MARGIN) {
+            // must be able to post the event
+            Q_ASSERT_ID(110, nFree > 0U);
+        }
+        else if (nFree <= static_cast<QEQueueCtr>(margin)) {
+            status = false; // cannot post, but don't assert
+            break;
+        }
+        if (__atomic_compare_exchange_n(&m_eQueue.m_nFree, &nFree,
+                static_cast<QEQueueCtr>(nFree - 1U), true,
+                __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+        {
+            status = true; // the entry is reserved
+            break;
+        }
+    }
+
+    // is it a dynamic event?
+    if (e->poolId_ != 0U) {
+#ifdef QF_ATOMIC_EVT_REF_CTR
+        QF_EVT_REF_CTR_INC_(e); // atomic increment of the reference counter
+#else
+        QF_CRIT_STAT_
+        QF_CRIT_ENTRY_();
+        QF_EVT_REF_CTR_INC_(e); // increment the reference counter
+        QF_CRIT_EXIT_();
+#endif
+    }
+
+    if (status) { // can post the event?
+
+        --nFree;  // one free entry just used up
+
+        // update the low-watermark (minimum so far)
+        QEQueueCtr nMin = __atomic_load_n(&m_eQueue.m_nMin, __ATOMIC_RELAXED);
+        while ((nMin > nFree)
+               && !__atomic_compare_exchange_n(&m_eQueue.m_nMin, &nMin,
+                       nFree, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        {}
+
+        QS_BEGIN_PRE_(QS_QF_ACTIVE_POST,
+                      QS::priv_.locFilter[QS::AO_OBJ], this)
+            QS_TIME_PRE_();               // timestamp
+            QS_OBJ_PRE_(sender);          // the sender object
+            QS_SIG_PRE_(e->sig);          // the signal of the event
+            QS_OBJ_PRE_(this);            // this active object
+            QS_2U8_PRE_(e->poolId_, e->refCtr_); // pool Id & refCtr of the evt
+            QS_EQC_PRE_(nFree);           // number of free entries
+            QS_EQC_PRE_(nMin < nFree ? nMin : nFree); // min # free entries
+        QS_END_PRE_()
+
+        // claim the cell at the head of the ring...
+        QEQueueCtr head = __atomic_load_n(&m_eQueue.m_head, __ATOMIC_RELAXED);
+        while (!__atomic_compare_exchange_n(&m_eQueue.m_head, &head,
+                   QF_LFQ_NEXT_(m_eQueue, head), true,
+                   __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        {}
+
+        // ...and publish the event in the claimed cell
+        __atomic_store_n(QF_LFQ_CELL_(m_eQueue, head), e, __ATOMIC_SEQ_CST);
+        QF_lfqWakeup_(&m_osObject);
+    }
+    else { // cannot post the event
+
+        QS_BEGIN_PRE_(QS_QF_ACTIVE_POST_ATTEMPT,
+                      QS::priv_.locFilter[QS::AO_OBJ], this)
+            QS_TIME_PRE_();           // timestamp
+            QS_OBJ_PRE_(sender);      // the sender object
+            QS_SIG_PRE_(e->sig);      // the signal of the event
+            QS_OBJ_PRE_(this);        // this active object
+            QS_2U8_PRE_(e->poolId_, e->refCtr_); // pool Id & refCtr of the evt
+            QS_EQC_PRE_(nFree);       // number of free entries
+            QS_EQC_PRE_(margin);      // margin requested
+        QS_END_PRE_()
+
+        QF::gc(e); // recycle the event to avoid a leak
+    }
+
+    return status;
 }
+//............................................................................
+void QActive::postLIFO(QEvt const * const e) noexcept {
+    // the queue must be able to accept the event (cannot overflow)
+    QEQueueCtr const nFree =
+        __atomic_sub_fetch(&m_eQueue.m_nFree, 1U, __ATOMIC_ACQUIRE);
+    Q_ASSERT_ID(210, nFree != static_cast<QEQueueCtr>(~0U));
+
+    QEQueueCtr nMin = __atomic_load_n(&m_eQueue.m_nMin, __ATOMIC_RELAXED);
+    while ((nMin > nFree)
+           && !__atomic_compare_exchange_n(&m_eQueue.m_nMin, &nMin,
+                   nFree, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    {}
+
+    // is it a dynamic event?
+    if (e->poolId_ != 0U) {
+#ifdef QF_ATOMIC_EVT_REF_CTR
+        QF_EVT_REF_CTR_INC_(e); // atomic increment of the reference counter
+#else
+        QF_CRIT_STAT_
+        QF_CRIT_ENTRY_();
+        QF_EVT_REF_CTR_INC_(e); // increment the reference counter
+        QF_CRIT_EXIT_();
 #endif
+    }
+
+    QS_BEGIN_PRE_(QS_QF_ACTIVE_POST_LIFO,
+                  QS::priv_.locFilter[QS::AO_OBJ], this)
+        QS_TIME_PRE_();                      // timestamp
+        QS_SIG_PRE_(e->sig);                 // the signal of this event
+        QS_OBJ_PRE_(this);                   // this active object
+        QS_2U8_PRE_(e->poolId_, e->refCtr_); // pool Id & refCtr of the evt
+        QS_EQC_PRE_(nFree);                  // number of free entries
+        QS_EQC_PRE_(m_eQueue.m_nMin);        // min number of free entries
+    QS_END_PRE_()
+
+    // only the consumer thread moves the tail, so the cell just behind
+    // the tail can be taken without any further synchronization
+    QEQueueCtr tail = m_eQueue.m_tail;
+    tail = (tail == m_eQueue.m_end) ? 0U : (tail + 1U);
+    m_eQueue.m_tail = tail;
+    __atomic_store_n(QF_LFQ_CELL_(m_eQueue, tail), e, __ATOMIC_SEQ_CST);
+}
+//............................................................................
+QEvt const *QActive::get_(void) noexcept {
+    QEvt const *e;
+
+    // single-location queue (e.g., QTicker)? see NOTE06
+    if (m_eQueue.m_end == 0U) {
+        QF_CRIT_STAT_
+        QF_CRIT_ENTRY_();
+        while (m_eQueue.m_frontEvt == nullptr) {
+            __atomic_store_n(&m_osObject, 1, __ATOMIC_SEQ_CST);
+            QF_CRIT_EXIT_();
+            syscall(SYS_futex, &m_osObject, FUTEX_WAIT_PRIVATE, 1,
+                    nullptr, nullptr, 0);
+            QF_CRIT_ENTRY_();
+        }
+        e = m_eQueue.m_frontEvt;
+        m_eQueue.m_frontEvt = nullptr;
+        __atomic_add_fetch(&m_eQueue.m_nFree, 1U, __ATOMIC_RELEASE);
+        QF_CRIT_EXIT_();
+    }
+    else {
+        QEvt const * volatile * const cell =
+            QF_LFQ_CELL_(m_eQueue, m_eQueue.m_tail);
+        e = __atomic_load_n(cell, __ATOMIC_ACQUIRE);
+        while (e == nullptr) { // nothing published in the tail cell yet?
+            __atomic_store_n(&m_osObject, 1, __ATOMIC_SEQ_CST);
+            e = __atomic_load_n(cell, __ATOMIC_SEQ_CST);
+            if (e == nullptr) { // still empty? park the thread
+                syscall(SYS_futex, &m_osObject, FUTEX_WAIT_PRIVATE, 1,
+                        nullptr, nullptr, 0);
+                e = __atomic_load_n(cell, __ATOMIC_ACQUIRE);
+            }
+        }
+        __atomic_store_n(cell, nullptr, __ATOMIC_RELAXED);
+        m_eQueue.m_tail = QF_LFQ_NEXT_(m_eQueue, m_eQueue.m_tail);
+
+        // release the entry to the producers
+        QEQueueCtr const nFree =
+            __atomic_add_fetch(&m_eQueue.m_nFree, 1U, __ATOMIC_RELEASE);
+
+        QS_BEGIN_PRE_(QS_QF_ACTIVE_GET,
+                      QS::priv_.locFilter[QS::AO_OBJ], this)
+            QS_TIME_PRE_();                      // timestamp
+            QS_SIG_PRE_(e->sig);                 // the signal of this event
+            QS_OBJ_PRE_(this);                   // this active object
+            QS_2U8_PRE_(e->poolId_, e->refCtr_); // pool Id & refCtr of evt
+            QS_EQC_PRE_(nFree);                  // number of free entries
+        QS_END_PRE_()
+        static_cast<void>(nFree); // unused parameter when QS is disabled
+    }
+    return e;
+}
+
+#endif // QF_LOCKFREE_EQUEUE
 
 //............................................................................
+#ifndef QF_POOL_THREADS
 static void *ao_thread(void *arg) { // the expected POSIX signature
-    QF::thread_(static_cast<QActive *>(arg));
+    QActive * const act = static_cast<QActive *>(arg);
+#if (defined Q_SPY) && (defined QS_THREAD_BUF)
+    QS::initThrBuf(&l_qsThrBuf[act->m_prio], &l_qsThrSto[act->m_prio][0],
+                   sizeof(l_qsThrSto[0]));
+#endif
+    QF::thread_(act);
     return nullptr; // return success
 }
+#else // QF_POOL_THREADS
+//****************************************************************************
+// thread routine of the worker threads executing the AOs, see NOTE5
+static void *pool_thread(void *arg) { // the expected POSIX signature
+    std::uint_fast8_t const w = static_cast<std::uint_fast8_t>(
+                                    reinterpret_cast<std::uintptr_t>(arg));
+#if (defined Q_SPY) && (defined QS_THREAD_BUF)
+    QS::initThrBuf(&l_qsThrBuf[w], &l_qsThrSto[w][0], sizeof(l_qsThrSto[0]));
+#endif
+
+    QF_CRIT_STAT_
+    QF_CRIT_ENTRY_();
+    while (l_isRunning) {
+        std::uint_fast8_t p = 0U;
+        if (l_poolReady[w].notEmpty()) { // any AOs ready at this worker?
+            p = l_poolReady[w].findMax();
+            l_poolReady[w].rmove(p);
+        }
+        else { // steal the highest-priority AO ready at another worker
+            std::uint_fast8_t victim = w;
+            for (std::uint_fast8_t v = 0U; v < QF_POOL_THREADS; ++v) {
+                if ((v != w) && l_poolReady[v].notEmpty()) {
+                    std::uint_fast8_t const q = l_poolReady[v].findMax();
+                    if (q > p) {
+                        p = q;
+                        victim = v;
+                    }
+                }
+            }
+            if (p != 0U) {
+                l_poolReady[victim].rmove(p);
+                l_poolHome[p] = static_cast<std::uint8_t>(w); // new home
+            }
+        }
+
+        if (p != 0U) { // found an AO to run?
+            QActive * const a = QF::active_[p];
+            QF_CRIT_EXIT_();
+
+            // the active object 'a' must still be registered in QF
+            Q_ASSERT_ID(320, a != nullptr);
+
+            // perform the run-to-completion (RTC) step...
+#ifdef QF_EVT_BURST
+            burstDispatch(a); // the queue cannot be empty (NOTE07)
+#else
+            QEvt const *e = a->get_(); // the queue cannot be empty
+            a->dispatch(e);
+            QF::gc(e);
+#endif
+
+#ifdef QF_ACTIVE_STOP
+            if (!a->m_thread) { // the AO stopped itself?
+                QF::remove_(a);
+            }
+#endif
+            QF_CRIT_ENTRY_();
+            if ((QF::active_[p] == a) && (!a->m_eQueue.isEmpty())) {
+                // more events? let the other workers steal the AOs
+                // already waiting at this worker and run 'a' again later
+                if (l_poolReady[w].notEmpty()) {
+                    poolWake(w);
+                }
+                l_poolReady[w].insert(p);
+            }
+            else {
+                l_poolBusy[p] = false; // not ready, not running
+            }
+        }
+        else { // no AOs ready anywhere, wait for some
+            l_poolIdle[w] = true;
+            pthread_cond_wait(&l_poolCond[w], &QF_pThreadMutex_);
+            l_poolIdle[w] = false;
+        }
+    }
+    QF_CRIT_EXIT_();
+    return nullptr; // return success
+}
+//............................................................................
+// wake up the worker @p w, or any other idle worker (must be called from
+// the QF critical section)
+static void poolWake(std::uint_fast8_t const w) {
+    std::uint_fast8_t i = w;
+    if (!l_poolIdle[i]) {
+        for (i = 0U; (i < QF_POOL_THREADS) && (!l_poolIdle[i]); ++i) {
+        }
+    }
+    if (i < QF_POOL_THREADS) { // idle worker found?
+        l_poolIdle[i] = false; // don't wake the same worker again
+        pthread_cond_signal(&l_poolCond[i]);
+    }
+}
+//............................................................................
+void QF_poolSchedule_(std::uint_fast8_t const prio) noexcept {
+    if (!l_poolBusy[prio]) { // AO neither ready nor running?
+        l_poolBusy[prio] = true;
+        std::uint_fast8_t const w = l_poolHome[prio];
+        l_poolReady[w].insert(prio);
+        poolWake(w);
+    }
+}
+#endif // QF_POOL_THREADS
+
+#ifdef QF_TICK_DOMAINS
+//****************************************************************************
+void QF_setTickDomain(std::uint_fast8_t const tickRate,
+                      std::uint32_t const ticksPerSec, int_t const tickPrio)
+{
+    // the tick domains can be configured only before QF::run()
+    Q_REQUIRE_ID(350, (tickRate < QF_MAX_TICK_RATE) && (!l_isRunning));
+    l_domPeriod[tickRate] = (ticksPerSec != 0U)
+        ? (static_cast<std::uint64_t>(NANOSLEEP_NSEC_PER_SEC) / ticksPerSec)
+        : 0U; // ticksPerSec == 0 means "no domain"
+    l_domPrio[tickRate] = tickPrio;
+}
+//............................................................................
+void QF_getTickDomainStat(std::uint_fast8_t const tickRate,
+                          QF_TickDomainStat * const stat)
+{
+    Q_REQUIRE_ID(360, tickRate < QF_MAX_TICK_RATE);
+    QF_CRIT_STAT_
+    QF_CRIT_ENTRY_();
+    *stat = l_domStat[tickRate];
+    QF_CRIT_EXIT_();
+}
+//............................................................................
+// thread routine of a tick domain, see NOTE6 in qf_port.hpp
+static void *tickDomain_thread(void *arg) { // the expected POSIX signature
+    std::uint_fast8_t const r = static_cast<std::uint_fast8_t>(
+                                    reinterpret_cast<std::uintptr_t>(arg));
+    std::uint64_t const period = l_domPeriod[r];
+#if (defined Q_SPY) && (defined QS_THREAD_BUF)
+    QS::initThrBuf(&l_qsTickBuf[r + 1U], &l_qsTickSto[r + 1U][0],
+                   sizeof(l_qsTickSto[0]));
+#endif
+
+    // # clock ticks between the QS reports of the statistics (about 1s)
+    std::uint32_t nReport = static_cast<std::uint32_t>(
+        static_cast<std::uint64_t>(NANOSLEEP_NSEC_PER_SEC) / period);
+    if (nReport == 0U) {
+        nReport = 1U;
+    }
+
+    // try to set the priority of the tick domain thread, see NOTE01
+    struct sched_param sparam;
+    sparam.sched_priority = l_domPrio[r];
+    if (pthread_setschedparam(pthread_self(), SCHED_FIFO, &sparam) == 0) {
+        // success, this application has sufficient privileges
+    }
+    else {
+        // setting priority failed, probably due to insufficient privieges
+    }
+
+    std::uint64_t deadline = monotonicNow() + period;
+    while (l_isRunning) {
+        struct timespec ts;
+        ts.tv_sec  = static_cast<time_t>(deadline / NANOSLEEP_NSEC_PER_SEC);
+        ts.tv_nsec = static_cast<long>(deadline % NANOSLEEP_NSEC_PER_SEC);
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL)
+               == EINTR)
+        {}
+
+        std::uint64_t const start = monotonicNow();
+        QF::TICK_X(r, &l_domStat[r]); // process the clock tick of the domain
+        std::uint64_t const busy = monotonicNow() - start;
+        std::uint64_t const late = start - deadline;
+        deadline += period; // the next deadline (missed ticks not sleeping)
+
+        QF_CRIT_STAT_
+        QF_CRIT_ENTRY_();
+        QF_TickDomainStat * const stat = &l_domStat[r];
+        ++stat->nTicks;
+        if (late >= period) {
+            ++stat->nOverruns;
+        }
+        if ((late / 1000U) > stat->maxLate) {
+            stat->maxLate = static_cast<std::uint32_t>(late / 1000U);
+        }
+        if (busy > stat->maxBusy) {
+            stat->maxBusy = static_cast<std::uint32_t>(busy);
+        }
+        stat->sumBusy += busy;
+
+        if ((stat->nTicks % nReport) == 0U) { // time to report the stats?
+            QS_BEGIN_NOCRIT_PRE_(QS_QF_TICK_STAT, nullptr, nullptr)
+                QS_TIME_PRE_();              // timestamp
+                QS_U8_PRE_(r);               // tick rate of the domain
+                QS_U32_PRE_(stat->nTicks);   // # clock ticks processed
+                QS_U32_PRE_(stat->nOverruns);// # ticks a whole period late
+                QS_U32_PRE_(stat->maxLate);  // max lateness [us]
+                QS_U32_PRE_(stat->maxBusy);  // max processing time [ns]
+                QS_U32_PRE_(stat->sumBusy / stat->nTicks); // average [ns]
+            QS_END_NOCRIT_PRE_()
+        }
+        QF_CRIT_EXIT_();
+    }
+    return nullptr; // return success
+}
+#endif // QF_TICK_DOMAINS
 
 //****************************************************************************
 static void sigIntHandler(int /* dummy */) {
@@ -320,4 +891,46 @@ static void sigIntHandler(int /* dummy */) {
 // deliver only 2*actual-system-tick granularity. To compensate for this,
 // you would need to reduce (by 2) the constant NANOSLEEP_NSEC_PER_SEC.
 //
+// NOTE06:
+// With QF_LOCKFREE_EQUEUE, the QEQueue of every active object is used as a
+// bounded multiple-producer/single-consumer ring of m_end+1 cells, in which
+// the cell with the index m_end is the m_frontEvt location. This preserves
+// the total capacity (qLen + 1) and the meaning of the 'margin' argument.
+// The producers first reserve an entry by a CAS-decrement of m_nFree (which
+// fails the post if the margin cannot be honored), then update the m_nMin
+// low-watermark, claim a cell by a CAS on m_head, publish the event pointer
+// in that cell and finally wake up the consumer if it has been parked.
+// The single consumer (the AO thread) owns m_tail. It waits until the tail
+// cell becomes non-NULL, clears the cell and only then returns the entry
+// to the producers by an atomic increment of m_nFree. Because the number
+// of claimed cells never exceeds the number of reserved entries, a producer
+// can never overwrite a cell that has not been consumed yet.
+//
+// The consumer is parked on the futex word m_osObject: it sets the word to
+// 1 and re-checks the tail cell before calling FUTEX_WAIT, while a producer
+// exchanges the word with 0 after publishing the event and issues
+// FUTEX_WAKE only if the word was set. Both sides use sequentially-
+// consistent operations, so a wakeup can never be lost.
+//
+// QActive::postLIFO() is allowed only from the thread of the AO itself
+// (e.g., QActive::recall()), which is the only thread moving m_tail.
+// Queues without a ring buffer (qLen == 0), such as the queue of QTicker,
+// use the critical section in QActive::get_(), because QTicker::post_()
+// manipulates the m_frontEvt location directly.
+//
+// NOTE07:
+// With QF_EVT_BURST, the AO threads (or the worker threads with
+// QF_POOL_THREADS) remove up to QActive::setBurst() events from the queue
+// of the AO in one critical section (QActive::getBurst_()) and dispatch
+// them outside the critical section, so that the global mutex is locked
+// once per burst instead of once per event. The events are still processed
+// strictly one at a time and in the FIFO order. A worker of the pool keeps
+// the other AOs waiting for the whole burst, so the burst limit of an AO
+// also bounds the delay of the other AOs at the same worker. When the AO
+// stops itself (QF_ACTIVE_STOP) in the middle of a burst, the remaining
+// events of the burst are only garbage-collected. The limit is 1 unless
+// the AO opts in with QActive::setBurst(). A bursting AO must not recall
+// deferred events or receive LIFO posts, because the burst is taken off the
+// queue up front and such an event would be dispatched after all of it.
+//
 
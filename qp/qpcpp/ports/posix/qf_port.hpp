@@ -40,14 +40,20 @@
 
 // event queue and thread types
 #define QF_EQUEUE_TYPE        QEQueue
-#define QF_OS_OBJECT_TYPE     pthread_cond_t
+#ifndef QF_LOCKFREE_EQUEUE
+    #define QF_OS_OBJECT_TYPE pthread_cond_t
+#else // lock-free event queues of active objects, see NOTE2
+    #define QF_OS_OBJECT_TYPE int
+#endif
 #define QF_THREAD_TYPE        bool
 
 // The maximum number of active objects in the application
 #define QF_MAX_ACTIVE         64U
 
-// The number of system clock tick rates
+// The number of system clock tick rates (can be raised up to 15U)
+#ifndef QF_MAX_TICK_RATE
 #define QF_MAX_TICK_RATE      2U
+#endif
 
 // Activate the QF QActive::stop() API
 #define QF_ACTIVE_STOP        1
@@ -79,8 +85,47 @@ void QF_leaveCriticalSection_(void);
 // set clock tick rate and p-thread priority
 void QF_setTickRate(uint32_t ticksPerSec, int_t tickPrio);
 
+#ifndef QF_TICKLESS
 // clock tick callback (provided in the app)
 void QF_onClockTick(void);
+#else
+// "tickless" clock tick callback (provided in the app), called once for
+// all nTicks clock ticks elapsed since the last call, see NOTE3
+void QF_onClockTick(QTimeEvtCtr const nTicks);
+#endif // QF_TICKLESS
+
+#ifdef QF_TICKLESS
+// statistics of the "tickless" clock tick processing, see NOTE3
+struct QF_TickStat {
+    std::uint32_t nWakeups;  // # wake-ups of the clock tick loop
+    std::uint32_t nTicks;    // # clock ticks processed (QF_onClockTick())
+    std::uint32_t nSkipped;  // # clock ticks skipped (no time events armed)
+    std::uint32_t nOverruns; // # clock ticks processed a whole tick late
+    std::uint32_t maxLate;   // maximum lateness of a clock tick [us]
+};
+
+// obtain the statistics of the "tickless" clock tick processing
+void QF_getTickStat(QF_TickStat * const stat);
+#endif // QF_TICKLESS
+
+#ifdef QF_TICK_DOMAINS
+// statistics of an independently clocked tick domain, see NOTE6
+struct QF_TickDomainStat {
+    std::uint32_t nTicks;    // # clock ticks processed (QF::TICK_X())
+    std::uint32_t nOverruns; // # clock ticks processed a whole period late
+    std::uint32_t maxLate;   // maximum lateness of a clock tick [us]
+    std::uint32_t maxBusy;   // maximum processing time of a clock tick [ns]
+    std::uint64_t sumBusy;   // total processing time of all clock ticks [ns]
+};
+
+// clock the tick rate @p tickRate by its own timer source and p-thread
+void QF_setTickDomain(std::uint_fast8_t const tickRate,
+                      std::uint32_t const ticksPerSec, int_t const tickPrio);
+
+// obtain the statistics of the tick domain of the tick rate @p tickRate
+void QF_getTickDomainStat(std::uint_fast8_t const tickRate,
+                          QF_TickDomainStat * const stat);
+#endif // QF_TICK_DOMAINS
 
 // abstractions for console access...
 void QF_consoleSetup(void);
@@ -102,7 +147,28 @@ extern pthread_mutex_t QF_pThreadMutex_; // mutex for QF critical section
     #define QF_SCHED_LOCK_(dummy) ((void)0)
     #define QF_SCHED_UNLOCK_()    ((void)0)
 
+#ifdef QF_POOL_THREADS
+    #ifdef QF_LOCKFREE_EQUEUE
+        #error "QF_POOL_THREADS cannot be combined with QF_LOCKFREE_EQUEUE"
+    #endif
+
+    // event queue operations for AOs executed by the worker threads, NOTE5
+    #define QF_NATIVE_EQUEUE_ // AO queues fully managed by QF
+    #define QACTIVE_EQUEUE_WAIT_(me_) \
+        Q_ASSERT_ID(400, (me_)->m_eQueue.m_frontEvt != nullptr)
+
+    #define QACTIVE_EQUEUE_SIGNAL_(me_) \
+        Q_ASSERT_ID(410, QF::active_[(me_)->m_prio] != nullptr); \
+        QF_poolSchedule_((me_)->m_prio)
+
+    namespace QP {
+        // make the AO of priority @p prio ready to run on a worker thread
+        void QF_poolSchedule_(std::uint_fast8_t const prio) noexcept;
+    } // namespace QP
+
+#elif (!defined QF_LOCKFREE_EQUEUE)
     // native event queue operations...
+    #define QF_NATIVE_EQUEUE_ // AO queues fully managed by QF
     #define QACTIVE_EQUEUE_WAIT_(me_) \
         while ((me_)->m_eQueue.m_frontEvt == nullptr) \
             pthread_cond_wait(&(me_)->m_osObject, &QF_pThreadMutex_)
@@ -111,6 +177,39 @@ extern pthread_mutex_t QF_pThreadMutex_; // mutex for QF critical section
         Q_ASSERT_ID(410, QF::active_[(me_)->m_prio] != nullptr); \
         pthread_cond_signal(&(me_)->m_osObject) \
 
+#else
+    #ifndef __linux__
+        #error "QF_LOCKFREE_EQUEUE requires the Linux futex(2) system call"
+    #endif
+
+    // lock-free event queue operations (used only by QTicker)...
+    #define QACTIVE_EQUEUE_SIGNAL_(me_) \
+        Q_ASSERT_ID(410, QF::active_[(me_)->m_prio] != nullptr); \
+        QF_lfqWakeup_(&(me_)->m_osObject)
+
+    namespace QP {
+        // wake up the AO thread parked on the futex @p ftx
+        void QF_lfqWakeup_(int * const ftx) noexcept;
+    } // namespace QP
+
+#endif // QF_LOCKFREE_EQUEUE
+
+#if (defined QF_TICK_DOMAINS) && (defined QF_TICKLESS)
+    #error "QF_TICK_DOMAINS cannot be combined with QF_TICKLESS"
+#endif
+
+#ifdef QF_TICKLESS
+    // "tickless" clock: compensate for the clock ticks not processed yet
+    #define QF_TIMEEVT_ARM_(tickRate_, nTicks_) \
+        QF_ticklessArm_((tickRate_), (nTicks_))
+
+    namespace QP {
+        // adjust the number of ticks of a time event being armed
+        QTimeEvtCtr QF_ticklessArm_(std::uint_fast8_t const tickRate,
+                                    QTimeEvtCtr const nTicks) noexcept;
+    } // namespace QP
+#endif // QF_TICKLESS
+
     // event pool operations...
     #define QF_EPOOL_TYPE_  QMPool
 
@@ -154,6 +253,93 @@ extern pthread_mutex_t QF_pThreadMutex_; // mutex for QF critical section
 // implementation, such as POSIX threads, should support the priority-
 // inheritance protocol.
 //
+// NOTE2:
+// Defining the macro QF_LOCKFREE_EQUEUE (e.g., -DQF_LOCKFREE_EQUEUE on the
+// compiler command line) replaces the mutex-protected event queues of active
+// objects with bounded lock-free multiple-producer/single-consumer rings.
+// In this mode QActive::post_(), QActive::postLIFO() and QActive::get_()
+// are provided by this port (qf_port.cpp) instead of qf_actq.cpp, and the
+// QF_OS_OBJECT_TYPE becomes a futex word used to park the AO thread when
+// its queue is empty. The global QF_pThreadMutex_ is still used for all
+// other critical sections (e.g., event pools, reference counting of
+// dynamic events, time events and QS tracing). This mode requires Linux.
+//
+// NOTE3:
+// Defining the macro QF_TICKLESS replaces the fixed-period clock tick loop
+// in QF::run() with a "tickless" loop. The loop finds out from the armed
+// time events when the nearest timeout expires (QF::nextTimeoutX()) and
+// sleeps until that absolute deadline on CLOCK_MONOTONIC, so no clock
+// ticks are generated while no timeouts are pending. After every wake-up
+// the loop calls QF_onClockTick(nTicks) once with the number of clock
+// ticks that elapsed since the last processed tick (catching up after
+// oversleeping), which must process them all in one pass with
+// QF::TICK_N(0U, nTicks, &sender). The ticks that elapsed with no time
+// events armed at all are skipped.
+// Arming a time event wakes up the loop when the new timeout is sooner
+// and compensates for the elapsed clock ticks, which the loop has not
+// taken for processing yet (see QF_TIMEEVT_ARM_()). The loop takes the
+// ticks and marks them with QF::tickMark_() in one critical section, so
+// QF::TICK_N() does not count down the time events armed afterwards once
+// more. The lateness of the processed ticks is
+// collected in the QF_TickStat statistics (see QF_getTickStat()).
+//
+// Please note that in this mode QF_onClockTick() is NOT called periodically,
+// so it should not be used for polling of I/O (such as the console).
+// Also, the compensation is exact only for the tick rate 0, which must be
+// serviced in every QF_onClockTick() call. The loop is implemented in
+// ports/posix/qf_clock.hpp, which is shared by the POSIX and POSIX-QV ports.
+//
+// NOTE4:
+// Defining the macro QS_THREAD_BUF (with Q_SPY) gives every AO thread (or
+// pool worker thread), the ticker thread running QF::run() and every tick
+// domain thread its own QS buffer of QS_THREAD_BUF_SIZE bytes (see
+// QS::initThrBuf()). These threads then write their QS records without
+// entering the critical section and the records are merged into the main
+// QS buffer in the time stamp order when the QS data is output
+// (QS::getBlock()). The time stamp order holds ONLY among these threads.
+// All other threads (e.g., the threads created by the application, or the
+// main thread before it calls QF::run()) still write their records directly
+// to the main QS buffer, so such a record can precede the buffered records
+// with earlier time stamps that are not merged yet. (The QS output thread,
+// see QS_TX_THREAD, produces no QS records.) A record longer than
+// QS_THREAD_REC_MAX bytes (e.g., a long string) must not be produced by
+// a thread with its own buffer, and the records that do not fit into
+// a thread buffer are dropped.
+//
+// NOTE5:
+// Defining the macro QF_POOL_THREADS as the number of worker threads (e.g.,
+// -DQF_POOL_THREADS=4U) executes all active objects on that many worker
+// threads, which QF::run() starts, instead of one p-thread per active
+// object. An active object with events becomes "ready" at its home worker
+// (QF_poolSchedule_()) and a worker executes one RTC step of the
+// highest-priority ready AO at a time. An idle worker "steals" the
+// highest-priority ready AO from the other workers, and that AO stays at
+// its new home worker. Every AO is either ready at exactly one worker,
+// running on exactly one worker, or waiting for events, so the RTC steps of
+// one AO never run in parallel. The ready sets are protected by the QF
+// critical section, which QActive::post_() holds already anyway.
+// The priority of an AO is a scheduling preference, not a preemption:
+// a high-priority AO waits until a worker finishes its current RTC step.
+//
+// NOTE6:
+// Defining the macro QF_TICK_DOMAINS allows any tick rate to be clocked
+// independently of the QF_onClockTick() loop in QF::run(). The tick rate
+// configured by QF_setTickDomain() (before QF::run()) gets its own timer
+// source and its own p-thread with the given priority. The thread sleeps
+// until the absolute deadlines on CLOCK_MONOTONIC (so the period does not
+// drift) and calls QF::TICK_X() for its tick rate directly, so a slow tick
+// rate with a long list of time events never delays the expirations in a
+// faster tick rate. A tick processed late is followed by the missed ticks
+// without sleeping. The tick rates clocked this way must NOT be serviced
+// in QF_onClockTick(), which keeps servicing the other tick rates (and
+// polling of the console). To have more independent tick domains, raise
+// QF_MAX_TICK_RATE (e.g., -DQF_MAX_TICK_RATE=4U).
+//
+// Every tick domain collects the lateness and the processing time of its
+// clock ticks in the QF_TickDomainStat statistics (QF_getTickDomainStat())
+// and, with Q_SPY, reports them about once per second in the QS record
+// QP::QS_QF_TICK_STAT (part of the QS_QF_RECORDS group).
+//
 
 #endif // QF_PORT_HPP
 
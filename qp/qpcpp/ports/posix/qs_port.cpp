@@ -2,8 +2,8 @@
 /// @brief QS/C++ port to POSIX API
 /// @cond
 ///***************************************************************************
-/// Last updated for version 6.8.0
-/// Last updated on  2020-03-31
+/// Last updated for version 6.8.2
+/// Last updated on  2020-07-17
 ///
 ///                    Q u a n t u m  L e a P s
 ///                    ------------------------
@@ -58,6 +58,11 @@
 #include <time.h>
 #include <unistd.h>
 #include <fcntl.h>
+#ifdef QS_TX_THREAD
+    #include <pthread.h>     // for the QS output thread
+    #include <poll.h>        // for poll()
+    #include <sys/uio.h>     // for struct iovec
+#endif
 
 #define QS_TX_SIZE     (8*1024)
 #define QS_RX_SIZE     (2*1024)
@@ -75,9 +80,15 @@ namespace QP {
 static int l_sock = INVALID_SOCKET;
 static struct timespec const c_timeout = { 0, QS_TIMEOUT_MS*1000000L };
 
+#ifdef QS_TX_THREAD
+#include "qs_tx_thread.hpp" // QS output thread, see NOTE1 in there
+#endif
+
 //............................................................................
 bool QS::onStartup(void const *arg) {
+#ifndef QS_TX_THREAD
     static uint8_t qsBuf[QS_TX_SIZE];   // buffer for QS-TX channel
+#endif
     static uint8_t qsRxBuf[QS_RX_SIZE]; // buffer for QS-RX channel
     char hostName[128];
     char const *serviceName = "6601";   // default QSPY server port
@@ -91,7 +102,11 @@ bool QS::onStartup(void const *arg) {
     int sockopt_bool;
 
     // initialize the QS transmit and receive buffers
+#ifdef QS_TX_THREAD
+    txInitBuf(); // the QS buffers of the QS output thread
+#else
     initBuf(qsBuf, sizeof(qsBuf));
+#endif
     rxInitBuf(qsRxBuf, sizeof(qsRxBuf));
 
     // extract hostName from 'arg' (hostName:port_remote)...
@@ -175,6 +190,17 @@ bool QS::onStartup(void const *arg) {
 
     //PRINTF_S("<TARGET> Connected to QSPY at Host=%s:%d\n",
     //         hostName, port_remote);
+
+#ifdef QS_TX_THREAD
+    if (!txStart()) {
+        FPRINTF_S(stderr, "%s\n",
+            "<TARGET> ERROR   cannot create the QS output thread");
+        close(l_sock);
+        l_sock = INVALID_SOCKET;
+        goto error;
+    }
+#endif // QS_TX_THREAD
+
     onFlush();
 
     return true;  // success
@@ -184,6 +210,9 @@ error:
 }
 //............................................................................
 void QS::onCleanup(void) {
+#ifdef QS_TX_THREAD
+    txStop(); // let the output thread send all data and exit
+#endif // QS_TX_THREAD
     if (l_sock != INVALID_SOCKET) {
         close(l_sock);
         l_sock = INVALID_SOCKET;
@@ -196,6 +225,16 @@ void QS::onReset(void) {
     exit(0);
 }
 //............................................................................
+#ifdef QS_TX_THREAD
+void QS::onFlush(void) {
+    if (l_sock == INVALID_SOCKET) { // socket NOT initialized?
+        FPRINTF_S(stderr, "%s\n", "<TARGET> ERROR   invalid TCP socket");
+        return;
+    }
+    txPump(true); // hand all QS data over to the output thread
+    txWaitFree(QS_TX_NBUF - 1U); // wait until all of it is sent out
+}
+#else
 void QS::onFlush(void) {
     uint16_t nBytes;
     uint8_t const *data;
@@ -242,6 +281,7 @@ void QS::onFlush(void) {
     }
     QS_CRIT_EXIT_();
 }
+#endif // QS_TX_THREAD
 //............................................................................
 QSTimeCtr QS::onGetTime(void) {
     struct timespec tspec;
@@ -254,6 +294,19 @@ QSTimeCtr QS::onGetTime(void) {
 }
 
 //............................................................................
+#ifdef QS_TX_THREAD
+void QS_output(void) {
+    if (l_sock == INVALID_SOCKET) { // socket NOT initialized?
+        FPRINTF_S(stderr, "%s\n", "<TARGET> ERROR   invalid TCP socket");
+        return;
+    }
+#ifdef QS_TX_BLOCK
+    txPump(true);  // wait for a free QS buffer when all are in use
+#else
+    txPump(false); // drop the QS buffer when all others are in use
+#endif
+}
+#else
 void QS_output(void) {
     uint16_t nBytes;
     uint8_t const *data;
@@ -301,6 +354,7 @@ void QS_output(void) {
         QS_CRIT_EXIT_();
     }
 }
+#endif // QS_TX_THREAD
 //............................................................................
 void QS_rx_input(void) {
     uint8_t buf[QS_RX_SIZE];
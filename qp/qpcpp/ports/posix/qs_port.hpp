@@ -62,5 +62,21 @@ void QS_rx_input(void);  // handle the QS-RX input
 #include "qf_port.hpp" // use QS with QF
 #include "qs.hpp"      // QS platform-independent public interface
 
+#ifdef QS_TX_THREAD
+namespace QP {
+
+// statistics of the QS output thread, see NOTE1 in qs_tx_thread.hpp
+struct QS_TxStat {
+    std::uint64_t nSent;    // # bytes sent to the host
+    std::uint64_t nDropped; // # bytes dropped (no buffer or socket error)
+    std::uint32_t maxUsed;  // maximum # bytes handed over and not sent yet
+};
+
+// obtain the statistics of the QS output thread
+void QS_getTxStat(QS_TxStat * const stat);
+
+} // namespace QP
+#endif // QS_TX_THREAD
+
 #endif // QS_PORT_HPP
 
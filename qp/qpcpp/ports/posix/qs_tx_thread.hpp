@@ -0,0 +1,358 @@
+/// @file
+/// @brief QS output thread shared by the POSIX and POSIX-QV ports
+/// @cond
+///***************************************************************************
+/// Last updated for version 6.8.2
+/// Last updated on  2020-07-17
+///
+///                    Q u a n t u m  L e a P s
+///                    ------------------------
+///                    Modern Embedded Software
+///
+/// Copyright (C) 2005-2020 Quantum Leaps. All rights reserved.
+///
+/// This program is open source software: you can redistribute it and/or
+/// modify it under the terms of the GNU General Public License as published
+/// by the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Alternatively, this program may be distributed and modified under the
+/// terms of Quantum Leaps commercial licenses, which expressly supersede
+/// the GNU General Public License and are specifically designed for
+/// licensees interested in retaining the proprietary status of their code.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program. If not, see <www.gnu.org/licenses>.
+///
+/// Contact information:
+/// <www.state-machine.com/licensing>
+/// <info@state-machine.com>
+///***************************************************************************
+/// @endcond
+///
+/// @note
+/// This file is not a separate module. It is included only in qs_port.cpp
+/// of the POSIX and POSIX-QV ports, inside the namespace QP and after the
+/// port's l_sock, QS_TX_SIZE, QS_TIMEOUT_MS and SOCKET_ERROR (<pthread.h>,
+/// <poll.h> and <sys/uio.h> must be included already).
+///
+#ifndef QS_TX_THREAD_HPP
+#define QS_TX_THREAD_HPP
+
+#ifndef QS_TX_NBUF
+    #define QS_TX_NBUF 8U // # QS buffers, must be a power of 2, see NOTE1
+#endif
+static_assert((QS_TX_NBUF >= 2U) && ((QS_TX_NBUF & (QS_TX_NBUF - 1U)) == 0U),
+              "QS_TX_NBUF must be a power of 2 of at least 2");
+
+// QS buffer handed over to the QS output thread, see NOTE1
+struct QSTxBlk {
+    struct iovec iov[2]; // data not sent yet (two parts when wrapped)
+    std::uint32_t nBytes; // # bytes not sent yet
+};
+
+// pool of the QS buffers; buffer l_txSto[i] is described by l_txBlk[i]
+static std::uint8_t l_txSto[QS_TX_NBUF][QS_TX_SIZE];
+static QSTxBlk l_txBlk[QS_TX_NBUF];
+
+// single-producer/single-consumer queues of the QS buffer indices, see NOTE1
+static std::uint8_t l_txSendQ[QS_TX_NBUF]; // buffers to send
+static std::uint32_t l_txSendHead;  // put into l_txSendQ (producers)
+static std::uint32_t l_txSendTail;  // taken from l_txSendQ (output thread)
+static std::uint8_t l_txFreeQ[QS_TX_NBUF]; // buffers sent out
+static std::uint32_t l_txFreeHead;  // put into l_txFreeQ (output thread)
+static std::uint32_t l_txFreeTail;  // taken from l_txFreeQ (producers)
+static std::uint8_t l_txCurr;       // the buffer currently used by QS
+static std::uint32_t l_txQueued;    // # bytes handed over and not sent yet
+
+static std::uint32_t l_txIdle;      // output thread waiting for data?
+static std::uint32_t l_txFull;      // # producers waiting for a buffer
+static bool l_txRunning;            // output thread running?
+static pthread_t l_txThread;        // the QS output thread
+static pthread_mutex_t l_txMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t l_txDataCond  = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t l_txSpaceCond = PTHREAD_COND_INITIALIZER;
+static QS_TxStat l_txStat;          // statistics of the QS output
+
+//****************************************************************************
+// give QS the first buffer from the pool (called from QS::onStartup())
+static void txInitBuf(void) {
+    QS::initBuf(&l_txSto[0][0], static_cast<std::uint_fast16_t>(QS_TX_SIZE));
+    l_txCurr = 0U;
+    for (std::uint8_t i = 1U; i < QS_TX_NBUF; ++i) {
+        l_txFreeQ[i - 1U] = i;
+    }
+    l_txFreeHead = QS_TX_NBUF - 1U;
+    l_txFreeTail = 0U;
+    l_txSendHead = 0U;
+    l_txSendTail = 0U;
+}
+//............................................................................
+// wait until at least 'need' buffers have been sent out and are free
+static void txWaitFree(std::uint32_t need) {
+    pthread_mutex_lock(&l_txMutex);
+    __atomic_fetch_add(&l_txFull, 1U, __ATOMIC_SEQ_CST);
+    while (l_txRunning
+           && ((__atomic_load_n(&l_txFreeHead, __ATOMIC_SEQ_CST)
+                - __atomic_load_n(&l_txFreeTail, __ATOMIC_SEQ_CST))
+               < need))
+    {
+        pthread_cond_wait(&l_txSpaceCond, &l_txMutex);
+    }
+    __atomic_fetch_sub(&l_txFull, 1U, __ATOMIC_SEQ_CST);
+    pthread_mutex_unlock(&l_txMutex);
+}
+//............................................................................
+// hand the QS buffer over to the output thread (producer side, NOTE1)
+static void txPump(bool block) {
+    QS_CRIT_STAT_
+    QS_CRIT_ENTRY_(); // serializes the producers
+
+    // merge the thread buffers (if any) without taking any data out
+    std::uint16_t nBytes = 0U;
+    static_cast<void>(QS::getBlock(&nBytes));
+
+    bool put = false;
+    while (QS::priv_.used != 0U) {
+        std::uint32_t const freeTail = l_txFreeTail;
+        if (__atomic_load_n(&l_txFreeHead, __ATOMIC_ACQUIRE) != freeTail) {
+            // take the QS data out of the current buffer in place...
+            QSTxBlk * const blk = &l_txBlk[l_txCurr];
+            std::uint32_t const used = QS::priv_.used;
+            std::uint32_t n = QS::priv_.end - QS::priv_.tail;
+            if (n > used) {
+                n = used;
+            }
+            blk->iov[0].iov_base = &QS::priv_.buf[QS::priv_.tail];
+            blk->iov[0].iov_len  = n;
+            blk->iov[1].iov_base = &QS::priv_.buf[0]; // wrapped part
+            blk->iov[1].iov_len  = used - n;
+            blk->nBytes = used;
+            l_txSendQ[l_txSendHead & (QS_TX_NBUF - 1U)] = l_txCurr;
+            __atomic_store_n(&l_txSendHead, l_txSendHead + 1U,
+                             __ATOMIC_SEQ_CST);
+
+            // ...and let QS continue in a free buffer
+            l_txCurr = l_txFreeQ[freeTail & (QS_TX_NBUF - 1U)];
+            __atomic_store_n(&l_txFreeTail, freeTail + 1U, __ATOMIC_SEQ_CST);
+            QS::priv_.buf  = &l_txSto[l_txCurr][0];
+            QS::priv_.head = 0U;
+            QS::priv_.tail = 0U;
+            QS::priv_.used = 0U;
+
+            std::uint32_t const queued =
+                __atomic_add_fetch(&l_txQueued, used, __ATOMIC_SEQ_CST);
+            if (queued > l_txStat.maxUsed) {
+                l_txStat.maxUsed = queued;
+            }
+            put = true;
+        }
+        else if (block) { // wait for the output thread
+            QS_CRIT_EXIT_();
+            txWaitFree(1U);
+            QS_CRIT_ENTRY_();
+            if (!l_txRunning) {
+                break;
+            }
+        }
+        else {
+            // QS buffer more than half full? drop all the (complete)
+            // records in it before QS starts to overwrite them
+            if (QS::priv_.used > (QS::priv_.end >> 1U)) {
+                __atomic_fetch_add(&l_txStat.nDropped,
+                    static_cast<std::uint64_t>(QS::priv_.used),
+                    __ATOMIC_RELAXED);
+                QS::priv_.head = 0U;
+                QS::priv_.tail = 0U;
+                QS::priv_.used = 0U;
+            }
+            break; // keep the records for the next time
+        }
+    }
+    QS_CRIT_EXIT_();
+
+    // new data handed over and the output thread idle? wake it up
+    if (put && (__atomic_load_n(&l_txIdle, __ATOMIC_SEQ_CST) != 0U)) {
+        pthread_mutex_lock(&l_txMutex);
+        pthread_cond_signal(&l_txDataCond);
+        pthread_mutex_unlock(&l_txMutex);
+    }
+}
+//............................................................................
+// the QS output thread (consumer side, NOTE1)
+static void *txThread(void * /*arg*/) {
+    std::uint32_t tail = l_txSendTail;
+    for (;;) {
+        std::uint32_t head = __atomic_load_n(&l_txSendHead, __ATOMIC_ACQUIRE);
+        if (head == tail) { // nothing to send?
+            pthread_mutex_lock(&l_txMutex);
+            __atomic_store_n(&l_txIdle, 1U, __ATOMIC_SEQ_CST);
+            while (l_txRunning
+                   && (__atomic_load_n(&l_txSendHead, __ATOMIC_SEQ_CST)
+                       == tail))
+            {
+                pthread_cond_wait(&l_txDataCond, &l_txMutex);
+            }
+            __atomic_store_n(&l_txIdle, 0U, __ATOMIC_SEQ_CST);
+            bool const running = l_txRunning;
+            pthread_mutex_unlock(&l_txMutex);
+
+            head = __atomic_load_n(&l_txSendHead, __ATOMIC_ACQUIRE);
+            if (head == tail) {
+                if (!running) {
+                    break; // stopped and all data sent
+                }
+                continue;
+            }
+        }
+
+        // send all the handed over buffers in one call, straight from
+        // the QS buffers
+        struct iovec iov[2U*QS_TX_NBUF];
+        struct msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_iov = iov;
+        std::uint32_t nUsed = 0U;
+        for (std::uint32_t i = tail; i != head; ++i) {
+            QSTxBlk const * const blk =
+                &l_txBlk[l_txSendQ[i & (QS_TX_NBUF - 1U)]];
+            for (std::uint_fast8_t j = 0U; j < 2U; ++j) {
+                if (blk->iov[j].iov_len != 0U) {
+                    iov[msg.msg_iovlen] = blk->iov[j];
+                    ++msg.msg_iovlen;
+                }
+            }
+            nUsed += blk->nBytes;
+        }
+
+        ssize_t nSent = sendmsg(l_sock, &msg, MSG_NOSIGNAL);
+        if (nSent == SOCKET_ERROR) { // sending failed?
+            if ((errno == EWOULDBLOCK) || (errno == EAGAIN)) {
+                // wait until the socket can take more data
+                struct pollfd pfd;
+                pfd.fd = l_sock;
+                pfd.events = POLLOUT;
+                pfd.revents = 0;
+                poll(&pfd, 1, QS_TIMEOUT_MS);
+            }
+            else if (errno != EINTR) { // some other socket error...
+                FPRINTF_S(stderr,
+                    "<TARGET> ERROR   sending data over TCP,errno=%d\n",
+                    errno);
+                nSent = static_cast<ssize_t>(nUsed); // discard the data
+                __atomic_fetch_add(&l_txStat.nDropped,
+                    static_cast<std::uint64_t>(nUsed), __ATOMIC_RELAXED);
+            }
+        }
+        if (nSent > 0) {
+            __atomic_fetch_sub(&l_txQueued,
+                static_cast<std::uint32_t>(nSent), __ATOMIC_SEQ_CST);
+            __atomic_fetch_add(&l_txStat.nSent,
+                static_cast<std::uint64_t>(nSent), __ATOMIC_RELAXED);
+
+            // advance over the sent data and free the buffers sent out
+            std::uint32_t n = static_cast<std::uint32_t>(nSent);
+            while (n != 0U) {
+                std::uint8_t const idx = l_txSendQ[tail & (QS_TX_NBUF - 1U)];
+                QSTxBlk * const blk = &l_txBlk[idx];
+                if (n < blk->nBytes) { // buffer sent only partially?
+                    blk->nBytes -= n;
+                    for (std::uint_fast8_t j = 0U; j < 2U; ++j) {
+                        std::size_t const k = (n < blk->iov[j].iov_len)
+                            ? n : blk->iov[j].iov_len;
+                        blk->iov[j].iov_base =
+                            static_cast<std::uint8_t *>(blk->iov[j].iov_base)
+                            + k;
+                        blk->iov[j].iov_len -= k;
+                        n -= static_cast<std::uint32_t>(k);
+                    }
+                }
+                else {
+                    n -= blk->nBytes;
+                    ++tail;
+                    __atomic_store_n(&l_txSendTail, tail, __ATOMIC_SEQ_CST);
+                    l_txFreeQ[l_txFreeHead & (QS_TX_NBUF - 1U)] = idx;
+                    __atomic_store_n(&l_txFreeHead, l_txFreeHead + 1U,
+                                     __ATOMIC_SEQ_CST);
+                }
+            }
+
+            // any producers waiting for a free buffer? wake them up
+            if (__atomic_load_n(&l_txFull, __ATOMIC_SEQ_CST) != 0U) {
+                pthread_mutex_lock(&l_txMutex);
+                pthread_cond_broadcast(&l_txSpaceCond);
+                pthread_mutex_unlock(&l_txMutex);
+            }
+        }
+    }
+    return nullptr;
+}
+//............................................................................
+// start the QS output thread (called from QS::onStartup())
+static bool txStart(void) {
+    l_txRunning = true;
+    if (pthread_create(&l_txThread, NULL, &txThread, NULL) != 0) {
+        l_txRunning = false;
+        return false;
+    }
+    return true;
+}
+//............................................................................
+// let the QS output thread send all data and exit (QS::onCleanup())
+static void txStop(void) {
+    if (l_txRunning) {
+        pthread_mutex_lock(&l_txMutex);
+        l_txRunning = false;
+        pthread_cond_signal(&l_txDataCond);
+        pthread_cond_broadcast(&l_txSpaceCond);
+        pthread_mutex_unlock(&l_txMutex);
+        pthread_join(l_txThread, NULL);
+    }
+}
+//............................................................................
+void QS_getTxStat(QS_TxStat * const stat) {
+    QS_CRIT_STAT_
+    QS_CRIT_ENTRY_();
+    *stat = l_txStat;
+    stat->nSent    = __atomic_load_n(&l_txStat.nSent, __ATOMIC_RELAXED);
+    stat->nDropped = __atomic_load_n(&l_txStat.nDropped, __ATOMIC_RELAXED);
+    QS_CRIT_EXIT_();
+}
+
+
+#endif // QS_TX_THREAD_HPP
+
+//****************************************************************************
+// NOTE1:
+// Defining the macro QS_TX_THREAD (e.g., -DQS_TX_THREAD on the compiler
+// command line) moves the sending of the QS trace data to the host out of
+// the application threads into a dedicated QS output thread. Instead of a
+// single QS buffer, the port then keeps a pool of QS_TX_NBUF buffers of
+// QS_TX_SIZE bytes each. QS_output() and QS::onFlush() do not copy the QS
+// data: inside the QS critical section they hand the current QS buffer
+// over to the output thread (as the one or two spans of the QS data in it)
+// and switch QS to a free buffer from the pool. Only the buffer storage
+// is switched, so the QS sequence number and the QS filters continue.
+// The buffers travel between the producers (serialized by the QS critical
+// section) and the output thread in two single-producer/single-consumer
+// queues. The output thread sends all the handed over buffers with
+// a single sendmsg() call straight out of the QS buffers, returns the sent
+// buffers to the pool and waits for the socket with poll(), so that no
+// application thread ever sleeps in the socket send.
+//
+// Since a QS buffer is handed over or dropped only inside the QS critical
+// section, it always holds complete QS records (HDLC frames). When no free
+// buffer is left, QS_output() by default keeps the records in the current
+// QS buffer until it is more than half full and then drops all of them
+// (QSPY reports the gap in the sequence numbers, but never sees a frame
+// cut in half). Defining also QS_TX_BLOCK makes QS_output() wait for
+// a free buffer instead. QS::onFlush() always waits until all data has
+// been sent. The sent and dropped bytes and the maximum number of bytes
+// handed over and not sent yet are collected in the QS_TxStat statistics
+// (see QS_getTxStat()).
+//
@@ -73,6 +73,15 @@
     } \
 } while (false)
 
+#ifdef Q_PATH_STATIC
+//! helper macro to keep a function out of line (see NOTE02)
+#ifdef __GNUC__
+    #define QEP_NOINLINE_ __attribute__((noinline))
+#else
+    #define QEP_NOINLINE_
+#endif
+#endif // Q_PATH_STATIC
+
 
 namespace QP {
 
@@ -119,6 +128,13 @@ static QEvt const QEP_reservedEvt_[4] {
 QHsm::QHsm(QStateHandler const initial) noexcept {
     m_state.fun = Q_STATE_CAST(&top);
     m_temp.fun  = initial;
+#ifdef Q_TRAN_CACHE
+    m_tranCache = nullptr; // no transition-path cache by default
+#endif
+#ifdef Q_PATH_STATIC
+    m_path = nullptr; // the path on the stack by default, see NOTE02
+    m_pathDepth = MAX_NEST_DEPTH_;
+#endif
 }
 
 //****************************************************************************
@@ -157,16 +173,28 @@ void QHsm::init(void const * const e) {
         QS_FUN_PRE_(m_temp.fun); // the target of the initial transition
     QS_END_PRE_()
 
+#ifndef Q_PATH_STATIC
+    QStateHandler path[MAX_NEST_DEPTH_]; // tran entry path array
+    std::int_fast8_t const depth = MAX_NEST_DEPTH_;
+#else
+    QStateHandler stkPath[MAX_NEST_DEPTH_]; // the default path, see NOTE02
+    QStateHandler * const path = (m_path != nullptr) ? m_path : &stkPath[0];
+    std::int_fast8_t const depth = m_pathDepth;
+#endif
+#ifdef Q_NASSERT
+    // avoid compiler warning about unused variable
+    static_cast<void>(depth);
+#endif
+
     // drill down into the state hierarchy with initial transitions...
     do {
-        QStateHandler path[MAX_NEST_DEPTH_]; // tran entry path array
         std::int_fast8_t ip = 0; // entry path index
 
         path[0] = m_temp.fun;
         static_cast<void>(QEP_TRIG_(m_temp.fun, QEP_EMPTY_SIG_));
         while (m_temp.fun != t) {
             ++ip;
-            Q_ASSERT_ID(220, ip < static_cast<std::int_fast8_t>(Q_DIM(path)));
+            Q_ASSERT_ID(220, ip < depth);
             path[ip] = m_temp.fun;
             static_cast<void>(QEP_TRIG_(m_temp.fun, QEP_EMPTY_SIG_));
         }
@@ -240,6 +268,53 @@ QState QHsm::top(void * const me, QEvt const * const e) noexcept {
 /// __once__ before calling QP::QHsm::dispatch().
 ///
 void QHsm::dispatch(QEvt const * const e) {
+#ifndef Q_PATH_STATIC
+    QStateHandler path[MAX_NEST_DEPTH_]; // tran. path array
+    dispatch_(e, &path[0], MAX_NEST_DEPTH_);
+#else
+    if (m_path != nullptr) { // own path buffer? (see NOTE02)
+        dispatch_(e, m_path, m_pathDepth);
+    }
+    else {
+        dispatchStk_(e);
+    }
+#endif
+}
+
+#ifdef Q_PATH_STATIC
+//****************************************************************************
+/// @description
+/// Dispatches the event @p e with the transition path in an array of
+/// Q_MAX_NEST_DEPTH elements on the stack. This is a separate function,
+/// so that the array is not part of the stack frame of QP::QHsm::dispatch()
+/// in the state machines with their own path buffer (see NOTE02).
+///
+/// @param[in] e  pointer to the event to be dispatched to the HSM
+///
+QEP_NOINLINE_ void QHsm::dispatchStk_(QEvt const * const e) {
+    QStateHandler path[MAX_NEST_DEPTH_]; // tran. path array
+    dispatch_(e, &path[0], MAX_NEST_DEPTH_);
+}
+#endif // Q_PATH_STATIC
+
+//****************************************************************************
+/// @description
+/// helper function to dispatch an event to a hierarchical state machine
+/// (HSM) with the given transition path buffer.
+///
+/// @param[in]     e     pointer to the event to be dispatched to the HSM
+/// @param[in,out] path  array of pointers to state-handler functions
+///                      for the transition path
+/// @param[in]     depth the dimension of the @p path array
+///
+void QHsm::dispatch_(QEvt const * const e,
+                     QStateHandler * const path,
+                     std::int_fast8_t const depth)
+{
+#ifdef Q_NASSERT
+    // avoid compiler warning about unused parameter
+    static_cast<void>(depth);
+#endif
     QStateHandler t = m_state.fun;
     QS_CRIT_STAT_
 
@@ -278,28 +353,58 @@ void QHsm::dispatch(QEvt const * const e) {
 
     // transition taken?
     if (r >= Q_RET_TRAN) {
-        QStateHandler path[MAX_NEST_DEPTH_];
-
         path[0] = m_temp.fun; // save the target of the transition
         path[1] = t;
         path[2] = s;
+        std::int_fast8_t ip;
+
+#ifdef Q_TRAN_CACHE
+        QHsmTranCache::Entry *c = nullptr;
+        if (m_tranCache != nullptr) {
+            c = &m_tranCache->slot_(t, s, path[0]);
+            if ((c->leaf != t) || (c->source != s)
+                || (c->target != path[0]))
+            {
+                c = nullptr; // transition path not cached
+            }
+        }
 
-        // exit current state to transition source s...
-        for (; t != s; t = m_temp.fun) {
-            // exit handled?
-            if (QEP_TRIG_(t, Q_EXIT_SIG) == Q_RET_HANDLED) {
-                QS_BEGIN_PRE_(QS_QEP_STATE_EXIT,
-                              QS::priv_.locFilter[QS::SM_OBJ], this)
-                    QS_OBJ_PRE_(this); // this state machine object
-                    QS_FUN_PRE_(t);    // the exited state
-                QS_END_PRE_()
-
-                // find superstate of t
-                static_cast<void>(QEP_TRIG_(t, QEP_EMPTY_SIG_));
+        if (c != nullptr) { // replay the cached transition path? (NOTE01)
+            for (std::uint_fast8_t i = 0U; i < c->nExit; ++i) {
+                QEP_EXIT_(c->exit[i]); // exit c->exit[i]
+            }
+            ip = static_cast<std::int_fast8_t>(c->nEnter) - 1;
+            for (std::int_fast8_t i = 0; i <= ip; ++i) {
+                path[i] = c->enter[i];
             }
+            t = s; // the source of the transition
         }
+        else
+#endif // Q_TRAN_CACHE
+        {
+            // exit current state to transition source s...
+            for (; t != s; t = m_temp.fun) {
+                // exit handled?
+                if (QEP_TRIG_(t, Q_EXIT_SIG) == Q_RET_HANDLED) {
+                    QS_BEGIN_PRE_(QS_QEP_STATE_EXIT,
+                                  QS::priv_.locFilter[QS::SM_OBJ], this)
+                        QS_OBJ_PRE_(this); // this state machine object
+                        QS_FUN_PRE_(t);    // the exited state
+                    QS_END_PRE_()
+
+                    // find superstate of t
+                    static_cast<void>(QEP_TRIG_(t, QEP_EMPTY_SIG_));
+                }
+            }
 
-        std::int_fast8_t ip = hsm_tran(path); // take the HSM transition
+            ip = hsm_tran(path, depth); // take the HSM transition
+
+#ifdef Q_TRAN_CACHE
+            if (m_tranCache != nullptr) {
+                tranCacheRecord_(s, path, ip); // memoize the path
+            }
+#endif // Q_TRAN_CACHE
+        }
 
 #ifdef Q_SPY
         if (r == Q_RET_TRAN_HIST) {
@@ -339,15 +444,16 @@ void QHsm::dispatch(QEvt const * const e) {
 
             while (m_temp.fun != t) {
                 ++ip;
+
+                // entry path must not overflow
+                Q_ASSERT_ID(410, ip < depth);
+
                 path[ip] = m_temp.fun;
                 // find superstate
                 static_cast<void>(QEP_TRIG_(m_temp.fun, QEP_EMPTY_SIG_));
             }
             m_temp.fun = path[0];
 
-            // entry path must not overflow
-            Q_ASSERT_ID(410, ip < MAX_NEST_DEPTH_);
-
             // retrace the entry path in reverse (correct) order...
             do {
                 QEP_ENTER_(path[ip]);  // enter path[ip]
@@ -403,11 +509,18 @@ void QHsm::dispatch(QEvt const * const e) {
 ///
 /// @param[in,out] path array of pointers to state-handler functions
 ///                     to execute the entry actions
+/// @param[in]     depth the dimension of the @p path array
 ///
 /// @returns
 /// the depth of the entry path stored in the @p path parameter.
 ////
-std::int_fast8_t QHsm::hsm_tran(QStateHandler (&path)[MAX_NEST_DEPTH_]) {
+std::int_fast8_t QHsm::hsm_tran(QStateHandler * const path,
+                                std::int_fast8_t const depth)
+{
+#ifdef Q_NASSERT
+    // avoid compiler warning about unused parameter
+    static_cast<void>(depth);
+#endif
     std::int_fast8_t ip = -1; // transition entry path index
     std::int_fast8_t iq; // helper transition entry path index
     QStateHandler t = path[0];
@@ -456,13 +569,14 @@ std::int_fast8_t QHsm::hsm_tran(QStateHandler (&path)[MAX_NEST_DEPTH_]) {
                     r = QEP_TRIG_(path[1], QEP_EMPTY_SIG_);
                     while (r == Q_RET_SUPER) {
                         ++ip;
+
+                        // entry path must not overflow
+                        Q_ASSERT_ID(510, ip < depth);
+
                         path[ip] = m_temp.fun; // store the entry path
                         if (m_temp.fun == s) { // is it the source?
                             // indicate that the LCA was found
                             iq = 1;
-
-                            // entry path must not overflow
-                            Q_ASSERT_ID(510, ip < MAX_NEST_DEPTH_);
                             --ip;  // do not enter the source
                             r = Q_RET_HANDLED; // terminate the loop
                         }
@@ -475,7 +589,7 @@ std::int_fast8_t QHsm::hsm_tran(QStateHandler (&path)[MAX_NEST_DEPTH_]) {
                     // the LCA not found yet?
                     if (iq == 0) {
                         // entry path must not overflow
-                        Q_ASSERT_ID(520, ip < MAX_NEST_DEPTH_);
+                        Q_ASSERT_ID(520, ip < depth);
 
                         QEP_EXIT_(s); // exit the source
 
@@ -539,6 +653,89 @@ std::int_fast8_t QHsm::hsm_tran(QStateHandler (&path)[MAX_NEST_DEPTH_]) {
     return ip;
 }
 
+#ifdef Q_TRAN_CACHE
+//****************************************************************************
+/// @description
+/// helper function to memoize the transition path just taken in the
+/// transition-path cache of this state machine (see NOTE01).
+///
+/// @param[in] source the source of the transition
+/// @param[in] path   the entry path returned from QP::QHsm::hsm_tran()
+/// @param[in] ip     the index of the first state to enter in @p path
+///
+void QHsm::tranCacheRecord_(QStateHandler const source,
+                            QStateHandler const * const path,
+                            std::int_fast8_t const ip) noexcept
+{
+    if (ip >= MAX_NEST_DEPTH_) { // entry path too deep to cache?
+        return;
+    }
+
+    QHsmTranCache::Entry rec;
+    rec.leaf   = m_state.fun; // the state active before the transition
+    rec.source = source;
+    rec.target = path[0];
+    rec.nEnter = static_cast<std::uint8_t>(ip + 1);
+    for (std::int_fast8_t i = 0; i <= ip; ++i) {
+        rec.enter[i] = path[i];
+    }
+
+    // the states are exited up to (but excluding) the LCA, which is the
+    // superstate of the first state entered or the target itself
+    QStateHandler lca = path[0];
+    if (ip >= 0) {
+        static_cast<void>(QEP_TRIG_(path[ip], QEP_EMPTY_SIG_));
+        lca = m_temp.fun;
+    }
+
+    // exit sequence from the active state up to the LCA...
+    QStateHandler t = rec.leaf;
+    std::uint_fast8_t n = 0U;
+    std::uint_fast8_t const nMax
+        = static_cast<std::uint_fast8_t>(MAX_NEST_DEPTH_);
+    while ((t != lca) && (n < nMax)) {
+        rec.exit[n] = t;
+        ++n;
+        static_cast<void>(QEP_TRIG_(t, QEP_EMPTY_SIG_));
+        t = m_temp.fun;
+    }
+
+    // LCA found? (otherwise the path is too deep to cache)
+    if (t == lca) {
+        rec.nExit = static_cast<std::uint8_t>(n);
+        m_tranCache->slot_(rec.leaf, rec.source, rec.target) = rec;
+    }
+}
+
+//****************************************************************************
+/// @description
+/// Constructs an empty transition-path cache.
+///
+QHsmTranCache::QHsmTranCache() noexcept {
+    for (std::uint_fast8_t i = 0U; i < Q_TRAN_CACHE_SIZE; ++i) {
+        m_entry[i].leaf = nullptr; // empty slot
+    }
+}
+
+//****************************************************************************
+/// @description
+/// Returns the (only) slot of the direct-mapped cache that can hold the
+/// transition path for the given state, source and target.
+///
+QHsmTranCache::Entry &QHsmTranCache::slot_(QStateHandler const leaf,
+                                           QStateHandler const source,
+                                           QStateHandler const target)
+    noexcept
+{
+    std::uintptr_t h = reinterpret_cast<std::uintptr_t>(leaf)
+                       ^ (reinterpret_cast<std::uintptr_t>(source) << 1)
+                       ^ (reinterpret_cast<std::uintptr_t>(target) << 2);
+    h ^= (h >> 7);
+    h ^= (h >> 13);
+    return m_entry[h % Q_TRAN_CACHE_SIZE];
+}
+#endif // Q_TRAN_CACHE
+
 //****************************************************************************
 /// @description
 /// Tests if a state machine derived from QHsm is-in a given state.
@@ -627,3 +824,72 @@ QStateHandler QHsm::childState(QStateHandler const parent) noexcept {
 
 } // namespace QP
 
+
+//****************************************************************************
+// NOTE01:
+// When the macro Q_TRAN_CACHE is defined and a QP::QHsmTranCache is attached
+// to the state machine (QP::QHsm::setTranCache()), every transition taken
+// the first time is memoized as the sequence of states to exit (from the
+// currently active state up to the LCA) and the entry path (from the LCA
+// down to the target). When the same transition is taken again from the
+// same active state, QP::QHsm::dispatch() replays the memoized sequences
+// without calling the state handlers with the empty signal to discover the
+// superstates. The exit and entry actions are executed and traced exactly
+// as before, so QS tracing is unchanged. The drilling into the target by
+// the initial transitions is not cached, because the initial transitions
+// might depend on the extended state.
+//
+// NOTE02:
+// By default, QP::QHsm::dispatch() and QP::QHsm::init() keep the transition
+// path in an array of Q_MAX_NEST_DEPTH elements on the stack, so the macro
+// Q_MAX_NEST_DEPTH limits the nesting depth of states of all state machines
+// (e.g., -DQ_MAX_NEST_DEPTH=12 for deep hierarchies on the host).
+// When the macro Q_PATH_STATIC is defined, a state machine class can
+// declare its own depth instead, with a member QP::QHsmPath<depth> attached
+// by QP::QHsm::setPathBuf() (checked at compile time). A few deep state
+// machines then do not force a deep path on the stack of all the others.
+//
+// dispatch() of a state machine with its own path buffer puts no path
+// array on the stack. The array of the other state machines is in the
+// separate function QP::QHsm::dispatchStk_(), kept out of line (macro
+// QEP_NOINLINE_), because a compiler would otherwise merge its stack frame
+// into dispatch(). init() runs only once per state machine and keeps the
+// array on the stack.
+//
+// The path buffer belongs to one state machine, which the framework never
+// dispatches twice at once: the RTC step of an active object runs to
+// completion before the next one, whether it is preempted under QK or QXK,
+// or runs in its own thread under an RTOS or POSIX (also with
+// QF_POOL_THREADS and QV_PARTITIONS). Therefore Q_PATH_STATIC works with
+// every kernel and port. Sharing one buffer between state machines (e.g.,
+// a static buffer for the whole class) is not safe: a higher-priority
+// active object of the same class preempting the transition, or an entry
+// action dispatching an orthogonal component, would overwrite the path.
+//
+// NOTE03:
+// The state handlers of QP::QMapHsm (QP::QMapHsm::state<>) report the
+// immediate superstate only for the reserved signals, which QHsm::dispatch()
+// and QHsm::init() use to discover the superstates (the empty signal) and to
+// exit and enter the states. For a user signal that the state does not
+// handle, the state handler returns the first superstate whose bitmap
+// contains the signal (or QHsm::top), so QHsm::dispatch() calls only the
+// state handlers that actually handle the signal. This is transparent to
+// the transitions, because the exit path from the active state up to the
+// transition source is discovered with the empty signal, as before.
+// A signal handler returning Q_UNHANDLED() (a guard evaluating to false)
+// passes the event to the next superstate that handles it.
+//
+// The skipping is not free: every state handler call searches the signal
+// map instead of jumping through a switch. QMapHsm::handle_() is therefore
+// inlined into every QMapHsm::state<> (forced for GCC, macro Q_MAP_INLINE),
+// otherwise -Os would turn it into a real call. Even so, the benchmark in
+// examples/performance/qmap_hsm-host (6 levels, x86-64 host) shows that
+// QMapHsm pays off only when the events pass through several levels:
+//
+// dispatch() [ns]         -O2 QHsm/QMapHsm    -Os QHsm/QMapHsm
+// handled 5 levels up       18.2 / 18.4         21.8 / 23.7
+// handled in leaf           11.1 / 16.1         14.6 / 17.8
+// ignored                   20.3 / 12.2         25.3 / 18.2
+//
+// A flat state machine handling most events in the leaf states is faster
+// as a plain QHsm.
@@ -56,6 +56,19 @@ namespace QP {
 
 Q_DEFINE_THIS_MODULE("qep_msm")
 
+#ifdef Q_FLAT_TABLE
+//! slot of the state object @p s in the hash of the rows of QP::QMFlatTbl
+static inline std::uint_fast16_t QM_flatHash_(QMState const * const s,
+                                              std::uint_fast16_t const mask)
+    noexcept
+{
+    std::uint32_t h = static_cast<std::uint32_t>(
+        reinterpret_cast<std::uintptr_t>(s) >> 2U) * 0x9E3779B1U;
+    h ^= (h >> 16U);
+    return static_cast<std::uint_fast16_t>(h) & mask;
+}
+#endif // Q_FLAT_TABLE
+
 //****************************************************************************
 QMState const QMsm::msm_top_s = {
     nullptr,
@@ -85,6 +98,10 @@ QMsm::QMsm(QStateHandler const initial) noexcept
 {
     m_state.obj = &msm_top_s;
     m_temp.fun  = initial;
+#ifdef Q_FLAT_TABLE
+    m_flatTbl = nullptr; // no flattened dispatch table by default
+    m_flatRow = 0U;
+#endif
 }
 
 //****************************************************************************
@@ -161,8 +178,23 @@ void QMsm::dispatch(QEvt const * const e) {
         QS_FUN_PRE_(s->stateHandler); // the current state handler
     QS_END_PRE_()
 
+#ifdef Q_FLAT_TABLE
+    // skip the states that don't handle the signal, see NOTE01
+    if (m_flatTbl != nullptr) {
+        t = flatSource_(s, e->sig);
+
+#if (defined Q_SPY) && (!defined Q_NASSERT)
+        // the skipped states must really pass the event up, see NOTE01
+        for (QMState const *k = s; k != t; k = k->superstate) {
+            Q_ASSERT_ID(305, (*k->stateHandler)(this, e) == Q_RET_SUPER);
+        }
+#endif
+    }
+#endif // Q_FLAT_TABLE
+
     // scan the state hierarchy up to the top state...
-    do {
+    r = Q_RET_SUPER; // in case no state handles the event at all
+    while (t != nullptr) {
         r = (*t->stateHandler)(this, e); // call state handler function
 
         // event handled? (the most frequent case)
@@ -193,7 +225,7 @@ void QMsm::dispatch(QEvt const * const e) {
             // no other return value should be produced
             Q_ERROR_ID(310);
         }
-    } while (t != nullptr);
+    }
 
     // any kind of transition taken?
     if (r >= Q_RET_TRAN) {
@@ -565,5 +597,109 @@ QMState const *QMsm::childStateObj(QMState const * const parent)
     return child; // return the child
 }
 
+#ifdef Q_FLAT_TABLE
+//****************************************************************************
+/// @description
+/// Attaches the flattened dispatch table @p tbl and builds the hash of its
+/// rows. A table shared by several state machines must be attached before
+/// any of them dispatches events.
+///
+void QMsm::setFlatTbl(QMFlatTbl const * const tbl) noexcept {
+    if (tbl != nullptr) {
+        std::uint_fast16_t const mask = tbl->nRows - 1U;
+
+        /// @pre the hash of the rows must be a power of 2 at least twice
+        /// the number of states (see QP::QM_flatRows())
+        Q_REQUIRE_ID(820, ((tbl->nRows & mask) == 0U)
+                          && (tbl->nRows >= (2U * tbl->nStates)));
+
+        for (std::uint_fast16_t h = 0U; h < tbl->nRows; ++h) {
+            tbl->rows[h] = static_cast<std::uint8_t>(QM_FLAT_NONE);
+        }
+        for (std::uint_fast8_t row = 0U; row < tbl->nStates; ++row) {
+            std::uint_fast16_t h = QM_flatHash_(tbl->desc[row].state, mask);
+            while (tbl->rows[h] != static_cast<std::uint8_t>(QM_FLAT_NONE)) {
+                h = (h + 1U) & mask; // linear probing
+            }
+            tbl->rows[h] = static_cast<std::uint8_t>(row);
+        }
+    }
+    m_flatTbl = tbl;
+    m_flatRow = 0U;
+}
+
+//****************************************************************************
+/// @description
+/// Looks up the first state, from the current state @p s up the state
+/// hierarchy, that handles the signal @p sig in the flattened dispatch table
+/// of this state machine (see NOTE01).
+///
+/// @returns
+/// the state to start the search for the handling state from, or nullptr if
+/// no state handles the signal. The state @p s is returned when the table
+/// does not cover @p s (e.g., a submachine state) or the signal @p sig.
+///
+QMState const *QMsm::flatSource_(QMState const * const s,
+                                 QSignal const sig) noexcept
+{
+    QMFlatTbl const * const tbl = m_flatTbl;
+
+    // the current state not in the cached row? (after a transition)
+    if (tbl->desc[m_flatRow].state != s) {
+        std::uint_fast16_t const mask = tbl->nRows - 1U;
+        std::uint_fast16_t h = QM_flatHash_(s, mask);
+        std::uint_fast8_t row;
+        for (;;) { // the hash is at most half full, so the loop terminates
+            row = tbl->rows[h];
+            if (row == static_cast<std::uint8_t>(QM_FLAT_NONE)) {
+                return s; // the state not covered by the table
+            }
+            if (tbl->desc[row].state == s) {
+                break;
+            }
+            h = (h + 1U) & mask;
+        }
+        m_flatRow = row;
+    }
+
+    // the signal not covered by the table?
+    if ((sig < tbl->sig0)
+        || (static_cast<QSignal>(sig - tbl->sig0) >= tbl->nSigs))
+    {
+        return s;
+    }
+
+    std::uint_fast8_t const i = tbl->idx[(m_flatRow * tbl->nSigs)
+                                         + (sig - tbl->sig0)];
+    return (i != QM_FLAT_NONE) ? tbl->desc[i].state : nullptr;
+}
+#endif // Q_FLAT_TABLE
+
 } // namespace QP
 
+//****************************************************************************
+// NOTE01:
+// When the macro Q_FLAT_TABLE is defined and a flattened dispatch table
+// (QP::QMFlatTbl) is attached to the state machine (QP::QMsm::setFlatTbl()),
+// QP::QMsm::dispatch() starts the search for the handling state directly at
+// the first state that handles the signal according to the table, instead
+// of calling the state handlers of all the states below it, which would
+// only return Q_RET_SUPER. An event that no state handles is ignored without
+// calling any state handler. A state handler can still pass the event up
+// (e.g., due to a guard), in which case the search continues as usual.
+//
+// The table is generated at compile time (QP::QM_flatIdx()) from the
+// descriptions of the states and the signals that each state handles,
+// which must cover the whole state hierarchy (except for the submachines)
+// and all signals handled in each state. The table takes (states x signals)
+// bytes of ROM. After a transition, the row of the new current state is
+// found in a hash of the state objects (2..4 bytes of RAM per state, built
+// by QP::QMsm::setFlatTbl()), and then it is reused for all the following
+// events.
+//
+// A table that omits a signal handled by a state would silently skip that
+// state. Therefore, in the Q_SPY builds (with assertions enabled),
+// QP::QMsm::dispatch() still calls the state handlers of all the skipped
+// states and asserts that they return Q_RET_SUPER. The Q_SPY builds thus
+// don't gain any speed from the table, but they check it.
+
@@ -56,6 +56,19 @@ namespace QP {
 
 Q_DEFINE_THIS_MODULE("qf_actq")
 
+// QF port provides its own active object queue operations?
+#if (defined QF_EVT_BURST) && (defined QF_LOCKFREE_EQUEUE)
+    #error "QF_EVT_BURST is not supported with QF_LOCKFREE_EQUEUE"
+#endif
+#if (defined QF_EQUEUE_LANES) && (defined QF_LOCKFREE_EQUEUE)
+    #error "QF_EQUEUE_LANES is not supported with QF_LOCKFREE_EQUEUE"
+#endif
+#if (defined QF_EVT_COALESCE) && (defined QF_LOCKFREE_EQUEUE)
+    #error "QF_EVT_COALESCE is not supported with QF_LOCKFREE_EQUEUE"
+#endif
+
+#ifndef QF_LOCKFREE_EQUEUE
+
 #ifdef Q_SPY
 //****************************************************************************
 /// @description
@@ -103,7 +116,29 @@ bool QActive::post_(QEvt const * const e,
     Q_REQUIRE_ID(100, e != nullptr);
 
     QF_CRIT_ENTRY_();
-    QEQueueCtr nFree = m_eQueue.m_nFree; // get volatile into the temporary
+#ifdef QF_EVT_COALESCE
+    // an identical static event already pending in the queue? (NOTE02)
+    if (merge_(e)) {
+        QS_BEGIN_NOCRIT_PRE_(QS_QF_ACTIVE_POST_MERGE,
+                         QS::priv_.locFilter[QS::AO_OBJ], this)
+            QS_TIME_PRE_();      // timestamp
+            QS_OBJ_PRE_(sender); // the sender object
+            QS_SIG_PRE_(e->sig); // the signal of the event
+            QS_OBJ_PRE_(this);   // this active object
+            QS_U16_PRE_(m_nMerged); // number of merged posts so far
+        QS_END_NOCRIT_PRE_()
+
+        QF_CRIT_EXIT_();
+        return true; // posted without using up any entry in the queue
+    }
+#endif // QF_EVT_COALESCE
+
+#ifdef QF_EQUEUE_LANES
+    QEQueue &eq = laneQueue_(e->sig); // the lane of the event, see NOTE01
+#else
+    QEQueue &eq = m_eQueue; // the event queue
+#endif
+    QEQueueCtr nFree = eq.m_nFree; // get volatile into the temporary
 
     // test-probe#1 for faking queue overflow
     QS_TEST_PROBE_ID(1,
@@ -134,9 +169,9 @@ bool QActive::post_(QEvt const * const e,
     if (status) { // can post the event?
 
         --nFree;  // one free entry just used up
-        m_eQueue.m_nFree = nFree; // update the volatile
-        if (m_eQueue.m_nMin > nFree) {
-            m_eQueue.m_nMin = nFree; // update minimum so far
+        eq.m_nFree = nFree; // update the volatile
+        if (eq.m_nMin > nFree) {
+            eq.m_nMin = nFree; // update minimum so far
         }
 
         QS_BEGIN_NOCRIT_PRE_(QS_QF_ACTIVE_POST,
@@ -147,7 +182,7 @@ bool QActive::post_(QEvt const * const e,
             QS_OBJ_PRE_(this);            // this active object
             QS_2U8_PRE_(e->poolId_, e->refCtr_); // pool Id & refCtr of the evt
             QS_EQC_PRE_(nFree);           // number of free entries
-            QS_EQC_PRE_(m_eQueue.m_nMin); // min number of free entries
+            QS_EQC_PRE_(eq.m_nMin);       // min number of free entries
         QS_END_NOCRIT_PRE_()
 
 #ifdef Q_UTEST
@@ -167,6 +202,12 @@ bool QActive::post_(QEvt const * const e,
             m_eQueue.m_frontEvt = e;      // deliver event directly
             QACTIVE_EQUEUE_SIGNAL_(this); // signal the event queue
         }
+#ifdef QF_EQUEUE_LANES
+        // queue is not empty and the event belongs to a priority lane?
+        else if (&eq != &m_eQueue) {
+            laneInsert_(eq, e, false); // insert event into the lane (FIFO)
+        }
+#endif
         // queue is not empty, insert event into the ring-buffer
         else {
             // insert event pointer e into the buffer (FIFO)
@@ -178,6 +219,9 @@ bool QActive::post_(QEvt const * const e,
             }
             --m_eQueue.m_head; // advance the head (counter clockwise)
         }
+#ifdef QF_EVT_COALESCE
+        pend_(e, true); // the event becomes pending
+#endif
 
         QF_CRIT_EXIT_();
     }
@@ -231,17 +275,51 @@ bool QActive::post_(QEvt const * const e,
 ///
 void QActive::postLIFO(QEvt const * const e) noexcept {
     QF_CRIT_STAT_
-    QS_TEST_PROBE_DEF(&QActive::postLIFO)
 
     QF_CRIT_ENTRY_();
-    QEQueueCtr nFree = m_eQueue.m_nFree;// tmp to avoid UB for volatile access
+    // the queue must be able to accept the event (cannot overflow)
+    if (!postLIFONoCrit_(e)) {
+        Q_ERROR_CRIT_(210);
+    }
+    QF_CRIT_EXIT_();
+}
+
+//****************************************************************************
+/// @description
+/// Posts the event @p e to the front of the event queue of the active
+/// object (see QP::QActive::postLIFO()). Must be called inside the critical
+/// section.
+///
+/// @returns
+/// 'true' if the event has been posted and 'false' if the queue could not
+/// accept the event (the callers assert in this case).
+///
+bool QActive::postLIFONoCrit_(QEvt const * const e) noexcept {
+    QS_TEST_PROBE_DEF(&QActive::postLIFO)
+
+#ifdef QF_EVT_BURST
+    // a LIFO post would be dispatched after the rest of the current burst
+    // (see QP::QActive::setBurst()), so it requires the burst of 1
+    Q_ASSERT_CRIT_(220, m_burst == 1U);
+#endif
+
+#ifdef QF_EQUEUE_LANES
+    // the lane of the event displaced from the front, see NOTE01
+    QEQueue &eq = laneQueue_((m_eQueue.m_frontEvt != nullptr)
+                             ? m_eQueue.m_frontEvt->sig
+                             : static_cast<QSignal>(0U));
+#else
+    QEQueue &eq = m_eQueue; // the event queue
+#endif
+    QEQueueCtr nFree = eq.m_nFree; // tmp to avoid UB for volatile access
 
     QS_TEST_PROBE_ID(1,
         nFree = 0U;
     )
 
-    // the queue must be able to accept the event (cannot overflow)
-    Q_ASSERT_CRIT_(210, nFree != 0U);
+    if (nFree == 0U) { // the queue cannot accept the event?
+        return false;
+    }
 
     // is it a dynamic event?
     if (e->poolId_ != 0U) {
@@ -249,9 +327,9 @@ void QActive::postLIFO(QEvt const * const e) noexcept {
     }
 
     --nFree;  // one free entry just used up
-    m_eQueue.m_nFree = nFree; // update the volatile
-    if (m_eQueue.m_nMin > nFree) {
-        m_eQueue.m_nMin = nFree; // update minimum so far
+    eq.m_nFree = nFree; // update the volatile
+    if (eq.m_nMin > nFree) {
+        eq.m_nMin = nFree; // update minimum so far
     }
 
     QS_BEGIN_NOCRIT_PRE_(QS_QF_ACTIVE_POST_LIFO,
@@ -261,7 +339,7 @@ void QActive::postLIFO(QEvt const * const e) noexcept {
         QS_OBJ_PRE_(this);                   // this active object
         QS_2U8_PRE_(e->poolId_, e->refCtr_); // pool Id & refCtr of the evt
         QS_EQC_PRE_(nFree);                  // number of free entries
-        QS_EQC_PRE_(m_eQueue.m_nMin);        // min number of free entries
+        QS_EQC_PRE_(eq.m_nMin);              // min number of free entries
     QS_END_NOCRIT_PRE_()
 
 #ifdef Q_UTEST
@@ -285,6 +363,12 @@ void QActive::postLIFO(QEvt const * const e) noexcept {
     if (frontEvt == nullptr) {
         QACTIVE_EQUEUE_SIGNAL_(this); // signal the event queue
     }
+#ifdef QF_EQUEUE_LANES
+    // the displaced event belongs to a priority lane?
+    else if (&eq != &m_eQueue) {
+        laneInsert_(eq, frontEvt, true); // back to the front of its lane
+    }
+#endif
     // queue was not empty, leave the event in the ring-buffer
     else {
         ++m_eQueue.m_tail;
@@ -294,7 +378,196 @@ void QActive::postLIFO(QEvt const * const e) noexcept {
 
         QF_PTR_AT_(m_eQueue.m_ring, m_eQueue.m_tail) = frontEvt;
     }
+    return true;
+}
+
+//****************************************************************************
+/// @description
+/// This function is part of the event deferral support. An active object
+/// uses this function to recall up to @p n deferred events from the given
+/// event queue @p eq at once. Unlike calling QP::QActive::recall() @p n
+/// times, the events are moved in a single critical section and end up at
+/// the front of the event queue of the active object in the same (FIFO)
+/// order, in which they have been deferred (see NOTE03).
+///
+/// @param[in] eq  pointer to a "raw" thread-safe queue to recall
+///                the events from.
+/// @param[in] n   the maximum number of events to recall
+///
+/// @returns
+/// the number of events actually recalled.
+///
+/// @note
+/// The event queue of the active object must be able to accept all the
+/// recalled events, as with QP::QActive::postLIFO().
+///
+/// @note
+/// QP::QActive::recallN() is available only with the native QF event queue.
+///
+/// @sa
+/// QP::QActive::recallAll(), QP::QActive::recallIf(),
+/// QP::QActive::defer(), QP::QActive::recall()
+///
+std::uint_fast16_t QActive::recallN(QEQueue * const eq,
+                                    std::uint_fast16_t const n) noexcept
+{
+    return recall_(eq, n, nullptr);
+}
+
+//****************************************************************************
+/// @description
+/// This function is part of the event deferral support. An active object
+/// uses this function to recall all the deferred events, whose signals are
+/// selected by the predicate @p pred, from the given event queue @p eq at
+/// once. The recalled events are moved to the front of the event queue of
+/// the active object in a single critical section and in the order, in
+/// which they have been deferred. The events not selected remain deferred
+/// in their original order (see NOTE03).
+///
+/// @param[in] eq   pointer to a "raw" thread-safe queue to recall
+///                 the events from.
+/// @param[in] pred the predicate, which returns 'true' for the signals
+///                 of the events to recall
+///
+/// @returns
+/// the number of events actually recalled.
+///
+/// @attention
+/// The predicate is called inside the critical section, once for every
+/// event deferred in @p eq, so it must be short and must not call any
+/// QF services.
+///
+/// @note
+/// QP::QActive::recallIf() is available only with the native QF event
+/// queue.
+///
+std::uint_fast16_t QActive::recallIf(QEQueue * const eq,
+                                     QRecallPred const pred) noexcept
+{
+    /// @pre the predicate must be provided
+    Q_REQUIRE_ID(600, pred != nullptr);
+
+    return recall_(eq, ~static_cast<std::uint_fast16_t>(0U), pred);
+}
+
+//****************************************************************************
+/// @description
+/// Returns the index in the ring buffer of the deferred event @p j
+/// (counting from the front event, which is 0) of a queue with the given
+/// @p tail and @p end. The event @p j must be in the ring buffer (j > 0).
+///
+/// @note
+/// The sum (tail + end + 1) does not fit in the 1-byte ::QEQueueCtr for
+/// the queues longer than 127 events, so the index is computed in the
+/// wider type and cast to ::QEQueueCtr only after the modulo.
+///
+static inline QEQueueCtr deferredIdx_(std::uint_fast16_t const tail,
+                                      std::uint_fast16_t const end,
+                                      std::uint_fast16_t const j) noexcept
+{
+    // tail - (j - 1) modulo end, without a division
+    std::uint_fast16_t const i = (tail + end + 1U) - j;
+    return static_cast<QEQueueCtr>((i >= end) ? (i - end) : i);
+}
+
+//****************************************************************************
+/// @description
+/// Recalls the deferred events selected by the predicate @p pred (or the
+/// up to @p n oldest events if @p pred is nullptr) from the event queue
+/// @p eq in a single critical section, see NOTE03.
+///
+std::uint_fast16_t QActive::recall_(QEQueue * const eq,
+                                    std::uint_fast16_t const n,
+                                    QRecallPred const pred) noexcept
+{
+    std::uint_fast16_t nRecalled = 0U;
+    QF_CRIT_STAT_
+
+    QF_CRIT_ENTRY_();
+
+    // number of the events in the deferred queue (+1 for the front event),
+    // which might not fit in QEQueueCtr when the deferred queue is full
+    std::uint_fast16_t const nEvts = (eq->m_frontEvt != nullptr)
+        ? ((static_cast<std::uint_fast16_t>(eq->m_end) + 1U)
+           - static_cast<std::uint_fast16_t>(eq->m_nFree))
+        : 0U;
+
+    // number of the events to examine (from the oldest)
+    std::uint_fast16_t const nExam = ((pred == nullptr) && (n < nEvts))
+        ? n
+        : nEvts;
+
+    // visit the examined events from the newest to the oldest, so that
+    // posting them LIFO preserves their order at the front of the AO queue
+    std::uint_fast16_t w = nExam; // the kept events are packed in [w..nExam)
+    std::uint_fast16_t j = nExam;
+    while (j > 0U) {
+        --j;
+        QEvt const * const e = (j == 0U)
+            ? eq->m_frontEvt
+            : QF_PTR_AT_(eq->m_ring, deferredIdx_(eq->m_tail, eq->m_end, j));
+
+        if ((pred == nullptr) || pred(e->sig)) { // recall the event?
+
+            // the AO queue must be able to accept the event
+            if (!postLIFONoCrit_(e)) {
+                Q_ERROR_CRIT_(610);
+            }
+
+            // is it a dynamic event?
+            if (e->poolId_ != 0U) {
+                // the event must be referenced at least twice (see recall())
+                Q_ASSERT_CRIT_(620, e->refCtr_ >= 2U);
+                QF_EVT_REF_CTR_DEC_(e); // removed from the deferred queue
+            }
+
+            QS_BEGIN_NOCRIT_PRE_(QS_QF_ACTIVE_RECALL,
+                             QS::priv_.locFilter[QS::AO_OBJ], this)
+                QS_TIME_PRE_();      // time stamp
+                QS_OBJ_PRE_(this);   // this active object
+                QS_OBJ_PRE_(eq);     // the deferred queue
+                QS_SIG_PRE_(e->sig); // the signal of the event
+                QS_2U8_PRE_(e->poolId_, e->refCtr_); // pool Id & ref Count
+            QS_END_NOCRIT_PRE_()
+
+            ++nRecalled;
+        }
+        else { // keep the event, closing the gap after the recalled events
+            --w;
+            if (w != j) { // need to move the event? (then w > j, in the ring)
+                QF_PTR_AT_(eq->m_ring,
+                           deferredIdx_(eq->m_tail, eq->m_end, w)) = e;
+            }
+        }
+    }
+
+    // the w oldest entries are vacated (w == nRecalled), remove them
+    // in one step, as w calls to QEQueue::get() would
+    if (w > 0U) {
+        eq->m_nFree = static_cast<QEQueueCtr>(
+                          static_cast<std::uint_fast16_t>(eq->m_nFree) + w);
+        if (w < nEvts) { // any events left in the deferred queue?
+            eq->m_frontEvt = QF_PTR_AT_(eq->m_ring,
+                                 deferredIdx_(eq->m_tail, eq->m_end, w));
+            eq->m_tail = deferredIdx_(eq->m_tail, eq->m_end, w + 1U);
+        }
+        else { // the deferred queue becomes empty
+            eq->m_frontEvt = nullptr;
+            eq->m_tail = deferredIdx_(eq->m_tail, eq->m_end, w);
+        }
+    }
+
+    if (nRecalled == 0U) {
+        QS_BEGIN_NOCRIT_PRE_(QS_QF_ACTIVE_RECALL_ATTEMPT,
+                         QS::priv_.locFilter[QS::AO_OBJ], this)
+            QS_TIME_PRE_();      // time stamp
+            QS_OBJ_PRE_(this);   // this active object
+            QS_OBJ_PRE_(eq);     // the deferred queue
+        QS_END_NOCRIT_PRE_()
+    }
     QF_CRIT_EXIT_();
+
+    return nRecalled;
 }
 
 //****************************************************************************
@@ -321,12 +594,130 @@ QEvt const *QActive::get_(void) noexcept {
 
     QF_CRIT_ENTRY_();
     QACTIVE_EQUEUE_WAIT_(this); // wait for event to arrive directly
+    QEvt const * const e = getNoCrit_();
+
+    // an empty queue must have all entries free (+1 for fronEvt)
+    Q_ASSERT_CRIT_(310, (m_eQueue.m_frontEvt != nullptr)
+                        || (m_eQueue.m_nFree == (m_eQueue.m_end + 1U)));
+    QF_CRIT_EXIT_();
+    return e;
+}
 
+#ifdef QF_EVT_BURST
+//****************************************************************************
+/// @description
+/// Sets the maximum number of events that the active object removes from
+/// its event queue and dispatches in one burst (see QP::QActive::getBurst_()).
+/// The limit bounds the time, in which the cooperative QV kernel does not
+/// check for higher-priority active objects ready to run. By default, every
+/// active object dispatches one event at a time (the burst of 1), so the
+/// bursts are an opt-in for the active objects that can tolerate them.
+///
+/// @param[in] burst  the maximum burst (1..#QF_EVT_BURST). The burst of 1
+///                   restores the dispatching of one event at a time.
+///
+/// @attention
+/// The events of a burst are all removed from the queue before the first
+/// of them is dispatched. An event posted to the front of the queue during
+/// the burst (QP::QActive::postLIFO(), or QP::QActive::recall() of
+/// a deferred event) is therefore dispatched only __after__ the rest of
+/// the burst, which breaks the defer/recall and LIFO-post contracts.
+/// Bursts must not be enabled for the active objects that recall deferred
+/// events or that receive LIFO posts, which is asserted in
+/// QP::QActive::postLIFO() and QP::QActive::recall().
+///
+void QActive::setBurst(std::uint_fast8_t const burst) noexcept {
+    /// @pre the burst must be in range
+    Q_REQUIRE_ID(500, (0U < burst) && (burst <= QF_EVT_BURST));
+    m_burst = static_cast<std::uint8_t>(burst);
+}
+
+//****************************************************************************
+/// @description
+/// Removes up to the burst limit of the active object (see
+/// QP::QActive::setBurst()) events from the front of its event queue in
+/// one critical section. The events are dispatched and garbage-collected
+/// by the caller outside the critical section, in the order of the array.
+/// Like QP::QActive::get_(), the function waits for the first event
+/// (with the macro QACTIVE_EQUEUE_WAIT_()), but never for the rest.
+///
+/// @param[out] evts  array of at least #QF_EVT_BURST event pointers
+///
+/// @returns
+/// The number of events removed (at least 1).
+///
+std::uint_fast8_t QActive::getBurst_(QEvt const ** const evts) noexcept {
+    std::uint_fast8_t n = 0U;
+    QF_CRIT_STAT_
+
+    QF_CRIT_ENTRY_();
+    QACTIVE_EQUEUE_WAIT_(this); // wait for the first event to arrive
+    do {
+        evts[n] = getNoCrit_();
+        ++n;
+    } while ((n < static_cast<std::uint_fast8_t>(m_burst))
+             && (m_eQueue.m_frontEvt != nullptr));
+
+    // an empty queue must have all entries free (+1 for fronEvt)
+    Q_ASSERT_CRIT_(320, (m_eQueue.m_frontEvt != nullptr)
+                        || (m_eQueue.m_nFree == (m_eQueue.m_end + 1U)));
+    QF_CRIT_EXIT_();
+
+    return n;
+}
+#endif // QF_EVT_BURST
+
+//****************************************************************************
+/// @description
+/// Removes the front event from the non-empty event queue of the active
+/// object. Must be called inside the critical section.
+///
+QEvt const *QActive::getNoCrit_(void) noexcept {
     // always remove evt from the front
     QEvt const * const e = m_eQueue.m_frontEvt;
     QEQueueCtr const nFree = m_eQueue.m_nFree + 1U;
     m_eQueue.m_nFree = nFree; // upate the number of free
+#ifdef QF_EVT_COALESCE
+    pend_(e, false); // the event is no longer pending
+#endif
+
+#ifdef QF_EQUEUE_LANES
+    // any events in the priority lanes? (see NOTE01)
+    if ((m_lanes != nullptr) && (m_lanes->m_ready != 0U)) {
+        // the highest non-empty lane...
+        std::uint_fast8_t const n = static_cast<std::uint_fast8_t>(
+            QF_LOG2(static_cast<QPSetBits>(m_lanes->m_ready)) - 1U);
+        QEQueue &lq = m_lanes->m_lane[n];
+
+        // move the front event of the lane to the front of the queue
+        m_eQueue.m_frontEvt = lq.m_frontEvt;
+        m_eQueue.m_nFree = static_cast<QEQueueCtr>(nFree - 1U);
 
+        QEQueueCtr const lFree = lq.m_nFree + 1U;
+        lq.m_nFree = lFree;
+        if (lFree <= lq.m_end) { // any events in the lane's ring buffer?
+            lq.m_frontEvt = QF_PTR_AT_(lq.m_ring, lq.m_tail);
+            if (lq.m_tail == 0U) { // need to wrap?
+                lq.m_tail = lq.m_end; // wrap around
+            }
+            --lq.m_tail;
+        }
+        else { // the lane becomes empty
+            lq.m_frontEvt = nullptr;
+            m_lanes->m_ready &= static_cast<std::uint8_t>(~(1U << n));
+        }
+
+        QS_BEGIN_NOCRIT_PRE_(QS_QF_ACTIVE_GET,
+                         QS::priv_.locFilter[QS::AO_OBJ], this)
+            QS_TIME_PRE_();                      // timestamp
+            QS_SIG_PRE_(e->sig);                 // the signal of this event
+            QS_OBJ_PRE_(this);                   // this active object
+            QS_2U8_PRE_(e->poolId_, e->refCtr_); // pool Id & refCtr of the evt
+            QS_EQC_PRE_(m_eQueue.m_nFree);       // number of free entries
+        QS_END_NOCRIT_PRE_()
+    }
+    else
+#endif // QF_EQUEUE_LANES
     // any events in the ring buffer?
     if (nFree <= m_eQueue.m_end) {
 
@@ -347,12 +738,10 @@ QEvt const *QActive::get_(void) noexcept {
         QS_END_NOCRIT_PRE_()
     }
     else {
-        // the queue becomes empty
+        // the queue becomes empty (all entries must be free, which
+        // the callers assert outside this function)
         m_eQueue.m_frontEvt = nullptr;
 
-        // all entries in the queue must be free (+1 for fronEvt)
-        Q_ASSERT_CRIT_(310, nFree == (m_eQueue.m_end + 1U));
-
         QS_BEGIN_NOCRIT_PRE_(QS_QF_ACTIVE_GET_LAST,
                          QS::priv_.locFilter[QS::AO_OBJ], this)
             QS_TIME_PRE_();                      // timestamp
@@ -361,10 +750,148 @@ QEvt const *QActive::get_(void) noexcept {
             QS_2U8_PRE_(e->poolId_, e->refCtr_); // pool Id & refCtr of the evt
         QS_END_NOCRIT_PRE_()
     }
-    QF_CRIT_EXIT_();
     return e;
 }
 
+#ifdef QF_EQUEUE_LANES
+//****************************************************************************
+/// @description
+/// Finds the queue accounting for an event with the signal @p sig posted
+/// to the event queue of the active object. This is the lane of the signal,
+/// unless the event queue is empty, in which case the event is delivered
+/// directly to the front of the event queue (the lane 0). Must be called
+/// inside the critical section.
+///
+QEQueue &QActive::laneQueue_(QSignal const sig) noexcept {
+    std::uint_fast8_t const lane =
+        ((m_lanes != nullptr) && (m_eQueue.m_frontEvt != nullptr))
+        ? m_lanes->laneOf(sig)
+        : 0U;
+    return (lane != 0U) ? m_lanes->m_lane[lane - 1U] : m_eQueue;
+}
+
+//****************************************************************************
+/// @description
+/// Inserts the event @p e into the priority lane @p eq, which has already
+/// accounted for the event. Must be called inside the critical section.
+///
+/// @param[in] eq   the lane (other than the lane 0)
+/// @param[in] e    the event to insert
+/// @param[in] lifo insert at the front (true) or at the back of the lane
+///
+void QActive::laneInsert_(QEQueue &eq, QEvt const * const e,
+                          bool const lifo) noexcept
+{
+    QEvt const * const frontEvt = eq.m_frontEvt;
+    if (frontEvt == nullptr) { // the lane empty?
+        eq.m_frontEvt = e;
+        m_lanes->m_ready |= static_cast<std::uint8_t>(
+            1U << static_cast<std::uint_fast8_t>(&eq - &m_lanes->m_lane[0]));
+    }
+    else if (lifo) { // the event to the front of the lane
+        eq.m_frontEvt = e;
+        ++eq.m_tail;
+        if (eq.m_tail == eq.m_end) { // need to wrap the tail?
+            eq.m_tail = 0U; // wrap around
+        }
+        QF_PTR_AT_(eq.m_ring, eq.m_tail) = frontEvt;
+    }
+    else { // the event to the back of the lane
+        QF_PTR_AT_(eq.m_ring, eq.m_head) = e;
+        if (eq.m_head == 0U) { // need to wrap the head?
+            eq.m_head = eq.m_end; // wrap around
+        }
+        --eq.m_head;
+    }
+}
+#endif // QF_EQUEUE_LANES
+
+#ifdef QF_EVT_COALESCE
+//****************************************************************************
+/// @description
+/// Enables or disables coalescing of the static events with the signal
+/// @p sig posted to the active object (see NOTE02). With coalescing
+/// enabled, a post of a static event is merged with an event of the same
+/// signal already pending in the event queue, instead of using up another
+/// entry in the queue. The merged posts are counted (see
+/// QP::QActive::getMerged()) and reported by the QS record
+/// QP::QS_QF_ACTIVE_POST_MERGE.
+///
+/// @param[in] sig    the signal (less than #QF_EVT_COALESCE)
+/// @param[in] enable enable (true) or disable (false) the coalescing
+///
+/// @attention
+/// Coalescing must be enabled only for the signals, whose static events
+/// carry no parameters, so that all such events are identical.
+///
+void QActive::setCoalesce(enum_t const sig, bool const enable) noexcept {
+    /// @pre the signal must be in range
+    Q_REQUIRE_ID(510, (Q_USER_SIG <= sig)
+                      && (sig < static_cast<enum_t>(QF_EVT_COALESCE)));
+
+    std::uint_fast16_t const s = static_cast<std::uint_fast16_t>(sig);
+    std::uint8_t const bit = static_cast<std::uint8_t>(1U << (s & 7U));
+    QF_CRIT_STAT_
+    QF_CRIT_ENTRY_();
+    if (enable) {
+        m_coalesce[s >> 3U] |= bit;
+    }
+    else {
+        m_coalesce[s >> 3U] &= static_cast<std::uint8_t>(~bit);
+    }
+    QF_CRIT_EXIT_();
+}
+
+//****************************************************************************
+/// @description
+/// Checks whether the post of the event @p e can be merged with an event
+/// of the same signal already pending in the event queue and counts the
+/// merged post. Must be called inside the critical section.
+///
+/// @returns
+/// 'true' when the post has been merged and 'false' otherwise.
+///
+bool QActive::merge_(QEvt const * const e) noexcept {
+    std::uint_fast16_t const sig = static_cast<std::uint_fast16_t>(e->sig);
+    bool merged = false;
+
+    // a static event with a signal covered by the coalescing masks?
+    if ((e->poolId_ == 0U) && (sig < QF_EVT_COALESCE)) {
+        std::uint8_t const bit = static_cast<std::uint8_t>(1U << (sig & 7U));
+        if ((m_coalesce[sig >> 3U] & m_pending[sig >> 3U] & bit) != 0U) {
+            ++m_nMerged;
+            merged = true;
+        }
+    }
+    return merged;
+}
+
+//****************************************************************************
+/// @description
+/// Marks the signal of the static event @p e as pending, when the event
+/// has been inserted into the event queue and coalescing is enabled for the
+/// signal, or clears the mark when the event leaves the queue. Must be
+/// called inside the critical section.
+///
+void QActive::pend_(QEvt const * const e, bool const pending) noexcept {
+    std::uint_fast16_t const sig = static_cast<std::uint_fast16_t>(e->sig);
+
+    // a static event with a signal covered by the coalescing masks?
+    if ((e->poolId_ == 0U) && (sig < QF_EVT_COALESCE)) {
+        std::uint8_t const bit = static_cast<std::uint8_t>(1U << (sig & 7U));
+        if (pending) {
+            m_pending[sig >> 3U] |=
+                static_cast<std::uint8_t>(m_coalesce[sig >> 3U] & bit);
+        }
+        else {
+            m_pending[sig >> 3U] &= static_cast<std::uint8_t>(~bit);
+        }
+    }
+}
+#endif // QF_EVT_COALESCE
+
+#endif // QF_LOCKFREE_EQUEUE
+
 //****************************************************************************
 /// @description
 /// Queries the minimum of free ever present in the given event queue of
@@ -400,6 +927,9 @@ std::uint_fast16_t QF::getQueueMin(std::uint_fast8_t const prio) noexcept {
 //****************************************************************************
 QTicker::QTicker(std::uint_fast8_t const tickRate) noexcept
   : QActive(nullptr)
+#ifdef QF_ATOMIC_TICKER
+  , m_nTicks(0U)
+#endif
 {
     // reuse m_head for tick-rate
     m_eQueue.m_head = static_cast<QEQueueCtr>(tickRate);
@@ -408,11 +938,15 @@ QTicker::QTicker(std::uint_fast8_t const tickRate) noexcept
 void QTicker::init(void const * const e) noexcept {
     static_cast<void>(e); // unused parameter
     m_eQueue.m_tail = 0U;
+#ifdef QF_ATOMIC_TICKER
+    m_nTicks = 0U;
+#endif
 }
 //............................................................................
 void QTicker::dispatch(QEvt const * const e) noexcept {
     static_cast<void>(e); // unused parameter
 
+#ifndef QF_ATOMIC_TICKER
     QF_CRIT_STAT_
     QF_CRIT_ENTRY_();
     QEQueueCtr nTicks = m_eQueue.m_tail; // # ticks since the last call
@@ -422,6 +956,21 @@ void QTicker::dispatch(QEvt const * const e) noexcept {
     for (; nTicks > 0U; --nTicks) {
         QF::TICK_X(static_cast<std::uint_fast8_t>(m_eQueue.m_head), this);
     }
+#else
+    // take all ticks counted since the last call, see NOTE04
+    QTimeEvtCtr const nTicks = QF_TICKER_CTR_TAKE_(m_nTicks);
+
+    // process all the ticks in one pass over the time events
+    if (nTicks > 0U) {
+#ifdef Q_SPY
+        QF::tickN_(static_cast<std::uint_fast8_t>(m_eQueue.m_head),
+                   nTicks, this);
+#else
+        QF::tickN_(static_cast<std::uint_fast8_t>(m_eQueue.m_head),
+                   nTicks);
+#endif
+    }
+#endif // QF_ATOMIC_TICKER
 }
 //............................................................................
 #ifdef Q_SPY
@@ -439,6 +988,30 @@ bool QTicker::post_(QEvt const * const e, std::uint_fast16_t const margin)
     static_cast<void>(e);      // unused parameter
     static_cast<void>(margin); // unused parameter
 
+#ifdef QF_ATOMIC_TICKER
+    // count the tick atomically, see NOTE04
+    QTimeEvtCtr const nTicks = QF_TICKER_CTR_INC_(m_nTicks);
+
+    // the tick counter must not overflow (the ticker starved for too long)
+    Q_ASSERT_ID(910, nTicks != static_cast<QTimeEvtCtr>(~0U));
+
+    // the ticker already has a tick event to process?
+    if (nTicks != 0U) {
+        QS_CRIT_STAT_
+        QS_BEGIN_PRE_(QS_QF_ACTIVE_POST_MERGE,
+                      QS::priv_.locFilter[QS::AO_OBJ], this)
+            QS_TIME_PRE_();      // timestamp
+            QS_OBJ_PRE_(sender); // the sender object
+            QS_SIG_PRE_(0U);     // the signal of the event
+            QS_OBJ_PRE_(this);   // this active object
+            QS_U16_PRE_((nTicks < 0xFFFFU) // number of ticks merged so far
+                        ? nTicks : 0xFFFFU);
+        QS_END_PRE_()
+
+        return true; // the tick is merged with the pending ones
+    }
+#endif // QF_ATOMIC_TICKER
+
     QF_CRIT_STAT_
     QF_CRIT_ENTRY_();
     if (m_eQueue.m_frontEvt == nullptr) {
@@ -455,7 +1028,9 @@ bool QTicker::post_(QEvt const * const e, std::uint_fast16_t const margin)
         QACTIVE_EQUEUE_SIGNAL_(this); // signal the event queue
     }
 
+#ifndef QF_ATOMIC_TICKER
     ++m_eQueue.m_tail; // account for one more tick event
+#endif
 
     QS_BEGIN_NOCRIT_PRE_(QS_QF_ACTIVE_POST,
                      QS::priv_.locFilter[QS::AO_OBJ], this)
@@ -481,3 +1056,71 @@ void QTicker::postLIFO(QEvt const * const e) noexcept {
 
 } // namespace QP
 
+//****************************************************************************
+// NOTE01:
+// With QF_EQUEUE_LANES, an active object with the priority lanes attached
+// (QActive::setLanes()) keeps the events of the signals mapped to the lanes
+// 1..QF_EQUEUE_LANES-1 in separate FIFO queues, while its own event queue
+// is the lane 0. The front of the event queue (m_frontEvt) remains the only
+// location, from which the kernels and ports take the events. Whenever the
+// front is vacated, QActive::get_() refills it from the highest non-empty
+// lane (found in O(1) by QF_LOG2() of the bitmask of the non-empty lanes)
+// and only then from the ring buffer of the lane 0. An event posted to an
+// empty event queue is delivered directly to the front, as before, so an
+// event of a higher lane waits at most for the one event already at the
+// front. The front always counts against the free entries of the lane 0,
+// while the other lanes count only the events waiting in them. The margin
+// of QActive::post_() is checked against the lane of the posted event, and
+// every lane keeps its own low-watermark (QELanes::getLaneMin()).
+// QActive::postLIFO() returns an event of a priority lane displaced from
+// the front back to the front of its lane, so the FIFO order within every
+// lane is preserved.
+//
+// NOTE02:
+// With QF_EVT_COALESCE, an active object can enable coalescing for the
+// signals (below QF_EVT_COALESCE) of its parameterless static events, such
+// as the timeouts or the "data ready" notifications, with
+// QActive::setCoalesce(). The active object keeps two bitmasks indexed by
+// the signal: the signals with coalescing enabled and the signals, whose
+// static event is pending in the event queue. A post of a static event with
+// both bits set is merged in O(1): it counts as delivered (returns 'true'
+// regardless of the margin), but uses up no entry in the queue, so a burst
+// of identical events occupies a single entry and cannot overflow the
+// queue. The pending bit is set when such an event is inserted into the
+// queue by QActive::post_() (or QF::publish_()) and cleared when any static
+// event of the signal leaves the queue, so a set bit always means that the
+// event is still waiting in the queue (the bit might be clear with an event
+// waiting, e.g., after QActive::postLIFO(), which only costs a missed merge).
+// Every merged post increments the counter QActive::getMerged() and
+// produces the QS record QS_QF_ACTIVE_POST_MERGE with the counter value.
+//
+// NOTE03:
+// QActive::recallN() and QActive::recallIf() move many deferred events in
+// a single critical section, instead of two critical sections per event of
+// QActive::recall(). The events of the deferred queue are visited from the
+// newest to the oldest and every recalled event is posted LIFO (with the
+// same accounting and priority lanes as QActive::postLIFO()), which leaves
+// the recalled events at the front of the event queue of the active object
+// in their original (FIFO) order. The events not recalled are packed in
+// place towards the newest end of the deferred ring buffer, so that the
+// vacated entries are all at the oldest end and are removed at once by
+// advancing the tail of the deferred queue.
+//
+// NOTE04:
+// With QF_ATOMIC_TICKER, QTicker::post_() counts the ticks in m_nTicks with
+// an atomic increment (QF_TICKER_CTR_INC_()). The counter is as wide as
+// QTimeEvtCtr, the number of ticks QF::tickN_() can process at once, and
+// asserts rather than wraps around when the ticker thread starves for that
+// many ticks. Only the post that finds the counter at zero enters the
+// critical section to deliver the tick event to the front of the queue, while
+// all other posts just add to the counter and are reported as
+// QS_QF_ACTIVE_POST_MERGE. The tick event cannot be delivered twice, because
+// the counter is reset to zero only in QTicker::dispatch(), that is, after
+// the event has been taken from the queue. QTicker::dispatch() atomically
+// takes all the ticks counted so far (QF_TICKER_CTR_TAKE_()) and processes
+// them in one pass over the time events of its tick rate (QF::tickN_()), so
+// the queue of the ticker never grows and no tick is lost when the ticker
+// thread is starved of CPU. The default QF_TICKER_CTR_INC_() and
+// QF_TICKER_CTR_TAKE_() use the GCC atomic built-ins and a port can replace
+// them.
+//
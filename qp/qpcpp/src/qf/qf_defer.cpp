@@ -108,7 +108,9 @@ bool QActive::defer(QEQueue * const eq, QEvt const * const e) const noexcept {
 /// different kinds.
 ///
 /// @sa
-/// QP::QActive::recall(), QP::QEQueue, QP::QActive::postLIFO_()
+/// QP::QActive::recall(), QP::QEQueue, QP::QActive::postLIFO_(),
+/// QP::QActive::recallN() and QP::QActive::recallIf() to recall many
+/// deferred events at once
 ///
 bool QActive::recall(QEQueue * const eq) noexcept {
     QEvt const * const e = eq->get(); // try to get evt from deferred queue
@@ -54,6 +54,190 @@ Q_DEFINE_THIS_MODULE("qf_dyn")
 QF_EPOOL_TYPE_ QF_pool_[QF_MAX_EPOOL]; // allocate the event pools
 std::uint_fast8_t QF_maxPool_; // number of initialized event pools
 
+#ifdef QF_EPOOL_EVT_SIZES
+
+// Local objects *************************************************************
+//! event sizes of the event pools in the order of QF::poolInit() calls,
+//! given as the comma-separated list QF_EPOOL_EVT_SIZES, see NOTE03
+static constexpr std::uint_fast16_t l_poolEvtSize[] = { QF_EPOOL_EVT_SIZES };
+static_assert(Q_DIM(l_poolEvtSize) <= QF_MAX_EPOOL,
+              "QF_EPOOL_EVT_SIZES lists more event pools than QF_MAX_EPOOL");
+
+//! number of event-size classes looked up directly in QF::newX_()
+/// @description
+/// Event sizes are grouped in classes of sizeof(QFreeBlock) bytes
+/// (the granularity of the QP::QMPool block sizes). Events bigger than
+/// the covered sizes are still supported, but the event pool for them
+/// is found by the linear search.
+#define QF_EPOOL_SIZE_CLASSES 32U
+
+//! size class of an event of the size @p evtSize
+static constexpr std::uint_fast16_t QF_sizeClass_(
+    std::uint_fast16_t const evtSize) noexcept
+{
+    return (evtSize + (sizeof(QFreeBlock) - 1U)) / sizeof(QFreeBlock);
+}
+
+//! (pool-index + 1) of the first event pool from @p idx on that can hold
+//! the events of the size class @p sc, or 0 if none of them can
+static constexpr std::uint8_t QF_poolOfClass_(
+    std::uint_fast16_t const sc, std::uint_fast8_t const idx) noexcept
+{
+    return (idx == Q_DIM(l_poolEvtSize))
+        ? static_cast<std::uint8_t>(0U)
+        : ((sc <= QF_sizeClass_(l_poolEvtSize[idx]))
+           ? static_cast<std::uint8_t>(idx + 1U)
+           : QF_poolOfClass_(sc, static_cast<std::uint_fast8_t>(idx + 1U)));
+}
+
+#define QF_POOL_LUT1_(sc_)  QF_poolOfClass_((sc_), 0U)
+#define QF_POOL_LUT4_(sc_)  \
+    QF_POOL_LUT1_(sc_),        QF_POOL_LUT1_((sc_) + 1U), \
+    QF_POOL_LUT1_((sc_) + 2U), QF_POOL_LUT1_((sc_) + 3U)
+#define QF_POOL_LUT16_(sc_) \
+    QF_POOL_LUT4_(sc_),        QF_POOL_LUT4_((sc_) + 4U), \
+    QF_POOL_LUT4_((sc_) + 8U), QF_POOL_LUT4_((sc_) + 12U)
+
+//! lookup table of the (pool-index + 1) for every event-size class,
+//! where 0 means that no event pool can hold the events of that class
+static constexpr std::uint8_t l_poolLut[QF_EPOOL_SIZE_CLASSES + 1U] = {
+    QF_POOL_LUT16_(0U), QF_POOL_LUT16_(16U), QF_POOL_LUT1_(32U)
+};
+
+#endif // QF_EPOOL_EVT_SIZES
+
+#ifdef QF_EPOOL_MAGAZINE
+
+//! per-thread magazine of free blocks of one event pool, see NOTE01
+struct QF_EPoolMag {
+    std::uint_fast16_t nBlocks;          //!< # blocks in the magazine
+    std::uint8_t busy;                   //!< magazine being accessed?
+    void *blocks[QF_EPOOL_MAGAZINE];     //!< the cached blocks (LIFO)
+};
+
+//! per-thread magazines for all event pools
+struct QF_EPoolMags {
+    QF_EPoolMag mag[QF_MAX_EPOOL];
+    QF_EPoolMags *next; //!< magazines of the next thread
+
+    QF_EPoolMags() noexcept;
+    ~QF_EPoolMags();
+};
+
+//! magazines of all threads, so that they can be flushed, see NOTE01
+static QF_EPoolMags *l_magList;
+
+static thread_local QF_EPoolMags l_mags;
+
+//............................................................................
+//! register the magazines of the thread when it first uses them
+QF_EPoolMags::QF_EPoolMags() noexcept {
+    QF_CRIT_STAT_
+    QF_CRIT_ENTRY_();
+    next = l_magList;
+    l_magList = this;
+    QF_CRIT_EXIT_();
+}
+//............................................................................
+//! return all cached blocks to the pools when the thread exits
+QF_EPoolMags::~QF_EPoolMags() {
+    QF_CRIT_STAT_
+    QF_CRIT_ENTRY_();
+    QF_EPoolMags **prev = &l_magList;
+    while (*prev != this) {
+        prev = &(*prev)->next;
+    }
+    *prev = next; // unlink, so that no other thread can flush them
+    QF_CRIT_EXIT_();
+
+    for (std::uint_fast8_t idx = 0U; idx < QF_maxPool_; ++idx) {
+        QF_pool_[idx].putN(&mag[idx].blocks[0], mag[idx].nBlocks);
+        mag[idx].nBlocks = 0U;
+    }
+}
+//............................................................................
+//! wait while another thread flushes the magazine @p mag
+static inline void QF_magLock_(QF_EPoolMag &mag) noexcept {
+    while (__atomic_exchange_n(&mag.busy, 1U, __ATOMIC_ACQUIRE) != 0U) {
+    }
+}
+//............................................................................
+static inline void QF_magUnlock_(QF_EPoolMag &mag) noexcept {
+    __atomic_store_n(&mag.busy, 0U, __ATOMIC_RELEASE);
+}
+//............................................................................
+//! move the blocks cached by another thread to the empty magazine @p own,
+//! returns false if no other magazine of the pool @p idx had any blocks
+static bool QF_magFlush_(std::uint_fast8_t const idx,
+                         QF_EPoolMag &own) noexcept
+{
+    std::uint_fast16_t n = 0U;
+    QF_CRIT_STAT_
+    QF_CRIT_ENTRY_(); // protects the list of the magazines
+    for (QF_EPoolMags *m = l_magList; (m != nullptr) && (n == 0U);
+         m = m->next)
+    {
+        QF_EPoolMag &mag = m->mag[idx];
+
+        // skip the magazines being used by their threads right now
+        if ((&mag != &own)
+            && (__atomic_exchange_n(&mag.busy, 1U, __ATOMIC_ACQUIRE) == 0U))
+        {
+            n = mag.nBlocks;
+            for (std::uint_fast16_t i = 0U; i < n; ++i) {
+                own.blocks[i] = mag.blocks[i];
+            }
+            mag.nBlocks = 0U;
+            QF_magUnlock_(mag);
+        }
+    }
+    QF_CRIT_EXIT_();
+    own.nBlocks = n;
+    return n != 0U;
+}
+//............................................................................
+static void *QF_magGet_(std::uint_fast8_t const idx,
+                        std::uint_fast16_t const margin) noexcept
+{
+    QMPool &pool = QF_pool_[idx];
+    if (!pool.reserve(margin)) { // cannot honor the margin?
+        return nullptr;
+    }
+
+    QF_EPoolMag &mag = l_mags.mag[idx];
+    QF_magLock_(mag);
+    // empty magazine? refill it with half a load, or else take over the
+    // blocks cached by other threads, which are all counted as available
+    // by reserve(), so that a reserved block is always found (NOTE01)
+    while ((mag.nBlocks == 0U)
+           && ((mag.nBlocks = pool.getN(&mag.blocks[0],
+                                        QF_EPOOL_MAGAZINE / 2U)) == 0U)
+           && (!QF_magFlush_(idx, mag)))
+    {
+    }
+    --mag.nBlocks;
+    void * const b = mag.blocks[mag.nBlocks];
+    QF_magUnlock_(mag);
+    return b;
+}
+//............................................................................
+static void QF_magPut_(std::uint_fast8_t const idx, void * const b) noexcept {
+    QMPool &pool = QF_pool_[idx];
+    QF_EPoolMag &mag = l_mags.mag[idx];
+
+    QF_magLock_(mag);
+    if (mag.nBlocks == QF_EPOOL_MAGAZINE) { // full magazine? flush half
+        mag.nBlocks -= QF_EPOOL_MAGAZINE / 2U;
+        pool.putN(&mag.blocks[mag.nBlocks], QF_EPOOL_MAGAZINE / 2U);
+    }
+    mag.blocks[mag.nBlocks] = b;
+    ++mag.nBlocks;
+    QF_magUnlock_(mag);
+    pool.release();
+}
+
+#endif // QF_EPOOL_MAGAZINE
+
 //****************************************************************************
 /// @description
 /// This function initializes one event pool at a time and must be called
@@ -101,6 +285,14 @@ void QF::poolInit(void * const poolSto,
     QF_EPOOL_INIT_(QF_pool_[QF_maxPool_], poolSto, poolSize, evtSize);
     ++QF_maxPool_; // one more pool
 
+#ifdef QF_EPOOL_EVT_SIZES
+    /// @pre the event size must match the QF_EPOOL_EVT_SIZES entry
+    /// assumed for this pool by the lookup in QP::QF::newX_()
+    Q_REQUIRE_ID(202, (QF_maxPool_ <= Q_DIM(l_poolEvtSize))
+        && (QF_sizeClass_(evtSize)
+            == QF_sizeClass_(l_poolEvtSize[QF_maxPool_ - 1U])));
+#endif // QF_EPOOL_EVT_SIZES
+
 #ifdef Q_SPY
     // generate the object-dictionary entry for the initialized pool
     char_t obj_name[9] = "EvtPool?";
@@ -142,6 +334,14 @@ QEvt *QF::newX_(std::uint_fast16_t const evtSize,
 {
     std::uint_fast8_t idx;
 
+#ifdef QF_EPOOL_EVT_SIZES
+    // event size covered by the lookup table?
+    if (QF_sizeClass_(evtSize) < Q_DIM(l_poolLut)) {
+        idx = static_cast<std::uint_fast8_t>(
+                  l_poolLut[QF_sizeClass_(evtSize)] - 1U);
+    }
+    else
+#endif // QF_EPOOL_EVT_SIZES
     // find the pool id that fits the requested event size ...
     for (idx = 0U; idx < QF_maxPool_; ++idx) {
         if (evtSize <= QF_EPOOL_EVENT_SIZE_(QF_pool_[idx])) {
@@ -160,7 +360,12 @@ QEvt *QF::newX_(std::uint_fast16_t const evtSize,
 
     // get e -- platform-dependent
     QEvt *e;
+#ifndef QF_EPOOL_MAGAZINE
     QF_EPOOL_GET_(QF_pool_[idx], e, ((margin != QF_NO_MARGIN) ? margin : 0U));
+#else
+    e = static_cast<QEvt *>(QF_magGet_(idx,
+            ((margin != QF_NO_MARGIN) ? margin : 0U)));
+#endif
 
     // was e allocated correctly?
     if (e != nullptr) {
@@ -201,6 +406,32 @@ QEvt *QF::newX_(std::uint_fast16_t const evtSize,
 void QF::gc(QEvt const * const e) noexcept {
     // is it a dynamic event?
     if (e->poolId_ != 0U) {
+#ifdef QF_ATOMIC_EVT_REF_CTR
+        QS_CRIT_STAT_
+
+        // drop the reference atomically, see NOTE02
+        std::uint8_t const refCtr = QF_EVT_REF_CTR_DROP_(e);
+
+        // isn't this the last reference?
+        if (refCtr > 1U) {
+
+            QS_BEGIN_PRE_(QS_QF_GC_ATTEMPT, nullptr, nullptr)
+                QS_TIME_PRE_();        // timestamp
+                QS_SIG_PRE_(e->sig);   // the signal of the event
+                QS_2U8_PRE_(e->poolId_, refCtr); // pool Id & refCtr
+            QS_END_PRE_()
+        }
+        // this is the last reference to this event, recycle it
+        else {
+            std::uint_fast8_t const idx =
+                static_cast<std::uint_fast8_t>(e->poolId_) - 1U;
+
+            QS_BEGIN_PRE_(QS_QF_GC, nullptr, nullptr)
+                QS_TIME_PRE_();        // timestamp
+                QS_SIG_PRE_(e->sig);   // the signal of the event
+                QS_2U8_PRE_(e->poolId_, refCtr);
+            QS_END_PRE_()
+#else
         QF_CRIT_STAT_
         QF_CRIT_ENTRY_();
 
@@ -229,6 +460,7 @@ void QF::gc(QEvt const * const e) noexcept {
             QS_END_NOCRIT_PRE_()
 
             QF_CRIT_EXIT_();
+#endif // QF_ATOMIC_EVT_REF_CTR
 
             // pool ID must be in range
             Q_ASSERT_ID(410, idx < QF_maxPool_);
@@ -240,7 +472,11 @@ void QF::gc(QEvt const * const e) noexcept {
             QF_EVT_CONST_CAST_(e)->~QEvt(); // xtor,
 #endif
             // cast 'const' away, which is OK, because it's a pool event
+#ifndef QF_EPOOL_MAGAZINE
             QF_EPOOL_PUT_(QF_pool_[idx], QF_EVT_CONST_CAST_(e));
+#else
+            QF_magPut_(idx, QF_EVT_CONST_CAST_(e));
+#endif
         }
     }
 }
@@ -315,3 +551,48 @@ std::uint_fast16_t QF::poolGetMaxBlockSize(void) noexcept {
 
 } // namespace QP
 
+//****************************************************************************
+// NOTE01:
+// When the macro QF_EPOOL_MAGAZINE is defined (as the magazine capacity in
+// blocks, e.g., -DQF_EPOOL_MAGAZINE=16U), every thread caches free event
+// blocks in small thread-local "magazines", one per event pool. Allocation
+// and recycling of events then mostly operate on the magazine of the calling
+// thread without any critical section. An empty magazine is refilled with
+// QF_EPOOL_MAGAZINE/2 blocks and a full magazine is flushed by the same
+// amount, each time in a single critical section of the pool.
+//
+// The number of blocks available to the application (free plus cached in
+// the magazines) is tracked atomically in the pool, which keeps both the
+// 'margin' checks and the QP::QF::getPoolMin() low-watermark accurate.
+// When the pool itself runs empty while other threads still cache blocks,
+// the allocating thread takes over all blocks of another thread's magazine
+// (all magazines are linked in a list for that), so QF_NEW() asserts only
+// when the whole pool is really in use. Every magazine carries a "busy"
+// flag, which its thread sets with an uncontended atomic exchange around
+// each access. The thread taking over the blocks skips the magazines that
+// are busy at the moment, and the owner waits only while its magazine is
+// being emptied (a few instructions in the QF critical section).
+// The event pools can still be oversized by about (number of threads) *
+// QF_EPOOL_MAGAZINE blocks to keep such take-overs rare. This mode requires
+// the native QP::QMPool as QF_EPOOL_TYPE_, C++11 thread_local storage and
+// the GCC atomic built-ins, which are all available in the POSIX ports.
+//
+// NOTE02:
+// When the macro QF_ATOMIC_EVT_REF_CTR is defined, the reference counters
+// of dynamic events are managed with the GCC atomic built-ins instead of
+// inside the QF critical section (see QF_EVT_REF_CTR_INC_() and
+// QF_EVT_REF_CTR_DROP_() in qf_pkg.hpp). Only the holder of the last
+// reference returns the event to its pool, so QP::QF::gc() needs no
+// critical section of its own (except for QS tracing, if enabled).
+// The atomic decrement has the acquire-release semantics, so that all
+// accesses to the event by other holders happen before its recycling.
+//
+// NOTE03:
+// When the macro QF_EPOOL_EVT_SIZES is defined as the comma-separated list
+// of the event sizes passed to QP::QF::poolInit() (e.g.,
+// -DQF_EPOOL_EVT_SIZES=16U,64U,256U), QP::QF::newX_() finds the event pool
+// in a lookup table indexed by the event-size class instead of the linear
+// search over the pools. The table is a constexpr array computed by the
+// compiler, so it costs no initialization and can live in ROM.
+// QP::QF::poolInit() asserts that the pools are initialized with the listed
+// sizes, in the listed order.
@@ -68,6 +68,9 @@ QMPool::QMPool(void)
     m_nTot(0U),
     m_nFree(0U),
     m_nMin(0U)
+#ifdef QF_EPOOL_MAGAZINE
+    , m_nAvail(0U)
+#endif
 {}
 
 //****************************************************************************
@@ -150,6 +153,9 @@ void QMPool::init(void * const poolSto, std::uint_fast32_t poolSize,
     fb->m_next = nullptr; // the last link points to NULL
     m_nFree    = m_nTot;  // all blocks are free
     m_nMin     = m_nTot;  // the minimum number of free blocks
+#ifdef QF_EPOOL_MAGAZINE
+    m_nAvail   = m_nTot;  // no blocks held by the application
+#endif
     m_start    = poolSto; // the original start this pool buffer
     m_end      = fb;      // the last block in this pool
 }
@@ -283,6 +289,140 @@ void *QMPool::get(std::uint_fast16_t const margin) noexcept {
     return fb; // return the block or NULL pointer to the caller
 }
 
+#ifdef QF_EPOOL_MAGAZINE
+//****************************************************************************
+/// @description
+/// Accounts for one more block held by the application. This is used for
+/// the per-thread magazines, in which case the blocks cached in the
+/// magazines still count as free.
+///
+/// @param[in] margin  the minimum number of unallocated blocks still
+///                    available in the pool after the reservation
+///
+/// @returns
+/// 'true' if the block has been reserved and 'false' if the reservation
+/// would violate the @p margin.
+///
+/// @note
+/// This function does not use the critical section, but rather atomic
+/// compare-and-swap on the m_nAvail counter. The low-watermark m_nMin is
+/// updated here (and not in QP::QMPool::getN()), so QP::QF::getPoolMin()
+/// keeps reporting the minimum of the blocks available to the application.
+///
+bool QMPool::reserve(std::uint_fast16_t const margin) noexcept {
+    QMPoolCtr nAvail = __atomic_load_n(&m_nAvail, __ATOMIC_RELAXED);
+    do {
+        if (nAvail <= static_cast<QMPoolCtr>(margin)) {
+            return false;
+        }
+    } while (!__atomic_compare_exchange_n(&m_nAvail, &nAvail,
+                 static_cast<QMPoolCtr>(nAvail - 1U), true,
+                 __ATOMIC_ACQUIRE, __ATOMIC_RELAXED));
+
+    --nAvail; // one block just reserved
+    QMPoolCtr nMin = __atomic_load_n(&m_nMin, __ATOMIC_RELAXED);
+    while ((nMin > nAvail)
+           && !__atomic_compare_exchange_n(&m_nMin, &nMin, nAvail, true,
+                   __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    {}
+    return true;
+}
+
+//****************************************************************************
+/// @sa QP::QMPool::reserve()
+///
+void QMPool::release(void) noexcept {
+    QMPoolCtr const nAvail =
+        __atomic_add_fetch(&m_nAvail, 1U, __ATOMIC_RELEASE);
+
+    /// @post cannot release more blocks than the total # blocks
+    Q_ENSURE_ID(500, nAvail <= m_nTot);
+}
+
+//****************************************************************************
+/// @description
+/// Moves up to @p n blocks from the free list to the caller-provided array
+/// @p blocks[] (a magazine) in a single critical section.
+///
+/// @returns
+/// the number of blocks actually moved, which might be less than @p n
+/// (including zero) when the free list runs out of blocks.
+///
+/// @note
+/// The low-watermark of the pool is __not__ updated, because the moved
+/// blocks are still available for allocation (@sa QP::QMPool::reserve()).
+///
+std::uint_fast16_t QMPool::getN(void ** const blocks,
+                                std::uint_fast16_t const n) noexcept
+{
+    std::uint_fast16_t i = 0U;
+    QF_CRIT_STAT_
+
+    QF_CRIT_ENTRY_();
+    for (; (i < n) && (m_nFree > 0U); ++i) {
+        QFreeBlock * const fb = static_cast<QFreeBlock *>(m_free_head);
+        QFreeBlock * const fb_next = fb->m_next;
+
+        // the next free block must be NULL or in range, see QMPool::get()
+        Q_ASSERT_CRIT_(510, (fb_next == nullptr)
+            || QF_PTR_RANGE_(fb_next, m_start, m_end));
+
+        m_free_head = fb_next;
+        --m_nFree;
+        blocks[i] = fb;
+    }
+
+    QS_BEGIN_NOCRIT_PRE_(QS_QF_MPOOL_GET,
+                     QS::priv_.locFilter[QS::MP_OBJ], this)
+        QS_TIME_PRE_();        // timestamp
+        QS_OBJ_PRE_(this);     // this memory pool
+        QS_MPC_PRE_(m_nFree);  // the number of free blocks in the pool
+        QS_MPC_PRE_(m_nMin);   // the mninimum # free blocks in the pool
+    QS_END_NOCRIT_PRE_()
+
+    QF_CRIT_EXIT_();
+
+    return i;
+}
+
+//****************************************************************************
+/// @description
+/// Returns @p n blocks from the array @p blocks[] (a magazine) to the free
+/// list in a single critical section.
+///
+void QMPool::putN(void * const * const blocks,
+                  std::uint_fast16_t const n) noexcept
+{
+    QF_CRIT_STAT_
+
+    QF_CRIT_ENTRY_();
+
+    /// @pre # free blocks cannot exceed the total # blocks
+    Q_REQUIRE_CRIT_(520, (m_nFree + n) <= m_nTot);
+
+    for (std::uint_fast16_t i = 0U; i < n; ++i) {
+        void * const b = blocks[i];
+
+        /// @pre the block pointer must be in range to come from this pool
+        Q_REQUIRE_CRIT_(521, QF_PTR_RANGE_(b, m_start, m_end));
+
+        static_cast<QFreeBlock*>(b)->m_next =
+            static_cast<QFreeBlock *>(m_free_head); // link into free list
+        m_free_head = b;
+    }
+    m_nFree += static_cast<QMPoolCtr>(n);
+
+    QS_BEGIN_NOCRIT_PRE_(QS_QF_MPOOL_PUT,
+                     QS::priv_.locFilter[QS::MP_OBJ], this)
+        QS_TIME_PRE_();       // timestamp
+        QS_OBJ_PRE_(this);    // this memory pool
+        QS_MPC_PRE_(m_nFree); // the number of free blocks in the pool
+    QS_END_NOCRIT_PRE_()
+
+    QF_CRIT_EXIT_();
+}
+#endif // QF_EPOOL_MAGAZINE
+
 //****************************************************************************
 /// @description
 /// This function obtains the minimum number of free blocks in the given
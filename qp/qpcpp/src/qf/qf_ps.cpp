@@ -146,6 +146,8 @@ void QF::publish_(QEvt const * const e, void const * const sender) noexcept {
     }
 
     // make a local, modifiable copy of the subscriber list
+    // NOTE: the copy is made inside the critical section also with
+    // QF_ATOMIC_EVT_REF_CTR, because QPSet might span several words
     QPSet subscrList = QF_PTR_AT_(QF_subscrList_, e->sig);
     QF_CRIT_EXIT_();
 
@@ -155,6 +157,14 @@ void QF::publish_(QEvt const * const e, void const * const sender) noexcept {
         QF_SCHED_STAT_
 
         QF_SCHED_LOCK_(p); // lock the scheduler up to prio 'p'
+#if (defined QF_PUBLISH_BATCH) && (!defined Q_UTEST)
+#ifdef Q_SPY
+        publishBatch_(e, subscrList, sender); // see NOTE01
+#else
+        publishBatch_(e, subscrList, nullptr); // see NOTE01
+#endif
+        static_cast<void>(p); // used only for locking the scheduler
+#else
         do { // loop over all subscribers */
             // the prio of the AO must be registered with the framework
             Q_ASSERT_ID(210, active_[p] != nullptr);
@@ -170,6 +180,7 @@ void QF::publish_(QEvt const * const e, void const * const sender) noexcept {
                 p = 0U; // no more subscribers
             }
         } while (p != 0U);
+#endif // QF_PUBLISH_BATCH
         QF_SCHED_UNLOCK_(); // unlock the scheduler
     }
 
@@ -181,6 +192,141 @@ void QF::publish_(QEvt const * const e, void const * const sender) noexcept {
 }
 
 
+#if (defined QF_PUBLISH_BATCH) && (!defined Q_UTEST)
+#ifdef QF_LOCKFREE_EQUEUE
+    #error "QF_PUBLISH_BATCH requires the native QF event queues"
+#elif (!defined QF_NATIVE_EQUEUE_)
+    #error "QF_PUBLISH_BATCH requires the QV, QK or POSIX event queues"
+#endif
+//****************************************************************************
+/// @description
+/// Posts the event @p e to all active objects in @p subscrList (highest-
+/// priority first) in a single critical section, see NOTE01. The event
+/// queues must be able to accept the event, as with QF_NO_MARGIN.
+///
+void QF::publishBatch_(QEvt const * const e,
+                       QSubscrList const subscrList,
+                       void const * const sender) noexcept
+{
+    QSubscrList list = subscrList;
+    QSubscrList wakeList; // subscribers whose event queues were empty
+    wakeList.setEmpty();
+#ifdef QF_EVT_COALESCE
+    QSubscrList mergeList; // subscribers that merged the event (coalescing)
+    mergeList.setEmpty();
+#endif
+    std::uint_fast8_t nPosted = 0U;
+
+    QF_CRIT_STAT_
+    QF_CRIT_ENTRY_();
+
+    // 1st pass: insert the event into all subscriber queues
+    while (list.notEmpty()) {
+        std::uint_fast8_t const p = list.findMax();
+        list.rmove(p);
+
+        // the prio of the AO must be registered with the framework
+        Q_ASSERT_CRIT_(210, active_[p] != nullptr);
+        QActive * const a = active_[p];
+#ifdef QF_EVT_COALESCE
+        // an identical static event already pending in the queue?
+        if (a->merge_(e)) {
+            mergeList.insert(p); // trace the merge in the 2nd pass
+            continue;
+        }
+#endif
+#ifdef QF_EQUEUE_LANES
+        QEQueue &eq = a->laneQueue_(e->sig); // the lane of the event
+#else
+        QEQueue &eq = a->m_eQueue;
+#endif
+
+        // the event queue must be able to accept the event
+        QEQueueCtr const nFree = eq.m_nFree; // get volatile into temporary
+        Q_ASSERT_CRIT_(220, nFree > 0U);
+        eq.m_nFree = static_cast<QEQueueCtr>(nFree - 1U);
+        if (eq.m_nMin > eq.m_nFree) {
+            eq.m_nMin = eq.m_nFree; // update minimum so far
+        }
+
+        // empty queue?
+        if (a->m_eQueue.m_frontEvt == nullptr) {
+            a->m_eQueue.m_frontEvt = e; // deliver event directly
+            wakeList.insert(p); // signal the queue in the 2nd pass
+        }
+#ifdef QF_EQUEUE_LANES
+        // queue is not empty and the event belongs to a priority lane?
+        else if (&eq != &a->m_eQueue) {
+            a->laneInsert_(eq, e, false); // insert event into the lane
+        }
+#endif
+        // queue is not empty, insert event into the ring-buffer
+        else {
+            QF_PTR_AT_(eq.m_ring, eq.m_head) = e;
+            if (eq.m_head == 0U) { // need to wrap head?
+                eq.m_head = eq.m_end; // wrap around
+            }
+            --eq.m_head; // advance the head (counter clockwise)
+        }
+#ifdef QF_EVT_COALESCE
+        a->pend_(e, true); // the event becomes pending
+#endif
+        ++nPosted;
+    }
+
+    // is it a dynamic event? add all the references at once
+    if (e->poolId_ != 0U) {
+        QF_EVT_REF_CTR_ADD_(e, nPosted);
+    }
+
+    // 2nd pass: trace the posts and signal the queues that were empty
+    list = subscrList;
+    while (list.notEmpty()) {
+        std::uint_fast8_t const p = list.findMax();
+        list.rmove(p);
+        QActive * const a = active_[p];
+
+#ifdef QF_EVT_COALESCE
+        if (mergeList.hasElement(p)) {
+            QS_BEGIN_NOCRIT_PRE_(QS_QF_ACTIVE_POST_MERGE,
+                             QS::priv_.locFilter[QS::AO_OBJ], a)
+                QS_TIME_PRE_();      // timestamp
+                QS_OBJ_PRE_(sender); // the sender object
+                QS_SIG_PRE_(e->sig); // the signal of the event
+                QS_OBJ_PRE_(a);      // the active object
+                QS_U16_PRE_(a->m_nMerged); // number of merged posts so far
+            QS_END_NOCRIT_PRE_()
+            continue;
+        }
+#endif
+#ifdef Q_SPY
+#ifdef QF_EQUEUE_LANES
+        QEQueue const &eq = a->laneQueue_(e->sig); // the lane of the event
+#else
+        QEQueue const &eq = a->m_eQueue;
+#endif
+#endif // Q_SPY
+        QS_BEGIN_NOCRIT_PRE_(QS_QF_ACTIVE_POST,
+                         QS::priv_.locFilter[QS::AO_OBJ], a)
+            QS_TIME_PRE_();               // timestamp
+            QS_OBJ_PRE_(sender);          // the sender object
+            QS_SIG_PRE_(e->sig);          // the signal of the event
+            QS_OBJ_PRE_(a);               // the active object
+            QS_2U8_PRE_(e->poolId_, e->refCtr_); // pool Id & refCtr of the evt
+            QS_EQC_PRE_(eq.m_nFree);      // number of free entries
+            QS_EQC_PRE_(eq.m_nMin);       // min number of free entries
+        QS_END_NOCRIT_PRE_()
+
+        if (wakeList.hasElement(p)) {
+            QACTIVE_EQUEUE_SIGNAL_(a); // signal the event queue
+        }
+    }
+    QF_CRIT_EXIT_();
+
+    static_cast<void>(sender); // unused without Q_SPY
+}
+#endif // QF_PUBLISH_BATCH
+
 //****************************************************************************
 /// @description
 /// This function is part of the Publish-Subscribe event delivery mechanism
@@ -318,3 +464,26 @@ void QActive::unsubscribeAll(void) const noexcept {
 
 } // namespace QP
 
+
+//****************************************************************************
+// NOTE01:
+// When the macro QF_PUBLISH_BATCH is defined, QP::QF::publish_() delivers
+// the event to all subscribers with QP::QF::publishBatch_(), which inserts
+// the event into all subscriber queues in a single critical section, adds
+// all the references to a dynamic event at once, and only then signals
+// the queues that were empty (QACTIVE_EQUEUE_SIGNAL_()). This saves the
+// critical section and the reference counting per subscriber, which matters
+// for the signals with many subscribers. The scheduler remains locked up to
+// the highest-priority subscriber for the whole multicast, as before.
+//
+// The batched publishing bypasses the virtual QP::QActive::post_(), so it
+// requires the native QF event queues with the generic post_()
+// implementation in qf_actq.cpp. The kernels and ports that provide them
+// (QV, QK and the POSIX and POSIX-QV ports, but not with
+// QF_LOCKFREE_EQUEUE) define the internal macro QF_NATIVE_EQUEUE_. The ports
+// to third-party RTOSes (e.g., FreeRTOS, embOS, ThreadX or uC/OS-II) post
+// the events with their own mechanisms and cannot use QF_PUBLISH_BATCH.
+// Neither can QXK, where the QP::QXThread subscribers override post_() to
+// unblock the thread waiting on its queue (and to disarm its timeout).
+// It is not used in the QUTest builds (Q_UTEST), where the active objects
+// might be replaced by dummies.
@@ -44,6 +44,15 @@ namespace QP {
 QActive::QActive(QStateHandler const initial) noexcept
   : QHsm(initial),
     m_prio(0U)
+#ifdef QF_EVT_BURST
+    , m_burst(1U) // no bursts unless the AO opts in with setBurst()
+#endif
+#ifdef QF_EQUEUE_LANES
+    , m_lanes(nullptr)
+#endif
+#ifdef QF_EVT_COALESCE
+    , m_nMerged(0U)
+#endif
 {
     m_state.fun = Q_STATE_CAST(&QHsm::top);
 
@@ -54,6 +63,11 @@ QActive::QActive(QStateHandler const initial) noexcept
 #ifdef QF_THREAD_TYPE
     QF::bzero(&m_thread, sizeof(m_thread));
 #endif
+
+#ifdef QF_EVT_COALESCE
+    QF::bzero(&m_coalesce[0], sizeof(m_coalesce));
+    QF::bzero(&m_pending[0], sizeof(m_pending));
+#endif
 }
 
 } // namespace QP
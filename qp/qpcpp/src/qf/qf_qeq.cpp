@@ -324,5 +324,63 @@ QEvt const *QEQueue::get(void) noexcept {
     return e;
 }
 
-} // namespace QP
+#ifdef QF_EQUEUE_LANES
+//****************************************************************************
+/// @description
+/// Default constructor of the priority lanes
+///
+QELanes::QELanes(void) noexcept
+  : m_laneOf(nullptr),
+    m_nSigs(0U),
+    m_ready(0U)
+{}
+
+//****************************************************************************
+/// @description
+/// Initializes the priority lane @p lane by giving it the storage for
+/// the ring buffer.
+///
+/// @param[in] lane the lane to initialize (1..#QF_EQUEUE_LANES-1)
+/// @param[in] qSto an array of pointers to QP::QEvt to serve as the
+///                 ring buffer of the lane
+/// @param[in] qLen the length of the qSto[] buffer (in QP::QEvt pointers)
+///
+/// @note
+/// Like in QP::QEQueue::init(), the capacity of the lane is qLen + 1.
+///
+void QELanes::initLane(std::uint_fast8_t const lane,
+                       QEvt const *qSto[],
+                       std::uint_fast16_t const qLen) noexcept
+{
+    /// @pre the lane must be in range
+    Q_REQUIRE_ID(500, (0U < lane) && (lane < QF_EQUEUE_LANES));
+    m_lane[lane - 1U].init(qSto, qLen);
+}
 
+//****************************************************************************
+/// @description
+/// Sets the lanes of the signals for the priority lanes.
+///
+/// @param[in] laneOf the lanes (0..#QF_EQUEUE_LANES-1) of the signals
+///                   0..nSigs-1
+/// @param[in] nSigs  the number of signals in laneOf[]
+///
+/// @note
+/// All the lanes used in laneOf[] must be initialized with
+/// QP::QELanes::initLane().
+///
+void QELanes::setLaneMap(std::uint8_t const * const laneOf,
+                         QSignal const nSigs) noexcept
+{
+    for (QSignal sig = 0U; sig < nSigs; ++sig) {
+        /// @pre every lane must be in range and initialized
+        Q_REQUIRE_ID(510, (laneOf[sig] == 0U)
+            || ((laneOf[sig] < QF_EQUEUE_LANES)
+                && (m_lane[laneOf[sig] - 1U].m_ring != nullptr)));
+    }
+    m_laneOf = laneOf;
+    m_nSigs  = nSigs;
+}
+#endif // QF_EQUEUE_LANES
+
+} // namespace QP
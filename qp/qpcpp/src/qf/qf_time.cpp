@@ -54,6 +54,81 @@ Q_DEFINE_THIS_MODULE("qf_time")
 // Package-scope objects *****************************************************
 QTimeEvt QF::timeEvtHead_[QF_MAX_TICK_RATE]; // heads of time event lists
 
+#ifdef QF_TIMEEVT_WHEEL
+
+//! number of slots in every level of the timing wheel
+constexpr std::uint_fast16_t QF_WHEEL_SLOTS = 1U << QF_TIMEEVT_WHEEL_BITS;
+
+//! number of levels covering the whole dynamic range of QP::QTimeEvtCtr
+constexpr std::uint_fast8_t QF_WHEEL_LEVELS = static_cast<std::uint_fast8_t>(
+    ((8U * sizeof(QTimeEvtCtr)) + QF_TIMEEVT_WHEEL_BITS - 1U)
+    / QF_TIMEEVT_WHEEL_BITS);
+
+//! hierarchical timing wheel of one clock tick rate, see NOTE2
+struct QTimeWheel {
+    //! heads of the time event lists in every slot of every level
+    QTimeEvt * volatile slot[QF_WHEEL_LEVELS][QF_WHEEL_SLOTS];
+
+    //! head of the list of time events detached for processing in tickX_()
+    QTimeEvt * volatile expiring;
+
+    //! the tick counter of this tick rate
+    QTimeEvtCtr now;
+
+    //! the tick counter including the clock ticks marked for QF::tickN_()
+    QTimeEvtCtr marked;
+
+    //! number of time events currently linked into the wheel
+    std::uint_fast16_t nLinked;
+};
+
+// Local objects *************************************************************
+static QTimeWheel l_wheel[QF_MAX_TICK_RATE]; // timing wheels for all rates
+
+#if (defined QF_ATOMIC_TICKER) || (defined QF_TICKLESS)
+//! the number of clock ticks (at most @p dist) until the nearest tick, at
+//! which QF::tickX_() would find any of its current slots occupied
+static QTimeEvtCtr wheelSkip(QTimeWheel const &wheel,
+                             QTimeEvtCtr const dist) noexcept
+{
+    std::uint32_t skip = dist;
+    if (wheel.nLinked != 0U) {
+        for (std::uint_fast8_t level = 0U; level < QF_WHEEL_LEVELS; ++level)
+        {
+            // the current slot of this level changes every 'step' ticks
+            std::uint32_t const step = static_cast<std::uint32_t>(1U)
+                                       << (level * QF_TIMEEVT_WHEEL_BITS);
+            std::uint32_t d = step
+                - (static_cast<std::uint32_t>(wheel.now) & (step - 1U));
+
+            // one rotation of the level at most
+            for (std::uint_fast16_t n = 0U;
+                 (n < QF_WHEEL_SLOTS) && (d < skip);
+                 ++n)
+            {
+                QTimeEvtCtr const tick =
+                    static_cast<QTimeEvtCtr>(wheel.now + d);
+                if (wheel.slot[level][(static_cast<std::uint32_t>(tick)
+                                       >> (level * QF_TIMEEVT_WHEEL_BITS))
+                                      & (QF_WHEEL_SLOTS - 1U)] != nullptr)
+                {
+                    skip = d; // the nearest occupied slot so far
+                }
+                else if ((skip - d) > step) {
+                    d += step;
+                }
+                else {
+                    break; // the next slot is not nearer than 'skip'
+                }
+            }
+        }
+    }
+    return static_cast<QTimeEvtCtr>(skip);
+}
+#endif // (defined QF_ATOMIC_TICKER) || (defined QF_TICKLESS)
+
+#endif // QF_TIMEEVT_WHEEL
+
 #ifdef Q_SPY
 //****************************************************************************
 /// @description
@@ -81,6 +156,7 @@ void QF::tickX_(std::uint_fast8_t const tickRate,
 void QF::tickX_(std::uint_fast8_t const tickRate) noexcept
 #endif
 {
+#ifndef QF_TIMEEVT_WHEEL
     QTimeEvt *prev = &timeEvtHead_[tickRate];
     QF_CRIT_STAT_
 
@@ -177,8 +253,353 @@ void QF::tickX_(std::uint_fast8_t const tickRate) noexcept
         QF_CRIT_ENTRY_(); // re-enter crit. section to continue
     }
     QF_CRIT_EXIT_();
+
+#else // timing wheel, see NOTE2
+
+    QTimeWheel &wheel = l_wheel[tickRate];
+    QF_CRIT_STAT_
+
+    QF_CRIT_ENTRY_();
+    ++wheel.now;
+    QTimeEvtCtr const now = wheel.now;
+    wheel.marked = now; // no clock ticks marked ahead, see NOTE3
+
+    QS_BEGIN_NOCRIT_PRE_(QS_QF_TICK, nullptr, nullptr)
+        QS_TEC_PRE_(now);         // tick ctr
+        QS_U8_PRE_(tickRate);     // tick rate
+    QS_END_NOCRIT_PRE_()
+    QF_CRIT_EXIT_();
+
+#ifdef Q_SPY
+    wheelTick_(tickRate, now, sender);
+#else
+    wheelTick_(tickRate, now);
+#endif
+
+#endif // QF_TIMEEVT_WHEEL
 }
 
+#ifdef QF_TIMEEVT_WHEEL
+//****************************************************************************
+/// @description
+/// Processes the current slots of the timing wheel at the tick @p now,
+/// that is, posts the time events expiring at that tick and cascades the
+/// other time events from the slots down to the lower levels (see NOTE2).
+///
+/// @note
+/// Must be called outside of the critical section, with the tick counter
+/// of the wheel already advanced to @p now.
+///
+#ifdef Q_SPY
+void QF::wheelTick_(std::uint_fast8_t const tickRate,
+                    QTimeEvtCtr const now,
+                    void const * const sender) noexcept
+#else
+void QF::wheelTick_(std::uint_fast8_t const tickRate,
+                    QTimeEvtCtr const now) noexcept
+#endif
+{
+    QTimeWheel &wheel = l_wheel[tickRate];
+    QF_CRIT_STAT_
+
+    QF_CRIT_ENTRY_();
+
+    // find the highest level, whose current slot starts at this tick
+    std::uint_fast8_t level = 0U;
+    while ((level < (QF_WHEEL_LEVELS - 1U))
+           && ((static_cast<std::uint32_t>(now)
+                & ((static_cast<std::uint32_t>(1U)
+                    << ((level + 1U) * QF_TIMEEVT_WHEEL_BITS)) - 1U)) == 0U))
+    {
+        ++level;
+    }
+
+    // process the current slots from that level down to the level 0...
+    for (;;) {
+        // detach the whole list of the current slot for processing
+        QTimeEvt * volatile * const slot = &wheel.slot[level][
+            (static_cast<std::uint32_t>(now)
+             >> (level * QF_TIMEEVT_WHEEL_BITS)) & (QF_WHEEL_SLOTS - 1U)];
+        QTimeEvt *t = *slot;
+        *slot = nullptr;
+        wheel.expiring = t;
+        if (t != nullptr) {
+            t->m_pprev = &wheel.expiring;
+        }
+
+        // process the detached time events one at a time, so that the
+        // critical section does not depend on the number of time events
+        for (t = wheel.expiring; t != nullptr; t = wheel.expiring) {
+            t->wheelUnlink_();
+
+            // not expiring at this tick?
+            if (t->m_due != now) {
+                // cascade the time event to a lower level of the wheel
+                t->wheelLink_(static_cast<QTimeEvtCtr>(t->m_due - now));
+
+                QF_CRIT_EXIT_(); // exit crit. section to reduce latency
+
+                // prevent merging critical sections, see NOTE1 below
+                QF_CRIT_EXIT_NOP();
+            }
+            else {
+                QActive * const act = t->toActive(); // temporary for volatile
+
+                // periodic time evt?
+                if (t->m_interval != 0U) {
+                    t->m_ctr = t->m_interval; // rearm the time event
+                    t->wheelLink_(t->m_interval);
+                }
+                // one-shot time event: automatically disarm
+                else {
+                    t->m_ctr = 0U;
+
+                    QS_BEGIN_NOCRIT_PRE_(QS_QF_TIMEEVT_AUTO_DISARM,
+                                     QS::priv_.locFilter[QS::TE_OBJ], t)
+                        QS_OBJ_PRE_(t);       // this time event object
+                        QS_OBJ_PRE_(act);     // the target AO
+                        QS_U8_PRE_(tickRate); // tick rate
+                    QS_END_NOCRIT_PRE_()
+                }
+
+                QS_BEGIN_NOCRIT_PRE_(QS_QF_TIMEEVT_POST,
+                                 QS::priv_.locFilter[QS::TE_OBJ], t)
+                    QS_TIME_PRE_();       // timestamp
+                    QS_OBJ_PRE_(t);       // the time event object
+                    QS_SIG_PRE_(t->sig);  // signal of this time event
+                    QS_OBJ_PRE_(act);     // the target AO
+                    QS_U8_PRE_(tickRate); // tick rate
+                QS_END_NOCRIT_PRE_()
+
+                QF_CRIT_EXIT_(); // exit crit. section before posting
+
+                // asserts if queue overflows
+                static_cast<void>(act->POST(t, sender));
+            }
+            QF_CRIT_ENTRY_(); // re-enter crit. section to continue
+        }
+
+        if (level == 0U) {
+            break; // all current slots processed
+        }
+        --level;
+    }
+    QF_CRIT_EXIT_();
+}
+#endif // QF_TIMEEVT_WHEEL
+
+#if (defined QF_ATOMIC_TICKER) || (defined QF_TICKLESS)
+//****************************************************************************
+/// @description
+/// Processes all armed time events at the given tick rate for @p nTicks
+/// clock ticks in a single pass, as though QP::QF::tickX_() were called
+/// @p nTicks times. A periodic time event expiring more than once within
+/// the @p nTicks clock ticks is posted once for every expiration.
+///
+/// @param[in] tickRate  clock tick rate serviced in this call [1..15].
+/// @param[in] nTicks    number of clock ticks to process at once.
+/// @param[in] sender    pointer to a sender object (used in QS only).
+///
+/// @note
+/// this function is used by QP::QTicker::dispatch() (see NOTE04 in
+/// qf_actq.cpp) and by the "tickless" clock tick loops of the POSIX ports
+/// (see the macro TICK_N())
+///
+/// @note
+/// a time event armed after the @p nTicks clock ticks were marked (see
+/// QP::QF::tickMark_()) is not counted down by any of them. Without the
+/// mark, this function marks the clock ticks itself on entry.
+///
+#ifdef Q_SPY
+void QF::tickN_(std::uint_fast8_t const tickRate,
+                QTimeEvtCtr const nTicks,
+                void const * const sender) noexcept
+#else
+void QF::tickN_(std::uint_fast8_t const tickRate,
+                QTimeEvtCtr const nTicks) noexcept
+#endif
+{
+#ifndef QF_TIMEEVT_WHEEL
+    QTimeEvt *prev = &timeEvtHead_[tickRate];
+    QF_CRIT_STAT_
+
+    QF_CRIT_ENTRY_();
+
+    // mark the clock ticks, unless marked already (see NOTE3 below)
+    if ((prev->refCtr_ & TE_TICK_MARKED) == 0U) {
+        prev->refCtr_ = static_cast<std::uint8_t>(
+                            prev->refCtr_ ^ TE_TICK_PHASE);
+    }
+    prev->refCtr_ &= static_cast<std::uint8_t>(~TE_TICK_MARKED);
+    std::uint8_t const phase = prev->refCtr_ & TE_TICK_PHASE;
+
+    QS_BEGIN_NOCRIT_PRE_(QS_QF_TICK, nullptr, nullptr)
+        prev->m_ctr += nTicks;
+        QS_TEC_PRE_(prev->m_ctr); // tick ctr
+        QS_U8_PRE_(tickRate);     // tick rate
+    QS_END_NOCRIT_PRE_()
+
+    // scan the linked-list of time events at this rate...
+    for (;;) {
+        QTimeEvt *t = prev->m_next; // advance down the time evt. list
+
+        // end of the list?
+        if (t == nullptr) {
+
+            // any new time events armed since the last run of QF::tickN_()?
+            if (timeEvtHead_[tickRate].m_act != nullptr) {
+
+                // sanity check
+                Q_ASSERT_CRIT_(210, prev != nullptr);
+                prev->m_next = QF::timeEvtHead_[tickRate].toTimeEvt();
+                timeEvtHead_[tickRate].m_act = nullptr;
+                t = prev->m_next; // switch to the new list
+            }
+            else {
+                break; // all currently armed time evts. processed
+            }
+        }
+
+        // armed after the clock ticks were marked? (see NOTE3 below)
+        QTimeEvtCtr const n = ((t->refCtr_ & TE_TICK_PHASE) == phase)
+                              ? static_cast<QTimeEvtCtr>(0U)
+                              : nTicks;
+        t->refCtr_ = static_cast<std::uint8_t>(
+            (t->refCtr_ & static_cast<std::uint8_t>(~TE_TICK_PHASE)) | phase);
+
+        // time event scheduled for removal?
+        if (t->m_ctr == 0U) {
+            prev->m_next = t->m_next;
+            // mark time event 't' as NOT linked
+            t->refCtr_ &= static_cast<std::uint8_t>(~TE_IS_LINKED);
+            // do NOT advance the prev pointer
+            QF_CRIT_EXIT_(); // exit crit. section to reduce latency
+
+            // prevent merging critical sections, see NOTE1 below
+            QF_CRIT_EXIT_NOP();
+        }
+        // time evt. not expiring within the n ticks?
+        else if (t->m_ctr > n) {
+            t->m_ctr -= n;
+            prev = t; // advance to this time event
+            QF_CRIT_EXIT_(); // exit crit. section to reduce latency
+
+            // prevent merging critical sections, see NOTE1 below
+            QF_CRIT_EXIT_NOP();
+        }
+        else {
+            QActive * const act = t->toActive(); // temporary for volatile
+            QTimeEvtCtr nPosts = 1U; // expirations within the n ticks
+
+            // periodic time evt?
+            if (t->m_interval != 0U) {
+                // ticks remaining after the first expiration
+                QTimeEvtCtr const rest = n - t->m_ctr;
+                nPosts += rest / t->m_interval;
+                t->m_ctr = t->m_interval - (rest % t->m_interval); // rearm
+                prev = t; // advance to this time event
+            }
+            // one-shot time event: automatically disarm
+            else {
+                t->m_ctr = 0U;
+                prev->m_next = t->m_next;
+
+                // mark time event 't' as NOT linked
+                t->refCtr_ &= static_cast<std::uint8_t>(~TE_IS_LINKED);
+                // do NOT advance the prev pointer
+
+                QS_BEGIN_NOCRIT_PRE_(QS_QF_TIMEEVT_AUTO_DISARM,
+                                 QS::priv_.locFilter[QS::TE_OBJ], t)
+                    QS_OBJ_PRE_(t);       // this time event object
+                    QS_OBJ_PRE_(act);     // the target AO
+                    QS_U8_PRE_(tickRate); // tick rate
+                QS_END_NOCRIT_PRE_()
+            }
+
+            QS_BEGIN_NOCRIT_PRE_(QS_QF_TIMEEVT_POST,
+                             QS::priv_.locFilter[QS::TE_OBJ], t)
+                QS_TIME_PRE_();       // timestamp
+                QS_OBJ_PRE_(t);       // the time event object
+                QS_SIG_PRE_(t->sig);  // signal of this time event
+                QS_OBJ_PRE_(act);     // the target AO
+                QS_U8_PRE_(tickRate); // tick rate
+            QS_END_NOCRIT_PRE_()
+
+            QF_CRIT_EXIT_(); // exit crit. section before posting
+
+            for (; nPosts > 0U; --nPosts) {
+                // asserts if queue overflows
+                static_cast<void>(act->POST(t, sender));
+            }
+        }
+        QF_CRIT_ENTRY_(); // re-enter crit. section to continue
+    }
+    QF_CRIT_EXIT_();
+
+#else // timing wheel, see NOTE2
+
+    QTimeWheel &wheel = l_wheel[tickRate];
+    QF_CRIT_STAT_
+
+    QF_CRIT_ENTRY_();
+    QTimeEvtCtr const end = static_cast<QTimeEvtCtr>(wheel.now + nTicks);
+    wheel.marked = end; // mark the clock ticks (see NOTE3 below)
+
+    QS_BEGIN_NOCRIT_PRE_(QS_QF_TICK, nullptr, nullptr)
+        QS_TEC_PRE_(end);         // tick ctr
+        QS_U8_PRE_(tickRate);     // tick rate
+    QS_END_NOCRIT_PRE_()
+
+    // advance by whole runs of the ticks with all current slots empty
+    while (wheel.now != end) {
+        wheel.now = static_cast<QTimeEvtCtr>(wheel.now
+            + wheelSkip(wheel, static_cast<QTimeEvtCtr>(end - wheel.now)));
+        QTimeEvtCtr const now = wheel.now;
+        QF_CRIT_EXIT_();
+
+#ifdef Q_SPY
+        wheelTick_(tickRate, now, sender);
+#else
+        wheelTick_(tickRate, now);
+#endif
+        QF_CRIT_ENTRY_();
+    }
+    QF_CRIT_EXIT_();
+
+#endif // QF_TIMEEVT_WHEEL
+}
+
+//****************************************************************************
+/// @description
+/// Marks the next @p nTicks clock ticks at the given tick rate as already
+/// counted, so that the time events armed from now on are not counted down
+/// by them in the following call to QP::QF::tickN_().
+///
+/// @param[in] tickRate  clock tick rate [1..15].
+/// @param[in] nTicks    number of clock ticks for the next QP::QF::tickN_().
+///
+/// @note
+/// Must be called inside the critical section, in which the caller takes
+/// the number of clock ticks to process, and must be followed by the call
+/// QP::QF::tickN_() for the same @p nTicks (see NOTE3 below).
+///
+void QF::tickMark_(std::uint_fast8_t const tickRate,
+                   QTimeEvtCtr const nTicks) noexcept
+{
+#ifndef QF_TIMEEVT_WHEEL
+    static_cast<void>(nTicks); // unused parameter
+
+    // the time events armed from now on get the new phase
+    timeEvtHead_[tickRate].refCtr_ = static_cast<std::uint8_t>(
+        (timeEvtHead_[tickRate].refCtr_ ^ TE_TICK_PHASE) | TE_TICK_MARKED);
+#else
+    // the time events armed from now on count from the marked ticks
+    l_wheel[tickRate].marked =
+        static_cast<QTimeEvtCtr>(l_wheel[tickRate].now + nTicks);
+#endif // QF_TIMEEVT_WHEEL
+}
+#endif // (defined QF_ATOMIC_TICKER) || (defined QF_TICKLESS)
+
 //****************************************************************************
 // NOTE1:
 // In some QF ports the critical section exit takes effect only on the next
@@ -189,7 +610,50 @@ void QF::tickX_(std::uint_fast8_t const tickRate) noexcept
 // The QF_CRIT_EXIT_NOP() macro contains minimal code required
 // to prevent such merging of critical sections in QF ports,
 // in which it can occur.
-
+//
+// NOTE2:
+// When the macro QF_TIMEEVT_WHEEL is defined, the armed time events of
+// every tick rate are kept in a hierarchical timing wheel instead of the
+// single linked list, which QF::tickX_() needs to traverse in every tick.
+// The level 'k' of the wheel holds time events expiring in less than
+// 2^((k+1)*QF_TIMEEVT_WHEEL_BITS) ticks, in the slot selected by the bits
+// [k*QF_TIMEEVT_WHEEL_BITS..] of the expiration tick (QTimeEvt::m_due).
+// In every tick, QF::tickX_() processes only the current slot of level 0
+// and, whenever a higher level wraps around, also the current slot of that
+// level, whose time events cascade down to the lower levels. The cost of
+// a tick is thus proportional to the number of expiring (and cascading)
+// time events rather than to the number of all armed time events.
+//
+// The slot lists are doubly linked (QTimeEvt::m_pprev), so arming,
+// disarming and rearming link/unlink the time event directly in constant
+// time inside the critical section. To keep the critical sections short,
+// QF::tickX_() first detaches the current slot into a separate "expiring"
+// list and then processes the time events one at a time, each in its own
+// critical section. A time event disarmed or rearmed in the meantime is
+// simply unlinked from the "expiring" list.
+//
+// NOTE3:
+// QF::tickN_() processes the clock ticks, which were counted (e.g., by the
+// "tickless" POSIX ports or by the QP::QTicker) before the call, so it must
+// not count down the time events armed after the ticks were counted. The
+// "tickless" ports compensate such time events for the ticks not processed
+// yet in QF_TIMEEVT_ARM_(), so counting them down once more would expire
+// them early. Therefore the ports call QF::tickMark_() in the critical
+// section, in which they take the number of ticks to process, and a call
+// to QF::tickN_() without the mark marks the ticks itself on entry.
+//
+// In the linked-list configuration the mark flips the TE_TICK_PHASE bit
+// in timeEvtHead_[tickRate].refCtr_ and every armed (or rearmed) time event
+// copies the current phase into its own refCtr_. QF::tickN_() counts down
+// only the time events of the previous phase and moves every visited time
+// event to the current phase. Between two visits of QF::tickN_() the phase
+// flips at most once, so a single bit is enough.
+//
+// In the timing wheel configuration the mark advances the "marked" tick
+// counter of the wheel and the time events armed afterwards expire relative
+// to that counter. QF::tickN_() then advances the wheel to the marked tick
+// by skipping the runs of ticks, at which all current slots of the wheel
+// are empty (wheelSkip()), so its cost does not depend on nTicks.
 
 //****************************************************************************
 /// @description
@@ -205,6 +669,9 @@ void QF::tickX_(std::uint_fast8_t const tickRate) noexcept
 /// This function should be called in critical section.
 ///
 bool QF::noTimeEvtsActiveX(std::uint_fast8_t const tickRate) noexcept {
+#ifdef QF_TIMEEVT_WHEEL
+    return l_wheel[tickRate].nLinked == 0U;
+#else
     bool inactive;
     if (timeEvtHead_[tickRate].m_next != nullptr) {
         inactive = false;
@@ -216,6 +683,62 @@ bool QF::noTimeEvtsActiveX(std::uint_fast8_t const tickRate) noexcept {
         inactive = true;
     }
     return inactive;
+#endif // QF_TIMEEVT_WHEEL
+}
+
+//****************************************************************************
+/// @description
+/// Find out in how many clock ticks (calls to QP::QF::tickX_()) at the given
+/// tick rate the nearest time event expires. This is useful for "tickless"
+/// QF ports, which suppress the clock ticks that do not expire any time
+/// events.
+///
+/// @param[in]  tickRate  system clock tick rate to find out about.
+///
+/// @returns
+/// the number of clock ticks until the nearest expiration of any armed time
+/// event at the given tick rate or 0 if no time events are armed.
+///
+/// @note
+/// This function should be called in critical section.
+///
+QTimeEvtCtr QF::nextTimeoutX(std::uint_fast8_t const tickRate) noexcept {
+    QTimeEvtCtr nTicks = 0U;
+
+#ifndef QF_TIMEEVT_WHEEL
+    // the main list and the list of "freshly armed" time events...
+    QTimeEvt const *t = timeEvtHead_[tickRate].m_next;
+    for (std::uint_fast8_t list = 0U; list < 2U; ++list) {
+        for (; t != nullptr; t = t->m_next) {
+            QTimeEvtCtr const ctr = t->m_ctr;
+            if ((ctr != 0U) && ((nTicks == 0U) || (ctr < nTicks))) {
+                nTicks = ctr;
+            }
+        }
+        t = static_cast<QTimeEvt const *>(timeEvtHead_[tickRate].m_act);
+    }
+#else
+    QTimeWheel const &wheel = l_wheel[tickRate];
+    if (wheel.nLinked != 0U) {
+        // scan the level 0 slots up to the end of the current rotation.
+        // The end of the rotation is the latest tick to wake up at anyway,
+        // because the higher levels cascade down at that tick.
+        std::uint_fast16_t const rest = QF_WHEEL_SLOTS
+            - (static_cast<std::uint_fast16_t>(wheel.now)
+               & (QF_WHEEL_SLOTS - 1U));
+        nTicks = static_cast<QTimeEvtCtr>(rest);
+        for (std::uint_fast16_t n = 1U; n < rest; ++n) {
+            if (wheel.slot[0][(static_cast<std::uint_fast16_t>(wheel.now) + n)
+                              & (QF_WHEEL_SLOTS - 1U)] != nullptr)
+            {
+                nTicks = static_cast<QTimeEvtCtr>(n);
+                break;
+            }
+        }
+    }
+#endif // QF_TIMEEVT_WHEEL
+
+    return nTicks;
 }
 
 //****************************************************************************
@@ -241,6 +764,10 @@ QTimeEvt::QTimeEvt(QActive * const act,
     m_act(act),
     m_ctr(0U),
     m_interval(0U)
+#ifdef QF_TIMEEVT_WHEEL
+    , m_pprev(nullptr),
+    m_due(0U)
+#endif
 {
     /// @pre The signal must be valid and the tick rate in range
     Q_REQUIRE_ID(300, (sgnl >= Q_USER_SIG)
@@ -277,6 +804,10 @@ QTimeEvt::QTimeEvt() noexcept
     m_act(nullptr),
     m_ctr(0U),
     m_interval(0U)
+#ifdef QF_TIMEEVT_WHEEL
+    , m_pprev(nullptr),
+    m_due(0U)
+#endif
 {
 #ifndef Q_EVT_CTOR
     sig = 0U;
@@ -342,9 +873,22 @@ void QTimeEvt::armX(QTimeEvtCtr const nTicks,
 #endif
 
     QF_CRIT_ENTRY_();
-    m_ctr = nTicks;
+    m_ctr = QF_TIMEEVT_ARM_(tickRate, nTicks);
     m_interval = interval;
 
+#ifdef QF_TIMEEVT_WHEEL
+    // disarmed time event is never linked, see NOTE2; count from the clock
+    // ticks already marked for QF::tickN_(), see NOTE3
+    wheelLink_(static_cast<QTimeEvtCtr>(m_ctr
+        + (l_wheel[tickRate].marked - l_wheel[tickRate].now)));
+#else
+#if (defined QF_ATOMIC_TICKER) || (defined QF_TICKLESS)
+    // not counted down by the clock ticks already marked, see NOTE3
+    refCtr_ = static_cast<std::uint8_t>(
+        (refCtr_ & static_cast<std::uint8_t>(~TE_TICK_PHASE))
+        | (QF::timeEvtHead_[tickRate].refCtr_ & TE_TICK_PHASE));
+#endif
+
     // is the time event unlinked?
     // NOTE: For the duration of a single clock tick of the specified tick
     // rate a time event can be disarmed and yet still linked into the list,
@@ -366,6 +910,7 @@ void QTimeEvt::armX(QTimeEvtCtr const nTicks,
         m_next = QF::timeEvtHead_[tickRate].toTimeEvt();
         QF::timeEvtHead_[tickRate].m_act = this;
     }
+#endif // QF_TIMEEVT_WHEEL
 
     QS_BEGIN_NOCRIT_PRE_(QS_QF_TIMEEVT_ARM,
                          QS::priv_.locFilter[QS::TE_OBJ], this)
@@ -416,6 +961,9 @@ bool QTimeEvt::disarm(void) noexcept {
             QS_U8_PRE_(refCtr_& TE_TICK_RATE);
         QS_END_NOCRIT_PRE_()
 
+#ifdef QF_TIMEEVT_WHEEL
+        wheelUnlink_(); // remove from the timing wheel right away
+#endif
         m_ctr = 0U; // schedule removal from the list
     }
     else { // the time event was already disarmed automatically
@@ -470,6 +1018,13 @@ bool QTimeEvt::rearm(QTimeEvtCtr const nTicks) noexcept {
     QF_CRIT_ENTRY_();
     bool wasArmed;
 
+#ifdef QF_TIMEEVT_WHEEL
+    // is the time evt running?
+    wasArmed = (m_ctr != 0U);
+    if (wasArmed) {
+        wheelUnlink_(); // unlink from the current slot of the timing wheel
+    }
+#else
     // is the time evt not running?
     if (m_ctr == 0U) {
         wasArmed = false;
@@ -498,7 +1053,19 @@ bool QTimeEvt::rearm(QTimeEvtCtr const nTicks) noexcept {
     else { // the time event is being disarmed
         wasArmed = true;
     }
-    m_ctr = nTicks; // re-load the tick counter (shift the phasing)
+#endif // QF_TIMEEVT_WHEEL
+    // re-load the tick counter (shift the phasing)
+    m_ctr = QF_TIMEEVT_ARM_(tickRate, nTicks);
+#ifdef QF_TIMEEVT_WHEEL
+    // link into the slot for the new expiration, see NOTE3
+    wheelLink_(static_cast<QTimeEvtCtr>(m_ctr
+        + (l_wheel[tickRate].marked - l_wheel[tickRate].now)));
+#elif (defined QF_ATOMIC_TICKER) || (defined QF_TICKLESS)
+    // not counted down by the clock ticks already marked, see NOTE3
+    refCtr_ = static_cast<std::uint8_t>(
+        (refCtr_ & static_cast<std::uint8_t>(~TE_TICK_PHASE))
+        | (QF::timeEvtHead_[tickRate].refCtr_ & TE_TICK_PHASE));
+#endif
 
     QS_BEGIN_NOCRIT_PRE_(QS_QF_TIMEEVT_REARM,
                      QS::priv_.locFilter[QS::TE_OBJ], this)
@@ -557,11 +1124,80 @@ QTimeEvtCtr QTimeEvt::currCtr(void) const noexcept {
     QF_CRIT_STAT_
 
     QF_CRIT_ENTRY_();
+#ifndef QF_TIMEEVT_WHEEL
     QTimeEvtCtr const ret = m_ctr;
+#else
+    QTimeEvtCtr const ret = (m_ctr != 0U)
+        ? static_cast<QTimeEvtCtr>(
+              m_due - l_wheel[refCtr_ & TE_TICK_RATE].now)
+        : 0U;
+#endif
     QF_CRIT_EXIT_();
 
     return ret;
 }
 
+#ifdef QF_TIMEEVT_WHEEL
+//****************************************************************************
+/// @description
+/// Links the time event into the slot of the timing wheel corresponding to
+/// the expiration in @p nTicks clock ticks (at the associated tick rate).
+///
+/// @note
+/// Must be called from within a critical section and only for a time event
+/// that is not linked into the wheel.
+///
+void QTimeEvt::wheelLink_(QTimeEvtCtr const nTicks) noexcept {
+    QTimeWheel &wheel = l_wheel[refCtr_ & TE_TICK_RATE];
+
+    m_due = static_cast<QTimeEvtCtr>(wheel.now + nTicks);
+
+    // find the lowest level covering the number of ticks
+    std::uint_fast8_t level = 0U;
+    while ((level < (QF_WHEEL_LEVELS - 1U))
+           && ((static_cast<std::uint32_t>(nTicks)
+                >> ((level + 1U) * QF_TIMEEVT_WHEEL_BITS)) != 0U))
+    {
+        ++level;
+    }
+
+    // insert at the head of the slot list
+    QTimeEvt * volatile * const slot = &wheel.slot[level][
+        (static_cast<std::uint32_t>(m_due) >> (level * QF_TIMEEVT_WHEEL_BITS))
+        & (QF_WHEEL_SLOTS - 1U)];
+    m_next = *slot;
+    if (m_next != nullptr) {
+        m_next->m_pprev = &m_next;
+    }
+    m_pprev = slot;
+    *slot = this;
+
+    refCtr_ |= TE_IS_LINKED; // mark as linked
+    ++wheel.nLinked;
+}
+
+//****************************************************************************
+/// @description
+/// Unlinks the time event from the timing wheel (or from the list of time
+/// events currently processed in QP::QF::tickX_()).
+///
+/// @note
+/// Must be called from within a critical section and only for a time event
+/// that is linked into the wheel.
+///
+void QTimeEvt::wheelUnlink_(void) noexcept {
+    QTimeEvt * const next = m_next;
+    *m_pprev = next;
+    if (next != nullptr) {
+        next->m_pprev = m_pprev;
+    }
+    m_next  = nullptr;
+    m_pprev = nullptr;
+
+    refCtr_ &= static_cast<std::uint8_t>(~TE_IS_LINKED); // mark as unlinked
+    --l_wheel[refCtr_ & TE_TICK_RATE].nLinked;
+}
+#endif // QF_TIMEEVT_WHEEL
+
 } // namespace QP
 
@@ -107,6 +107,45 @@
 
 #endif // Q_NASSERT
 
+#ifndef QF_TIMEEVT_ARM_
+    //! This is an internal port hook for adjusting the number of clock
+    //! ticks of a time event being armed or rearmed.
+    /// @description
+    /// The macro is invoked inside the critical section of
+    /// QP::QTimeEvt::armX() and QP::QTimeEvt::rearm() and returns the
+    /// number of clock ticks to actually load into the time event. "Tickless"
+    /// QF ports, which might be behind with processing of the clock ticks
+    /// at the time of arming, use the hook to compensate for the lag and to
+    /// wake up the clock tick processing when the new timeout is sooner.
+    /// By default the number of ticks is not changed.
+    #define QF_TIMEEVT_ARM_(tickRate_, nTicks_) (nTicks_)
+#endif
+
+#ifdef QF_ATOMIC_TICKER
+#ifndef QF_TICKER_CTR_INC_
+    //! This is an internal port hook for atomically counting one more tick
+    //! posted to QP::QTicker.
+    /// @description
+    /// The macro increments the tick counter @p ctr_ (QP::QTimeEvtCtr) and
+    /// returns its value before the increment. By default the macro uses
+    /// the GCC atomic built-ins, which a port can replace with the atomic
+    /// operations of its compiler or CPU.
+    #define QF_TICKER_CTR_INC_(ctr_) \
+        __atomic_fetch_add(&(ctr_), 1U, __ATOMIC_ACQ_REL)
+#endif
+
+#ifndef QF_TICKER_CTR_TAKE_
+    //! This is an internal port hook for atomically taking all the ticks
+    //! counted by QP::QTicker.
+    /// @description
+    /// The macro returns the tick counter @p ctr_ (QP::QTimeEvtCtr) and
+    /// clears it in one atomic operation.
+    /// @sa #QF_TICKER_CTR_INC_
+    #define QF_TICKER_CTR_TAKE_(ctr_) \
+        __atomic_exchange_n(&(ctr_), 0U, __ATOMIC_ACQ_REL)
+#endif
+#endif // QF_ATOMIC_TICKER
+
 
 namespace QP {
 
@@ -131,6 +170,8 @@ struct QFreeBlock {
 //
 constexpr std::uint8_t TE_IS_LINKED    = 1U << 7U;  // flag
 constexpr std::uint8_t TE_WAS_DISARMED = 1U << 6U;  // flag
+constexpr std::uint8_t TE_TICK_PHASE   = 1U << 5U;  // flag, see qf_time.cpp
+constexpr std::uint8_t TE_TICK_MARKED  = 1U << 4U;  // flag (list head only)
 constexpr std::uint8_t TE_TICK_RATE    = 0x0FU;     // bitmask
 
 //****************************************************************************
@@ -146,6 +187,8 @@ inline std::uint8_t QF_EVT_REF_CTR_ (QEvt const * const e) noexcept {
     return e->refCtr_;
 }
 
+#ifndef QF_ATOMIC_EVT_REF_CTR
+
 //! increment the refCtr_ of an event @p e
 inline void QF_EVT_REF_CTR_INC_(QEvt const * const e) noexcept {
     ++(QF_EVT_CONST_CAST_(e))->refCtr_;
@@ -156,6 +199,57 @@ inline void QF_EVT_REF_CTR_DEC_(QEvt const * const e) noexcept {
     --(QF_EVT_CONST_CAST_(e))->refCtr_;
 }
 
+//! add @p n references to an event @p e
+inline void QF_EVT_REF_CTR_ADD_(QEvt const * const e,
+                                std::uint_fast8_t const n) noexcept
+{
+    (QF_EVT_CONST_CAST_(e))->refCtr_ += static_cast<std::uint8_t>(n);
+}
+
+#else // atomic reference counting of dynamic events
+
+//! atomically increment the refCtr_ of an event @p e
+/// @description
+/// A new reference can be only created by a holder of an existing
+/// reference, so the increment does not need to order any other memory
+/// accesses.
+inline void QF_EVT_REF_CTR_INC_(QEvt const * const e) noexcept {
+    static_cast<void>(__atomic_fetch_add(
+        &(QF_EVT_CONST_CAST_(e))->refCtr_, 1U, __ATOMIC_RELAXED));
+}
+
+//! atomically decrement the refCtr_ of an event @p e
+inline void QF_EVT_REF_CTR_DEC_(QEvt const * const e) noexcept {
+    static_cast<void>(__atomic_fetch_sub(
+        &(QF_EVT_CONST_CAST_(e))->refCtr_, 1U, __ATOMIC_ACQ_REL));
+}
+
+//! atomically add @p n references to an event @p e
+inline void QF_EVT_REF_CTR_ADD_(QEvt const * const e,
+                                std::uint_fast8_t const n) noexcept
+{
+    static_cast<void>(__atomic_fetch_add(
+        &(QF_EVT_CONST_CAST_(e))->refCtr_, static_cast<std::uint8_t>(n),
+        __ATOMIC_RELAXED));
+}
+
+//! atomically drop one reference to an event @p e
+/// @returns the value of the refCtr_ *before* dropping the reference,
+/// so that only the holder of the last reference obtains a value <= 1.
+/// @note
+/// The refCtr_ of zero means that the caller holds the only (uncounted)
+/// reference, so nobody else can modify the counter concurrently.
+inline std::uint8_t QF_EVT_REF_CTR_DROP_(QEvt const * const e) noexcept {
+    std::uint8_t refCtr = __atomic_load_n(&e->refCtr_, __ATOMIC_ACQUIRE);
+    if (refCtr > 1U) {
+        refCtr = __atomic_fetch_sub(
+            &(QF_EVT_CONST_CAST_(e))->refCtr_, 1U, __ATOMIC_ACQ_REL);
+    }
+    return refCtr;
+}
+
+#endif // QF_ATOMIC_EVT_REF_CTR
+
 } // namespace QP
 
 //! macro to test that a pointer @p x_ is in range between @p min_ and @p max_
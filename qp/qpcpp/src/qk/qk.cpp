@@ -399,9 +399,19 @@ void QK_activate_(void) noexcept {
         // 2. dispatch the event to the AO's state machine.
         // 3. determine if event is garbage and collect it if so
         //
+#ifdef QF_EVT_BURST
+        // dispatch up to the burst limit of the AO (see NOTE01)
+        QP::QEvt const *evts[QF_EVT_BURST];
+        std::uint_fast8_t const n = a->getBurst_(evts);
+        for (std::uint_fast8_t i = 0U; i < n; ++i) {
+            a->dispatch(evts[i]);
+            QP::QF::gc(evts[i]);
+        }
+#else
         QP::QEvt const * const e = a->get_();
         a->dispatch(e);
         QP::QF::gc(e);
+#endif // QF_EVT_BURST
 
         // determine the next highest-priority AO ready to run...
         QF_INT_DISABLE();
@@ -456,3 +466,17 @@ void QK_activate_(void) noexcept {
 
 } // extern "C"
 
+//****************************************************************************
+// NOTE01:
+// With QF_EVT_BURST, QK_activate_() removes up to QActive::setBurst() events
+// from the queue of the AO in one critical section (QActive::getBurst_())
+// and dispatches them one after another. Because QK is preemptive, the AOs
+// of higher priority still preempt the burst as soon as they become ready,
+// so the burst saves the critical sections without adding latency to the
+// higher-priority work. The events posted to the AO during the burst are
+// processed in the next burst, which is also true for the events posted
+// with postLIFO() or recall(). For that reason the bursts are opt-in
+// (QActive::setBurst(), the default limit is 1) and are not allowed for the
+// AOs that recall deferred events or receive LIFO posts.
+//
+
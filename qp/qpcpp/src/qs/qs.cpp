@@ -48,6 +48,22 @@ Q_DEFINE_THIS_MODULE("qs")
 //****************************************************************************
 QS QS::priv_; // QS private data
 
+#ifdef QS_THREAD_BUF
+QSThrBuf *QS::thrList_;                 // list of the thread buffers
+thread_local QSThrBuf *QS::thr_;        // buffer of the calling thread
+thread_local QS *QS::tx_ = &QS::priv_;  // where the records are written
+
+static void thrBeginRec(std::uint_fast8_t const rec) noexcept;
+static void thrEndRec(void) noexcept;
+static bool thrMergeRec(QSThrBuf * const tb) noexcept;
+
+// is the time stamp @p a earlier than @p b (wrap-around aware)?
+static inline bool thrBefore(QSTimeCtr const a, QSTimeCtr const b) noexcept {
+    return static_cast<QSTimeCtr>(a - b)
+           > static_cast<QSTimeCtr>(static_cast<QSTimeCtr>(~0U) >> 1U);
+}
+#endif // QS_THREAD_BUF
+
 //****************************************************************************
 /// @description
 /// This function should be called from QP::QS::onStartup() to provide QS with
@@ -134,7 +150,7 @@ void QS::filterOn_(std::uint_fast8_t const rec) noexcept {
     }
     else if (rec == static_cast<std::uint_fast8_t>(QS_AO_RECORDS)) {
         priv_.glbFilter[1] |= 0xFCU;
-        priv_.glbFilter[2] |= 0x07U;
+        priv_.glbFilter[2] |= 0x87U;
         priv_.glbFilter[5] |= 0x20U;
     }
     else if (rec == static_cast<std::uint_fast8_t>(QS_EQ_RECORDS)) {
@@ -149,6 +165,7 @@ void QS::filterOn_(std::uint_fast8_t const rec) noexcept {
         priv_.glbFilter[3] |= 0xFCU;
         priv_.glbFilter[4] |= 0xC0U;
         priv_.glbFilter[5] |= 0x1FU;
+        priv_.glbFilter[8] |= 0x40U;
     }
     else if (rec == static_cast<std::uint_fast8_t>(QS_TE_RECORDS)) {
         priv_.glbFilter[4] |= 0x7FU;
@@ -219,7 +236,7 @@ void QS::filterOff_(std::uint_fast8_t const rec) noexcept {
     }
     else if (rec == static_cast<std::uint_fast8_t>(QS_AO_RECORDS)) {
         priv_.glbFilter[1] &= static_cast<std::uint8_t>(~0xFCU);
-        priv_.glbFilter[2] &= static_cast<std::uint8_t>(~0x07U);
+        priv_.glbFilter[2] &= static_cast<std::uint8_t>(~0x87U);
         priv_.glbFilter[5] &= static_cast<std::uint8_t>(~0x20U);
     }
     else if (rec == static_cast<std::uint_fast8_t>(QS_EQ_RECORDS)) {
@@ -234,6 +251,7 @@ void QS::filterOff_(std::uint_fast8_t const rec) noexcept {
         priv_.glbFilter[3] &= static_cast<std::uint8_t>(~0xFCU);
         priv_.glbFilter[4] &= static_cast<std::uint8_t>(~0xC0U);
         priv_.glbFilter[5] &= static_cast<std::uint8_t>(~0x1FU);
+        priv_.glbFilter[8] &= static_cast<std::uint8_t>(~0x40U);
     }
     else if (rec == static_cast<std::uint_fast8_t>(QS_TE_RECORDS)) {
         priv_.glbFilter[4] &= static_cast<std::uint8_t>(~0x7FU);
@@ -281,6 +299,13 @@ void QS::filterOff_(std::uint_fast8_t const rec) noexcept {
 /// a critical section.
 ///
 void QS::beginRec_(std::uint_fast8_t const rec) noexcept {
+#ifdef QS_THREAD_BUF
+    if (thr_ != nullptr) { // the calling thread has its own buffer?
+        thrBeginRec(rec);
+        return;
+    }
+#endif // QS_THREAD_BUF
+
     std::uint8_t const b = priv_.seq + 1U;
     std::uint8_t chksum_ = 0U; // reset the checksum
     std::uint8_t * const buf_   = priv_.buf; // put in a temporary (register)
@@ -307,6 +332,13 @@ void QS::beginRec_(std::uint_fast8_t const rec) noexcept {
 /// a critical section.
 ///
 void QS::endRec_(void) noexcept {
+#ifdef QS_THREAD_BUF
+    if (thr_ != nullptr) { // the calling thread has its own buffer?
+        thrEndRec();
+        return;
+    }
+#endif // QS_THREAD_BUF
+
     std::uint8_t * const buf_ = priv_.buf; // put in a temporary (register)
     QSCtr head_ = priv_.head;
     QSCtr const end_ = priv_.end;
@@ -441,18 +473,18 @@ void QS_target_info_(std::uint8_t const isReset) noexcept {
 /// client code directly.
 ///
 void QS::u8_fmt_(std::uint8_t const format, std::uint8_t const d) noexcept {
-    std::uint8_t chksum_ = priv_.chksum;  // put in a temporary (register)
-    std::uint8_t *const buf_ = priv_.buf; // put in a temporary (register)
-    QSCtr   head_   = priv_.head;    // put in a temporary (register)
-    QSCtr const end_= priv_.end;     // put in a temporary (register)
+    std::uint8_t chksum_ = QS_BUF_.chksum;  // put in a temporary (register)
+    std::uint8_t *const buf_ = QS_BUF_.buf; // put in a temporary (register)
+    QSCtr   head_   = QS_BUF_.head;  // put in a temporary (register)
+    QSCtr const end_= QS_BUF_.end;   // put in a temporary (register)
 
-    priv_.used += 2U; // 2 bytes about to be added
+    QS_BUF_.used += 2U; // 2 bytes about to be added
 
     QS_INSERT_ESC_BYTE_(format)
     QS_INSERT_ESC_BYTE_(d)
 
-    priv_.head   = head_;   // save the head
-    priv_.chksum = chksum_; // save the checksum
+    QS_BUF_.head   = head_; // save the head
+    QS_BUF_.chksum = chksum_; // save the checksum
 }
 
 //****************************************************************************
@@ -461,12 +493,12 @@ void QS::u8_fmt_(std::uint8_t const format, std::uint8_t const d) noexcept {
 /// client code directly.
 ///
 void QS::u16_fmt_(std::uint8_t format, std::uint16_t d) noexcept {
-    std::uint8_t chksum_ = priv_.chksum; // put in a temporary (register)
-    std::uint8_t * const buf_ = priv_.buf; // put in a temporary (register)
-    QSCtr   head_   = priv_.head;   // put in a temporary (register)
-    QSCtr const end_= priv_.end;    // put in a temporary (register)
+    std::uint8_t chksum_ = QS_BUF_.chksum; // put in a temporary (register)
+    std::uint8_t * const buf_ = QS_BUF_.buf; // put in a temporary (register)
+    QSCtr   head_   = QS_BUF_.head; // put in a temporary (register)
+    QSCtr const end_= QS_BUF_.end;  // put in a temporary (register)
 
-    priv_.used += 3U; // 3 bytes about to be added
+    QS_BUF_.used += 3U; // 3 bytes about to be added
 
     QS_INSERT_ESC_BYTE_(format)
 
@@ -477,8 +509,8 @@ void QS::u16_fmt_(std::uint8_t format, std::uint16_t d) noexcept {
     format = static_cast<std::uint8_t>(d);
     QS_INSERT_ESC_BYTE_(format)
 
-    priv_.head   = head_;    // save the head
-    priv_.chksum = chksum_;  // save the checksum
+    QS_BUF_.head   = head_;  // save the head
+    QS_BUF_.chksum = chksum_;  // save the checksum
 }
 
 //****************************************************************************
@@ -486,12 +518,12 @@ void QS::u16_fmt_(std::uint8_t format, std::uint16_t d) noexcept {
 /// client code directly.
 ///
 void QS::u32_fmt_(std::uint8_t format, std::uint32_t d) noexcept {
-    std::uint8_t chksum_ = priv_.chksum;  // put in a temporary (register)
-    std::uint8_t * const buf_= priv_.buf; // put in a temporary (register)
-    QSCtr   head_   = priv_.head;    // put in a temporary (register)
-    QSCtr const end_= priv_.end;     // put in a temporary (register)
+    std::uint8_t chksum_ = QS_BUF_.chksum;  // put in a temporary (register)
+    std::uint8_t * const buf_= QS_BUF_.buf; // put in a temporary (register)
+    QSCtr   head_   = QS_BUF_.head;  // put in a temporary (register)
+    QSCtr const end_= QS_BUF_.end;   // put in a temporary (register)
 
-    priv_.used += static_cast<QSCtr>(5); // 5 bytes about to be added
+    QS_BUF_.used += static_cast<QSCtr>(5); // 5 bytes about to be added
     QS_INSERT_ESC_BYTE_(format) // insert the format byte
 
     for (std::uint_fast8_t i = 4U; i != 0U; --i) {
@@ -500,8 +532,8 @@ void QS::u32_fmt_(std::uint8_t format, std::uint32_t d) noexcept {
         d >>= 8U;
     }
 
-    priv_.head   = head_;   // save the head
-    priv_.chksum = chksum_; // save the checksum
+    QS_BUF_.head   = head_; // save the head
+    QS_BUF_.chksum = chksum_; // save the checksum
 }
 
 //****************************************************************************
@@ -526,13 +558,13 @@ void QS::usr_dict_pre_(enum_t const rec,
 ///
 void QS::mem_fmt_(std::uint8_t const *blk, std::uint8_t size) noexcept {
     std::uint8_t b = static_cast<std::uint8_t>(MEM_T);
-    std::uint8_t chksum_ = priv_.chksum + b;
-    std::uint8_t * const buf_= priv_.buf; // put in a temporary (register)
-    QSCtr head_     = priv_.head;         // put in a temporary (register)
-    QSCtr const end_= priv_.end;          // put in a temporary (register)
+    std::uint8_t chksum_ = QS_BUF_.chksum + b;
+    std::uint8_t * const buf_= QS_BUF_.buf; // put in a temporary (register)
+    QSCtr head_     = QS_BUF_.head;       // put in a temporary (register)
+    QSCtr const end_= QS_BUF_.end;        // put in a temporary (register)
 
     // size+2 bytes to be added
-    priv_.used += static_cast<std::uint8_t>(size + 2U);
+    QS_BUF_.used += static_cast<std::uint8_t>(size + 2U);
 
     QS_INSERT_BYTE_(b)
     QS_INSERT_ESC_BYTE_(size)
@@ -544,8 +576,8 @@ void QS::mem_fmt_(std::uint8_t const *blk, std::uint8_t size) noexcept {
         ++blk;
     }
 
-    priv_.head   = head_;    // save the head
-    priv_.chksum = chksum_;  // save the checksum
+    QS_BUF_.head   = head_;  // save the head
+    QS_BUF_.chksum = chksum_;  // save the checksum
 }
 
 //****************************************************************************
@@ -555,11 +587,11 @@ void QS::mem_fmt_(std::uint8_t const *blk, std::uint8_t size) noexcept {
 void QS::str_fmt_(char_t const *s) noexcept {
     std::uint8_t b       = static_cast<std::uint8_t>(*s);
     std::uint8_t chksum_ = static_cast<std::uint8_t>(
-                           priv_.chksum + static_cast<std::uint8_t>(STR_T));
-    std::uint8_t * const buf_= priv_.buf; // put in a temporary (register)
-    QSCtr   head_   = priv_.head;    // put in a temporary (register)
-    QSCtr const end_= priv_.end;     // put in a temporary (register)
-    QSCtr   used_   = priv_.used;    // put in a temporary (register)
+                           QS_BUF_.chksum + static_cast<std::uint8_t>(STR_T));
+    std::uint8_t * const buf_= QS_BUF_.buf; // put in a temporary (register)
+    QSCtr   head_   = QS_BUF_.head;  // put in a temporary (register)
+    QSCtr const end_= QS_BUF_.end;   // put in a temporary (register)
+    QSCtr   used_   = QS_BUF_.used;  // put in a temporary (register)
 
     used_ += 2U; // the format byte and the terminating-0
 
@@ -574,9 +606,9 @@ void QS::str_fmt_(char_t const *s) noexcept {
     }
     QS_INSERT_BYTE_(0U) // zero-terminate the string
 
-    priv_.head   = head_;   // save the head
-    priv_.chksum = chksum_; // save the checksum
-    priv_.used   = used_;   // save # of used buffer space
+    QS_BUF_.head   = head_; // save the head
+    QS_BUF_.chksum = chksum_; // save the checksum
+    QS_BUF_.used   = used_; // save # of used buffer space
 }
 
 //****************************************************************************
@@ -584,16 +616,16 @@ void QS::str_fmt_(char_t const *s) noexcept {
 /// client code directly.
 ///
 void QS::u8_raw_(std::uint8_t const d) noexcept {
-    std::uint8_t chksum_ = priv_.chksum;   // put in a temporary (register)
-    std::uint8_t * const buf_ = priv_.buf; // put in a temporary (register)
-    QSCtr   head_   = priv_.head;     // put in a temporary (register)
-    QSCtr const end_= priv_.end;      // put in a temporary (register)
+    std::uint8_t chksum_ = QS_BUF_.chksum; // put in a temporary (register)
+    std::uint8_t * const buf_ = QS_BUF_.buf; // put in a temporary (register)
+    QSCtr   head_   = QS_BUF_.head;   // put in a temporary (register)
+    QSCtr const end_= QS_BUF_.end;    // put in a temporary (register)
 
-    priv_.used += 1U;  // 1 byte about to be added
+    QS_BUF_.used += 1U;  // 1 byte about to be added
     QS_INSERT_ESC_BYTE_(d)
 
-    priv_.head   = head_;   // save the head
-    priv_.chksum = chksum_; // save the checksum
+    QS_BUF_.head   = head_; // save the head
+    QS_BUF_.chksum = chksum_; // save the checksum
 }
 
 //****************************************************************************
@@ -601,17 +633,17 @@ void QS::u8_raw_(std::uint8_t const d) noexcept {
 /// client code directly.
 ///
 void QS::u8u8_raw_(std::uint8_t const d1, std::uint8_t const d2) noexcept {
-    std::uint8_t chksum_ = priv_.chksum;   // put in a temporary (register)
-    std::uint8_t * const buf_ = priv_.buf; // put in a temporary (register)
-    QSCtr   head_   = priv_.head;     // put in a temporary (register)
-    QSCtr const end_= priv_.end;      // put in a temporary (register)
+    std::uint8_t chksum_ = QS_BUF_.chksum; // put in a temporary (register)
+    std::uint8_t * const buf_ = QS_BUF_.buf; // put in a temporary (register)
+    QSCtr   head_   = QS_BUF_.head;   // put in a temporary (register)
+    QSCtr const end_= QS_BUF_.end;    // put in a temporary (register)
 
-    priv_.used += 2U; // 2 bytes about to be added
+    QS_BUF_.used += 2U; // 2 bytes about to be added
     QS_INSERT_ESC_BYTE_(d1)
     QS_INSERT_ESC_BYTE_(d2)
 
-    priv_.head   = head_;    // save the head
-    priv_.chksum = chksum_;  // save the checksum
+    QS_BUF_.head   = head_;  // save the head
+    QS_BUF_.chksum = chksum_;  // save the checksum
 }
 
 //****************************************************************************
@@ -620,12 +652,12 @@ void QS::u8u8_raw_(std::uint8_t const d1, std::uint8_t const d2) noexcept {
 ///
 void QS::u16_raw_(std::uint16_t d) noexcept {
     std::uint8_t b = static_cast<std::uint8_t>(d);
-    std::uint8_t chksum_ = priv_.chksum;   // put in a temporary (register)
-    std::uint8_t * const buf_ = priv_.buf; // put in a temporary (register)
-    QSCtr   head_   = priv_.head;     // put in a temporary (register)
-    QSCtr const end_= priv_.end;      // put in a temporary (register)
+    std::uint8_t chksum_ = QS_BUF_.chksum; // put in a temporary (register)
+    std::uint8_t * const buf_ = QS_BUF_.buf; // put in a temporary (register)
+    QSCtr   head_   = QS_BUF_.head;   // put in a temporary (register)
+    QSCtr const end_= QS_BUF_.end;    // put in a temporary (register)
 
-    priv_.used += 2U; // 2 bytes about to be added
+    QS_BUF_.used += 2U; // 2 bytes about to be added
 
     QS_INSERT_ESC_BYTE_(b)
 
@@ -633,8 +665,8 @@ void QS::u16_raw_(std::uint16_t d) noexcept {
     b = static_cast<std::uint8_t>(d);
     QS_INSERT_ESC_BYTE_(b)
 
-    priv_.head   = head_;    // save the head
-    priv_.chksum = chksum_;  // save the checksum
+    QS_BUF_.head   = head_;  // save the head
+    QS_BUF_.chksum = chksum_;  // save the checksum
 }
 
 //****************************************************************************
@@ -642,20 +674,20 @@ void QS::u16_raw_(std::uint16_t d) noexcept {
 /// client code directly.
 ///
 void QS::u32_raw_(std::uint32_t d) noexcept {
-    std::uint8_t chksum_ = priv_.chksum;   // put in a temporary (register)
-    std::uint8_t * const buf_ = priv_.buf; // put in a temporary (register)
-    QSCtr   head_   = priv_.head;     // put in a temporary (register)
-    QSCtr const end_= priv_.end;      // put in a temporary (register)
+    std::uint8_t chksum_ = QS_BUF_.chksum; // put in a temporary (register)
+    std::uint8_t * const buf_ = QS_BUF_.buf; // put in a temporary (register)
+    QSCtr   head_   = QS_BUF_.head;   // put in a temporary (register)
+    QSCtr const end_= QS_BUF_.end;    // put in a temporary (register)
 
-    priv_.used += 4U; // 4 bytes about to be added
+    QS_BUF_.used += 4U; // 4 bytes about to be added
     for (std::uint_fast8_t i = 4U; i != 0U; --i) {
         std::uint8_t const b = static_cast<std::uint8_t>(d);
         QS_INSERT_ESC_BYTE_(b)
         d >>= 8U;
     }
 
-    priv_.head   = head_;    // save the head
-    priv_.chksum = chksum_;  // save the checksum
+    QS_BUF_.head   = head_;  // save the head
+    QS_BUF_.chksum = chksum_;  // save the checksum
 }
 
 //****************************************************************************
@@ -682,11 +714,11 @@ void QS::obj_raw_(void const * const obj) noexcept {
 ///
 void QS::str_raw_(char_t const *s) noexcept {
     std::uint8_t b = static_cast<std::uint8_t>(*s);
-    std::uint8_t chksum_ = priv_.chksum;   // put in a temporary (register)
-    std::uint8_t * const buf_ = priv_.buf; // put in a temporary (register)
-    QSCtr   head_   = priv_.head;     // put in a temporary (register)
-    QSCtr const end_= priv_.end;      // put in a temporary (register)
-    QSCtr   used_   = priv_.used;     // put in a temporary (register)
+    std::uint8_t chksum_ = QS_BUF_.chksum; // put in a temporary (register)
+    std::uint8_t * const buf_ = QS_BUF_.buf; // put in a temporary (register)
+    QSCtr   head_   = QS_BUF_.head;   // put in a temporary (register)
+    QSCtr const end_= QS_BUF_.end;    // put in a temporary (register)
+    QSCtr   used_   = QS_BUF_.used;   // put in a temporary (register)
 
     while (b != 0U) {
         chksum_ += b;      // update checksum
@@ -698,9 +730,9 @@ void QS::str_raw_(char_t const *s) noexcept {
     QS_INSERT_BYTE_(0U) // zero-terminate the string
     ++used_;
 
-    priv_.head   = head_;    // save the head
-    priv_.chksum = chksum_;  // save the checksum
-    priv_.used   = used_;    // save # of used buffer space
+    QS_BUF_.head   = head_;  // save the head
+    QS_BUF_.chksum = chksum_;  // save the checksum
+    QS_BUF_.used   = used_;  // save # of used buffer space
 }
 
 //****************************************************************************
@@ -715,6 +747,11 @@ void QS::str_raw_(char_t const *s) noexcept {
 ///
 std::uint16_t QS::getByte(void) noexcept {
     std::uint16_t ret;
+#ifdef QS_THREAD_BUF
+    if (priv_.used == 0U) {
+        mergeThrBufs_(); // merge the records from the thread buffers
+    }
+#endif // QS_THREAD_BUF
     if (priv_.used == 0U) {
         ret = QS_EOD; // set End-Of-Data
     }
@@ -759,6 +796,9 @@ std::uint16_t QS::getByte(void) noexcept {
 /// @note QP::QS::getBlock() is __not__ protected with a critical section.
 ///
 std::uint8_t const *QS::getBlock(std::uint16_t * const pNbytes) noexcept {
+#ifdef QS_THREAD_BUF
+    mergeThrBufs_(); // merge the records from the thread buffers
+#endif // QS_THREAD_BUF
     QSCtr const used_ = priv_.used; // put in a temporary (register)
     std::uint8_t *buf_;
 
@@ -791,6 +831,325 @@ std::uint8_t const *QS::getBlock(std::uint16_t * const pNbytes) noexcept {
     return buf_;
 }
 
+#ifdef QS_THREAD_BUF
+//****************************************************************************
+/// @description
+/// This function gives the calling thread its own QS buffer. From then on
+/// all QS records produced by the thread are written to the thread buffer
+/// @p tb without entering the QS critical section, and are merged into the
+/// main QS buffer by QP::QS::getBlock() and QP::QS::getByte().
+///
+/// @param[in,out] tb      pointer to the thread buffer object
+/// @param[in]     sto     pointer to the storage for the thread buffer
+/// @param[in]     stoSize size of the storage [bytes]
+///
+/// @note The same thread buffer can be given again to a thread that
+/// replaces a terminated thread (e.g., an active object started again),
+/// in which case the records not merged yet are preserved.
+///
+void QS::initThrBuf(QSThrBuf * const tb,
+                    std::uint8_t * const sto,
+                    std::uint_fast16_t const stoSize) noexcept
+{
+    // the thread buffer must hold more than the longest record
+    Q_REQUIRE_ID(700, stoSize > (QS_THREAD_REC_MAX + 8U));
+
+    QS_CRIT_STAT_
+    QS_CRIT_ENTRY_();
+    QSThrBuf *t = thrList_;
+    while ((t != nullptr) && (t != tb)) {
+        t = t->next;
+    }
+    if (t == nullptr) { // not registered yet?
+        tb->tx.buf     = sto;
+        tb->tx.end     = static_cast<QSCtr>(stoSize);
+        tb->tx.head    = 0U;
+        tb->tx.used    = 0U;
+        tb->tx.chksum  = 0U;
+        tb->sink.buf   = &tb->sinkBuf[0];
+        tb->sink.end   = static_cast<QSCtr>(sizeof(tb->sinkBuf));
+        tb->sink.head  = 0U;
+        tb->sink.used  = 0U;
+        tb->start      = 0U;
+        tb->commit     = 0U;
+        tb->tail       = 0U;
+        tb->key        = onGetTime(); // not later than the first record
+        tb->state      = 0U;
+        tb->nDropped   = 0U;
+        tb->next       = thrList_;
+        thrList_       = tb;
+    }
+    QS_CRIT_EXIT_();
+
+    thr_ = tb;
+    tx_  = &tb->tx;
+}
+
+//****************************************************************************
+/// @description
+/// This function moves the complete records from all thread buffers to
+/// the main QS buffer in the order of their time stamps, as long as the
+/// records fit into the free space of the main QS buffer. A record is
+/// merged only when no thread can still produce a record with an earlier
+/// time stamp, that is, when its time stamp is not later than the current
+/// time and the time stamps of the records being written. A thread still
+/// taking the time stamp of its next record does not stop the merge,
+/// because that time stamp cannot be earlier than the previous one, which
+/// is still in QSThrBuf::key. The complete records of the thread buffer of
+/// a record being written are merged just like the others.
+///
+/// @attention The time stamp order holds only among the threads that own
+/// a thread buffer. The records of all other threads are written directly
+/// to the main QS buffer and can precede the buffered records with earlier
+/// time stamps, which are not merged yet.
+///
+/// @note This function must be called from a critical section.
+/// It is called automatically from QP::QS::getBlock()/QP::QS::getByte().
+///
+void QS::mergeThrBufs_(void) noexcept {
+    // the latest time stamp that can be merged now
+    QSTimeCtr lim = onGetTime();
+    QSThrBuf *tb;
+    for (tb = thrList_; tb != nullptr; tb = tb->next) {
+        // record being written or its time stamp being taken?
+        if (__atomic_load_n(&tb->state, __ATOMIC_SEQ_CST) != 0U) {
+            // the time stamp of the record (or the previous time stamp,
+            // which is not later, while the new one is being taken)
+            QSTimeCtr const key = __atomic_load_n(&tb->key, __ATOMIC_RELAXED);
+            if (!thrBefore(lim, key)) {
+                lim = key;
+            }
+        }
+    }
+
+    for (;;) { // for-ever until break
+        QSThrBuf *min = nullptr;
+        QSTimeCtr minKey = 0U;
+        for (tb = thrList_; tb != nullptr; tb = tb->next) {
+            QSCtr const commit = __atomic_load_n(&tb->commit,
+                                                 __ATOMIC_ACQUIRE);
+            if (tb->tail != commit) { // any complete records?
+                // read the time stamp of the next record (wrap-around)
+                QSTimeCtr key = 0U;
+                QSCtr i = tb->tail;
+                for (std::uint_fast8_t n = 0U;
+                     n < static_cast<std::uint_fast8_t>(sizeof(QSTimeCtr));
+                     ++n)
+                {
+                    key |= static_cast<QSTimeCtr>(
+                        static_cast<QSTimeCtr>(tb->tx.buf[i]) << (8U * n));
+                    ++i;
+                    if (i == tb->tx.end) {
+                        i = 0U;
+                    }
+                }
+                if ((min == nullptr) || thrBefore(key, minKey)) {
+                    min    = tb;
+                    minKey = key;
+                }
+            }
+        }
+
+        if ((min == nullptr)            // no records?
+            || thrBefore(lim, minKey)   // record later than the limit?
+            || (!thrMergeRec(min)))     // no room in the QS buffer?
+        {
+            break;
+        }
+    }
+}
+
+//****************************************************************************
+// begin a QS record in the thread buffer of the calling thread
+static void thrBeginRec(std::uint_fast8_t const rec) noexcept {
+    QSThrBuf * const tb = QS::thr_;
+
+    // publish the time stamp of the record for QS::mergeThrBufs_()
+    __atomic_store_n(&tb->state, 1U, __ATOMIC_SEQ_CST);
+    QSTimeCtr key = QS::onGetTime();
+    __atomic_store_n(&tb->key, key, __ATOMIC_RELAXED);
+    __atomic_store_n(&tb->state, 2U, __ATOMIC_SEQ_CST);
+
+    std::uint8_t * const buf_ = tb->tx.buf; // put in a temporary (register)
+    QSCtr head_      = tb->commit;          // put in a temporary (register)
+    QSCtr const end_ = tb->tx.end;          // put in a temporary (register)
+    QSCtr const tail = __atomic_load_n(&tb->tail, __ATOMIC_ACQUIRE);
+    QSCtr const used = (head_ >= tail)
+                       ? (head_ - tail)
+                       : (end_ - tail + head_);
+
+    if ((end_ - used) <= QS_THREAD_REC_MAX) { // no room for the record?
+        __atomic_fetch_add(&tb->nDropped, 1U, __ATOMIC_RELAXED);
+        QS::tx_ = &tb->sink; // write the record to the sink
+    }
+    else {
+        tb->start = head_;
+
+        // the time stamp and the length (see thrEndRec())
+        for (std::uint_fast8_t n = static_cast<std::uint_fast8_t>(
+                 sizeof(QSTimeCtr)); n != 0U; --n)
+        {
+            QS_INSERT_BYTE_(static_cast<std::uint8_t>(key))
+            key = static_cast<QSTimeCtr>(key >> 8U);
+        }
+        QS_INSERT_BYTE_(0U)
+        QS_INSERT_BYTE_(0U)
+
+        // the sequence number is assigned in thrMergeRec()
+        QS_INSERT_BYTE_(0U)
+        QS_INSERT_BYTE_(static_cast<std::uint8_t>(rec)) // no need for escaping
+
+        tb->tx.head   = head_;
+        tb->tx.chksum = static_cast<std::uint8_t>(rec);
+    }
+}
+
+//****************************************************************************
+// end a QS record in the thread buffer of the calling thread
+static void thrEndRec(void) noexcept {
+    QSThrBuf * const tb = QS::thr_;
+
+    if (QS::tx_ == &tb->sink) { // record dropped?
+        QS::tx_ = &tb->tx;
+    }
+    else {
+        std::uint8_t * const buf_ = tb->tx.buf; // put in a temporary
+        QSCtr head_      = tb->tx.head;         // put in a temporary
+        QSCtr const end_ = tb->tx.end;          // put in a temporary
+        std::uint8_t b   = tb->tx.chksum;
+        b ^= 0xFFU; // invert the bits in the checksum
+
+        if ((b != QS_FRAME) && (b != QS_ESC)) {
+            QS_INSERT_BYTE_(b)
+        }
+        else {
+            QS_INSERT_BYTE_(QS_ESC)
+            QS_INSERT_BYTE_(b ^ QS_ESC_XOR)
+        }
+        QS_INSERT_BYTE_(QS_FRAME) // do not escape this QS_FRAME
+
+        // store the length of the frame behind the time stamp
+        QSCtr i = tb->start + static_cast<QSCtr>(sizeof(QSTimeCtr));
+        if (i >= end_) {
+            i -= end_;
+        }
+        QSCtr j = i + 2U; // start of the frame
+        if (j >= end_) {
+            j -= end_;
+        }
+        QSCtr const len = (head_ >= j) ? (head_ - j) : (end_ - j + head_);
+
+        // the record must not be longer than QS_THREAD_REC_MAX
+        Q_ASSERT_ID(710, (len + sizeof(QSTimeCtr) + 2U) <= QS_THREAD_REC_MAX);
+
+        buf_[i] = static_cast<std::uint8_t>(len);
+        ++i;
+        if (i == end_) {
+            i = 0U;
+        }
+        buf_[i] = static_cast<std::uint8_t>(len >> 8U);
+
+        tb->tx.head = head_;
+        __atomic_store_n(&tb->commit, head_, __ATOMIC_RELEASE);
+    }
+    __atomic_store_n(&tb->state, 0U, __ATOMIC_SEQ_CST);
+}
+
+//****************************************************************************
+// move the oldest record from the thread buffer to the QS buffer
+static bool thrMergeRec(QSThrBuf * const tb) noexcept {
+    std::uint8_t const * const src = tb->tx.buf;
+    QSCtr const srcEnd = tb->tx.end;
+
+    // skip the time stamp and read the length of the frame
+    QSCtr t = tb->tail + static_cast<QSCtr>(sizeof(QSTimeCtr));
+    if (t >= srcEnd) {
+        t -= srcEnd;
+    }
+    QSCtr len = static_cast<QSCtr>(src[t]);
+    ++t;
+    if (t == srcEnd) {
+        t = 0U;
+    }
+    len |= static_cast<QSCtr>(static_cast<QSCtr>(src[t]) << 8U);
+    ++t;
+    if (t == srcEnd) {
+        t = 0U;
+    }
+
+    // the sequence number and the checksum might need escaping
+    if ((QS::priv_.end - QS::priv_.used) < (len + 2U)) { // no room?
+        return false;
+    }
+
+    // find the checksum, the last byte before QS_FRAME (possibly escaped)
+    QSCtr i = t + len - 2U;
+    if (i >= srcEnd) {
+        i -= srcEnd;
+    }
+    std::uint8_t chksum = src[i];
+    QSCtr n = len - 3U; // number of bytes between the seq and the checksum
+    i = (i == 0U) ? (srcEnd - 1U) : (i - 1U);
+    if (src[i] == QS_ESC) {
+        chksum ^= QS_ESC_XOR;
+        --n;
+    }
+
+    // the checksum includes the sequence number, which was zero
+    std::uint8_t const seq = QS::priv_.seq + 1U;
+    QS::priv_.seq = seq;
+    chksum = static_cast<std::uint8_t>(chksum - seq);
+
+    std::uint8_t * const buf_ = QS::priv_.buf; // put in a temporary
+    QSCtr head_      = QS::priv_.head;         // put in a temporary
+    QSCtr const end_ = QS::priv_.end;          // put in a temporary
+    QSCtr used_      = QS::priv_.used + n + 3U; // seq, checksum, frame
+
+    if ((seq != QS_FRAME) && (seq != QS_ESC)) {
+        QS_INSERT_BYTE_(seq)
+    }
+    else {
+        QS_INSERT_BYTE_(QS_ESC)
+        QS_INSERT_BYTE_(static_cast<std::uint8_t>(seq ^ QS_ESC_XOR))
+        ++used_;
+    }
+
+    // copy the escaped record data as is
+    ++t; // skip the sequence number
+    if (t == srcEnd) {
+        t = 0U;
+    }
+    for (; n != 0U; --n) {
+        QS_INSERT_BYTE_(src[t])
+        ++t;
+        if (t == srcEnd) {
+            t = 0U;
+        }
+    }
+
+    if ((chksum != QS_FRAME) && (chksum != QS_ESC)) {
+        QS_INSERT_BYTE_(chksum)
+    }
+    else {
+        QS_INSERT_BYTE_(QS_ESC)
+        QS_INSERT_BYTE_(static_cast<std::uint8_t>(chksum ^ QS_ESC_XOR))
+        ++used_;
+    }
+    QS_INSERT_BYTE_(QS_FRAME) // do not escape this QS_FRAME
+
+    QS::priv_.head = head_;
+    QS::priv_.used = used_;
+
+    // release the record in the thread buffer
+    t = tb->tail + static_cast<QSCtr>(sizeof(QSTimeCtr)) + 2U + len;
+    if (t >= srcEnd) {
+        t -= srcEnd;
+    }
+    __atomic_store_n(&tb->tail, t, __ATOMIC_RELEASE);
+    return true;
+}
+#endif // QS_THREAD_BUF
+
 //****************************************************************************
 /// @note This function is only to be used through macro QS_SIG_DICTIONARY()
 ///
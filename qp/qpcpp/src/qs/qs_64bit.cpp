@@ -50,20 +50,20 @@ namespace QP {
 /// client code directly.
 ///
 void QS::u64_raw_(std::uint64_t d) noexcept {
-    std::uint8_t chksum_ = priv_.chksum;
-    std::uint8_t *buf_   = priv_.buf;
-    QSCtr   head_   = priv_.head;
-    QSCtr   end_    = priv_.end;
+    std::uint8_t chksum_ = QS_BUF_.chksum;
+    std::uint8_t *buf_   = QS_BUF_.buf;
+    QSCtr   head_   = QS_BUF_.head;
+    QSCtr   end_    = QS_BUF_.end;
 
-    priv_.used += 8U; // 8 bytes are about to be added
+    QS_BUF_.used += 8U; // 8 bytes are about to be added
     for (int_fast8_t i = 8U; i != 0U; --i) {
         std::uint8_t b = static_cast<std::uint8_t>(d);
         QS_INSERT_ESC_BYTE_(b)
         d >>= 8;
     }
 
-    priv_.head   = head_;    // save the head
-    priv_.chksum = chksum_;  // save the checksum
+    QS_BUF_.head   = head_;  // save the head
+    QS_BUF_.chksum = chksum_;  // save the checksum
 }
 
 //****************************************************************************
@@ -71,12 +71,12 @@ void QS::u64_raw_(std::uint64_t d) noexcept {
 /// client code directly.
 ///
 void QS::u64_fmt_(std::uint8_t format, std::uint64_t d) noexcept {
-    std::uint8_t chksum_ = priv_.chksum;
-    std::uint8_t *buf_   = priv_.buf;
-    QSCtr   head_   = priv_.head;
-    QSCtr   end_    = priv_.end;
+    std::uint8_t chksum_ = QS_BUF_.chksum;
+    std::uint8_t *buf_   = QS_BUF_.buf;
+    QSCtr   head_   = QS_BUF_.head;
+    QSCtr   end_    = QS_BUF_.end;
 
-    priv_.used += static_cast<QSCtr>(9); // 9 bytes are about to be added
+    QS_BUF_.used += static_cast<QSCtr>(9); // 9 bytes are about to be added
     QS_INSERT_ESC_BYTE_(format)  // insert the format byte
 
     for (std::int_fast8_t i = 8U; i != 0U; --i) {
@@ -85,8 +85,8 @@ void QS::u64_fmt_(std::uint8_t format, std::uint64_t d) noexcept {
         d >>= 8;
     }
 
-    priv_.head   = head_;    // save the head
-    priv_.chksum = chksum_;  // save the checksum
+    QS_BUF_.head   = head_;  // save the head
+    QS_BUF_.chksum = chksum_;  // save the checksum
 }
 
 } // namespace QP
@@ -51,14 +51,14 @@ void QS::f32_fmt_(std::uint8_t format, float32_t const d) noexcept {
         float32_t f;
         std::uint32_t  u;
     } fu32; // the internal binary representation
-    std::uint8_t chksum_  = priv_.chksum;  // put in a temporary (register)
-    std::uint8_t * const buf_ = priv_.buf; // put in a temporary (register)
-    QSCtr   head_    = priv_.head;    // put in a temporary (register)
-    QSCtr const end_ = priv_.end;     // put in a temporary (register)
+    std::uint8_t chksum_  = QS_BUF_.chksum;  // put in a temporary (register)
+    std::uint8_t * const buf_ = QS_BUF_.buf; // put in a temporary (register)
+    QSCtr   head_    = QS_BUF_.head;  // put in a temporary (register)
+    QSCtr const end_ = QS_BUF_.end;   // put in a temporary (register)
 
     fu32.f = d; // assign the binary representation
 
-    priv_.used += 5U; // 5 bytes about to be added
+    QS_BUF_.used += 5U; // 5 bytes about to be added
     QS_INSERT_ESC_BYTE_(format)  // insert the format byte
 
     for (std::uint_fast8_t i = 4U; i != 0U; --i) {
@@ -67,8 +67,8 @@ void QS::f32_fmt_(std::uint8_t format, float32_t const d) noexcept {
         fu32.u >>= 8U;
     }
 
-    priv_.head   = head_;    // save the head
-    priv_.chksum = chksum_;  // save the checksum
+    QS_BUF_.head   = head_;  // save the head
+    QS_BUF_.chksum = chksum_;  // save the checksum
 }
 
 //****************************************************************************
@@ -83,10 +83,10 @@ void QS::f64_fmt_(std::uint8_t format, float64_t const d) noexcept {
             std::uint32_t u2;
         } i;
     } fu64;  // the internal binary representation
-    std::uint8_t chksum_  = priv_.chksum;
-    std::uint8_t * const buf_ = priv_.buf;
-    QSCtr   head_    = priv_.head;
-    QSCtr const end_ = priv_.end;
+    std::uint8_t chksum_  = QS_BUF_.chksum;
+    std::uint8_t * const buf_ = QS_BUF_.buf;
+    QSCtr   head_    = QS_BUF_.head;
+    QSCtr const end_ = QS_BUF_.end;
     std::uint32_t i;
     // static constant untion to detect endianness of the machine
     static union U32Rep {
@@ -96,7 +96,7 @@ void QS::f64_fmt_(std::uint8_t format, float64_t const d) noexcept {
 
     fu64.d = d;  // assign the binary representation
 
-    priv_.used += 9U; // 9 bytes about to be added
+    QS_BUF_.used += 9U; // 9 bytes about to be added
     QS_INSERT_ESC_BYTE_(format)  // insert the format byte
 
     // is this a big-endian machine?
@@ -121,8 +121,8 @@ void QS::f64_fmt_(std::uint8_t format, float64_t const d) noexcept {
         fu64.i.u2 >>= 8U;
     }
 
-    priv_.head   = head_;   // update the head
-    priv_.chksum = chksum_; // update the checksum
+    QS_BUF_.head   = head_; // update the head
+    QS_BUF_.chksum = chksum_; // update the checksum
 }
 
 } // namespace QP
@@ -273,9 +273,19 @@ void QS::processTestEvts_(void) {
         // 2. dispatch the event to the AO's state machine.
         // 3. determine if event is garbage and collect it if so
         //
+#ifdef QF_EVT_BURST
+        // dispatch up to the burst limit of the AO, as the QV kernel does
+        QEvt const *evts[QF_EVT_BURST];
+        std::uint_fast8_t const n = a->getBurst_(evts);
+        for (std::uint_fast8_t i = 0U; i < n; ++i) {
+            a->dispatch(evts[i]);
+            QF::gc(evts[i]);
+        }
+#else
         QEvt const * const e = a->get_();
         a->dispatch(e);
         QF::gc(e);
+#endif // QF_EVT_BURST
 
         if (a->m_eQueue.isEmpty()) { // empty queue?
             rxPriv_.readySet.rmove(p);
@@ -287,7 +297,8 @@ void QS::processTestEvts_(void) {
 // The testing version of system tick processing performs as follows:
 // 1. If the Current Time Event (TE) Object is defined and the TE is armed,
 //    the TE is disarmed (if one-shot) and then posted to the recipient AO.
-// 2. The linked-list of all armed Time Events is updated.
+// 2. The linked-list of all armed Time Events is updated (the timing wheel
+//    is always up to date).
 //
 void QS::tickX_(std::uint_fast8_t const tickRate,
                 void const * const sender) noexcept
@@ -317,9 +328,16 @@ void QS::tickX_(std::uint_fast8_t const tickRate,
         // the recipient AO must be provided
         Q_ASSERT_ID(820, act != nullptr);
 
+#ifdef QF_TIMEEVT_WHEEL
+        t->wheelUnlink_(); // an armed time event is linked into the wheel
+#endif
+
         // periodic time evt?
         if (t->m_interval != 0U) {
             t->m_ctr = t->m_interval; // rearm the time event
+#ifdef QF_TIMEEVT_WHEEL
+            t->wheelLink_(t->m_interval);
+#endif
         }
         else { // one-shot time event: automatically disarm
             t->m_ctr = 0U; // auto-disarm
@@ -351,6 +369,7 @@ void QS::tickX_(std::uint_fast8_t const tickRate,
         QF_CRIT_ENTRY_();
     }
 
+#ifndef QF_TIMEEVT_WHEEL
     // update the linked list of time events
     for (;;) {
         t = prev->m_next; // advance down the time evt. list
@@ -392,6 +411,7 @@ void QS::tickX_(std::uint_fast8_t const tickRate,
         }
         QF_CRIT_ENTRY_(); // re-enter crit. section to continue
     }
+#endif // QF_TIMEEVT_WHEEL
 
     QF_CRIT_EXIT_();
 }
@@ -39,6 +39,13 @@
 #ifndef QS_PKG_HPP
 #define QS_PKG_HPP
 
+#ifndef QS_THREAD_BUF
+    //! Internal QS macro to access the buffer the QS records are written to
+    #define QS_BUF_ priv_
+#else
+    #define QS_BUF_ (*QS::tx_) // the thread buffer or QS::priv_
+#endif
+
 //! Internal QS macro to insert an un-escaped byte into the QS buffer
 #define QS_INSERT_BYTE_(b_) \
     buf_[head_] = (b_);     \
@@ -56,7 +63,7 @@
     else {                                        \
         QS_INSERT_BYTE_(QS_ESC)                   \
         QS_INSERT_BYTE_(static_cast<std::uint8_t>((b_) ^ QS_ESC_XOR)) \
-        ++priv_.used;                             \
+        ++QS_BUF_.used;                           \
     }
 
 //****************************************************************************
@@ -71,16 +78,16 @@
         && (((objFilter_) == nullptr)         \
             || ((objFilter_) == (obj_))))     \
     {                                         \
-        QS_CRIT_ENTRY_();                     \
+        QS_REC_CRIT_ENTRY_();                 \
         QP::QS::beginRec_(static_cast<std::uint_fast8_t>(rec_));
 
 //! Internal QS macro to end a predefined QS record with critical section.
 /// @note
 /// This macro is intended to use only inside QP components and NOT
 /// at the application level. @sa #QS_END
-#define QS_END_PRE_()      \
-        QP::QS::endRec_(); \
-        QS_CRIT_EXIT_();   \
+#define QS_END_PRE_()        \
+        QP::QS::endRec_();   \
+        QS_REC_CRIT_EXIT_(); \
     }
 
 //! Internal QS macro to begin a predefined QS record without critical section.
@@ -161,9 +161,19 @@ int_t QF::run(void) {
             // 2. dispatch the event to the AO's state machine.
             // 3. determine if event is garbage and collect it if so
             //
+#ifdef QF_EVT_BURST
+            // dispatch up to the burst limit of the AO (see NOTE01)
+            QEvt const *evts[QF_EVT_BURST];
+            std::uint_fast8_t const n = a->getBurst_(evts);
+            for (std::uint_fast8_t i = 0U; i < n; ++i) {
+                a->dispatch(evts[i]);
+                gc(evts[i]);
+            }
+#else
             QEvt const * const e = a->get_();
             a->dispatch(e);
             gc(e);
+#endif // QF_EVT_BURST
 
             QF_INT_DISABLE();
 
@@ -240,3 +250,17 @@ void QActive::start(std::uint_fast8_t const prio,
 
 } // namespace QP
 
+
+//****************************************************************************
+// NOTE01:
+// With QF_EVT_BURST, the QV kernel removes up to QActive::setBurst() events
+// from the queue of the highest-priority AO ready to run in one critical
+// section (QActive::getBurst_()) and dispatches them one after another,
+// before it checks again for the AOs of higher priority. The burst limit
+// of an AO therefore bounds the additional latency of the higher-priority
+// AOs to the duration of that many RTC steps of the AO. The default limit
+// is 1 (one event at a time), so an AO must opt in with
+// QActive::setBurst(), which is not allowed for the AOs using postLIFO()
+// or recall(): their front-of-queue events would wait for the whole burst.
+//
+
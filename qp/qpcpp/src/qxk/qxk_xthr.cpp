@@ -505,6 +505,9 @@ void QXThread::teArm_(enum_t const sig,
         m_timeEvt.m_ctr = static_cast<QTimeEvtCtr>(nTicks);
         m_timeEvt.m_interval = 0U;
 
+#ifdef QF_TIMEEVT_WHEEL
+        m_timeEvt.wheelLink_(static_cast<QTimeEvtCtr>(nTicks));
+#else
         // is the time event unlinked?
         // NOTE: For the duration of a single clock tick of the specified tick
         // rate a time event can be disarmed and yet still linked in the list,
@@ -524,6 +527,7 @@ void QXThread::teArm_(enum_t const sig,
                 = QXK_PTR_CAST_(QTimeEvt*, QF::timeEvtHead_[tickRate].m_act);
             QF::timeEvtHead_[tickRate].m_act = &m_timeEvt;
         }
+#endif // QF_TIMEEVT_WHEEL
     }
 }
 
@@ -539,6 +543,9 @@ bool QXThread::teDisarm_(void) noexcept {
     // is the time evt running?
     if (m_timeEvt.m_ctr != 0U) {
         wasArmed = true;
+#ifdef QF_TIMEEVT_WHEEL
+        m_timeEvt.wheelUnlink_(); // remove from the timing wheel
+#endif
         // schedule removal from list
         m_timeEvt.m_ctr = 0U;
     }
@@ -0,0 +1,125 @@
+#-----------------------------------------------------------------------------
+# Product: generator of binary QS captures for the QSPY_parse() benchmark
+# Last updated for version 6.8.2
+# Last updated on  2020-07-17
+#
+#                    Q u a n t u m  L e a P s
+#                    ------------------------
+#                    Modern Embedded Software
+#
+# Copyright (C) 2005-2020 Quantum Leaps, LLC. All rights reserved.
+#
+# This program is open source software: you can redistribute it and/or
+# modify it under the terms of the GNU General Public License as published
+# by the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# Alternatively, this program may be distributed and modified under the
+# terms of Quantum Leaps commercial licenses, which expressly supersede
+# the GNU General Public License and are specifically designed for
+# licensees interested in retaining the proprietary status of their code.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program. If not, see <www.gnu.org/licenses/>.
+#
+# Contact information:
+# <www.state-machine.com/licensing>
+# <info@state-machine.com>
+#-----------------------------------------------------------------------------
+#
+# usage: python3 gen_capture.py [-l] <size> [seed] > capture.bin
+#
+# Writes a binary QS capture of about <size> bytes made of user records
+# (QS_USER+0..5) with random U8, U32, STR and MEM arguments, framed and
+# escaped as by the QS target code (the default QSPY target parameters:
+# 4-byte timestamps). About 1 in 170 frames is corrupted on purpose (bad
+# checksum, too short, too long, sequence gap, escape before the frame
+# byte), so the error paths of QSPY_parse() are timed as well.
+#
+# The option -l makes the MEM arguments 100..250 bytes long instead of
+# 0..48 bytes, for long plain runs between the escaped bytes.
+#
+import random
+import struct
+import sys
+
+QS_FRAME   = 0x7E
+QS_ESC     = 0x7D
+QS_ESC_XOR = 0x20
+QS_USER    = 100
+
+def escape(data):
+    out = bytearray()
+    for b in data:
+        if b in (QS_FRAME, QS_ESC):
+            out += bytes((QS_ESC, b ^ QS_ESC_XOR))
+        else:
+            out.append(b)
+    return out
+
+def frame(body, bad_chksum = False):
+    chksum = (~sum(body)) & 0xFF
+    if bad_chksum:
+        chksum ^= 0x5A
+    return escape(body + bytes((chksum,))) + bytes((QS_FRAME,))
+
+def main(argv):
+    mem_len = (0, 48)
+    if len(argv) > 0 and argv[0] == '-l':
+        mem_len = (100, 250)
+        argv = argv[1:]
+    if len(argv) < 1:
+        sys.exit('usage: gen_capture.py [-l] <size> [seed] > capture.bin')
+    size = int(argv[0])
+    random.seed(int(argv[1]) if len(argv) > 1 else 1)
+
+    out = bytearray((QS_FRAME,))
+    seq = 0
+    tstamp = 0
+    while len(out) < size:
+        seq = (seq + 1) & 0xFF
+        tstamp = (tstamp + random.randint(1, 5000)) & 0xFFFFFFFF
+        body = bytearray((seq, QS_USER + random.randint(0, 5)))
+        body += struct.pack('<I', tstamp)
+        for _ in range(random.randint(0, 6)): # record arguments
+            kind = random.randint(0, 3)
+            if kind == 0:   # U32 format
+                body += bytes((0x05,))
+                body += struct.pack('<I', random.getrandbits(32))
+            elif kind == 1: # MEM format
+                n = random.randint(*mem_len)
+                body += bytes((0x09, n))
+                body += bytes(random.getrandbits(8) for _ in range(n))
+            elif kind == 2: # STR format
+                body += bytes((0x08,))
+                body += ('s%d' % random.randint(0, 99999)).encode() + b'\0'
+            else:           # U8 format
+                body += bytes((0x01, random.getrandbits(8)))
+
+        r = random.random()
+        if r < 0.002:   # bad checksum
+            out += frame(body, bad_chksum = True)
+        elif r < 0.003: # record too short
+            out += escape(bytes((seq,))) + bytes((QS_FRAME,))
+        elif r < 0.004: # record too long
+            out += bytes((random.getrandbits(8) | 1) for _ in range(700)) \
+                       .replace(bytes((QS_FRAME,)), b'\x7F')
+            out += bytes((QS_FRAME,))
+        elif r < 0.005: # sequence discontinuity
+            seq = (seq + 3) & 0xFF
+            body[0] = seq
+            out += frame(body)
+        elif r < 0.006: # escape right before the frame byte
+            out += bytes((QS_ESC, QS_FRAME))
+        else:
+            out += frame(body)
+
+    sys.stdout.buffer.write(out)
+
+if __name__ == '__main__':
+    main(sys.argv[1:])
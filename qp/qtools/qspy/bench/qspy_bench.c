@@ -0,0 +1,194 @@
+/**
+* @file
+* @brief QSPY_parse() throughput benchmark
+* @ingroup qpspy
+* @cond
+******************************************************************************
+* Last updated for version 6.8.2
+* Last updated on  2020-07-17
+*                    Q u a n t u m  L e a P s
+*                    ------------------------
+*                    Modern Embedded Software
+*
+* Copyright (C) 2005-2020 Quantum Leaps, LLC. All rights reserved.
+*
+* This program is open source software: you can redistribute it and/or
+* modify it under the terms of the GNU General Public License as published
+* by the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* Alternatively, this program may be distributed and modified under the
+* terms of Quantum Leaps commercial licenses, which expressly supersede
+* the GNU General Public License and are specifically designed for
+* licensees interested in retaining the proprietary status of their code.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program. If not, see <www.gnu.org/licenses>.
+*
+* Contact information:
+* <www.state-machine.com/licensing>
+* <info@state-machine.com>
+******************************************************************************
+* @endcond
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "safe_std.h" /* "safe" <stdio.h> and <string.h> facilities */
+#include "qspy.h"     /* QSPY data parser */
+
+/*
+* The benchmark reads a whole binary QS capture (as saved by "qspy -s" or
+* made by gen_capture.py) into memory and feeds it to QSPY_parse() in
+* chunks of the size QSPY reads from a file, as many times as requested.
+* By default the records are only framed, unescaped and checksummed (the
+* custom parser skips their formatting), which is the part of QSPY_parse()
+* that copies the plain runs of bytes in bulk. The option -p formats every
+* record too, but discards the output lines.
+*
+* The digest combines the bytes of every record and the text of every
+* line printed (errors included), so two builds of qspy.c (e.g., with and
+* without SSE2) must report the same digest for the same capture.
+*/
+enum {
+    CHUNK_SIZE = 8*1024 /* the chunk size of "qspy -f" */
+};
+
+static uint32_t l_nRec;    /* number of records framed */
+static uint32_t l_nLines;  /* number of lines printed */
+static uint32_t l_nErrors; /* number of error lines printed */
+static uint64_t l_digest = 14695981039346656037ULL; /* FNV-1a offset */
+static bool     l_format;  /* format the records (-p)? */
+
+/*..........................................................................*/
+static void digest(uint8_t const *buf, size_t len) {
+    size_t i;
+    for (i = 0U; i < len; ++i) {
+        l_digest ^= buf[i];
+        l_digest *= 1099511628211ULL; /* FNV-1a prime */
+    }
+}
+/*..........................................................................*/
+static int custParse(QSpyRecord * const me) {
+    ++l_nRec;
+    digest(me->start, (size_t)me->tot_len);
+    return l_format ? 1 : 0; /* format the record? */
+}
+
+/*..........................................................................*/
+int main(int argc, char *argv[]) {
+    char const *fname = (char const *)0;
+    int nRep = 3;
+    int i;
+    FILE *f;
+    uint8_t *buf;
+    long len;
+    long pos;
+    struct timespec t0;
+    struct timespec t1;
+    double sec;
+
+    for (i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-p") == 0) {
+            l_format = true;
+        }
+        else if (fname == (char const *)0) {
+            fname = argv[i];
+        }
+        else {
+            nRep = atoi(argv[i]);
+        }
+    }
+    if ((fname == (char const *)0) || (nRep <= 0)) {
+        fprintf(stderr, "usage: qspy_bench [-p] <capture.bin> [repeat]\n");
+        return -1;
+    }
+
+    FOPEN_S(f, fname, "rb");
+    if (f == (FILE *)0) {
+        fprintf(stderr, "cannot open the capture %s\n", fname);
+        return -1;
+    }
+    fseek(f, 0L, SEEK_END);
+    len = ftell(f);
+    fseek(f, 0L, SEEK_SET);
+    buf = (uint8_t *)malloc((size_t)len + 1U);
+    if ((buf == (uint8_t *)0)
+        || (fread(buf, 1U, (size_t)len, f) != (size_t)len))
+    {
+        fprintf(stderr, "cannot read the capture %s\n", fname);
+        fclose(f);
+        return -1;
+    }
+    fclose(f);
+
+    /* the default Target parameters of QSPY (no -v, -T, -O, ... options) */
+    QSPY_config(620U, /* version */
+                4U,   /* objPtrSize */
+                4U,   /* funPtrSize */
+                4U,   /* tstampSize */
+                2U,   /* sigSize */
+                2U,   /* evtSize */
+                1U,   /* queueCtrSize */
+                2U,   /* poolCtrSize */
+                2U,   /* poolBlkSize */
+                2U,   /* tevtCtrSize */
+                (void *)0,  /* matFile */
+                (void *)0,  /* mscFile */
+                &custParse);
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (i = 0; i < nRep; ++i) {
+        for (pos = 0L; pos < len; pos += CHUNK_SIZE) {
+            QSPY_parse(&buf[pos], (uint32_t)(((len - pos) < CHUNK_SIZE)
+                                             ? (len - pos)
+                                             : CHUNK_SIZE));
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    sec = (double)(t1.tv_sec - t0.tv_sec)
+          + ((double)(t1.tv_nsec - t0.tv_nsec) * 1e-9);
+
+    printf("%s: %ld bytes x %d, %u records, %u lines (%u errors)\n",
+           fname, len, nRep, l_nRec, l_nLines, l_nErrors);
+    printf("digest %016llx, %.3f s, %.1f MB/s\n",
+           (unsigned long long)l_digest, sec,
+           ((double)len * nRep) / sec / 1e6);
+
+    free(buf);
+    return 0;
+}
+
+/*..........................................................................*/
+void Q_onAssert(char const * const module, int loc) {
+    fprintf(stderr, "ASSERTION failed in Module=%s:%d\n", module, loc);
+    exit(-1);
+}
+/*..........................................................................*/
+void QSPY_onPrintLn(void) {
+    char const *line = &QSPY_output.buf[QS_LINE_OFFSET];
+    ++l_nLines;
+    if (QSPY_output.type == ERR_OUT) {
+        ++l_nErrors;
+    }
+    digest((uint8_t const *)line, strlen(line));
+    QSPY_output.type = REG_OUT; /* reset for the next time */
+}
+/*..........................................................................*/
+void QSPY_printInfo(void) {
+    QSPY_output.type = INF_OUT; /* this is an internal info message */
+    QSPY_onPrintLn();
+}
+/*..........................................................................*/
+bool QSPY_command(uint8_t cmdId) {
+    (void)cmdId; /* unused parameter */
+    return false; /* no commands in the benchmark */
+}
@@ -53,6 +53,7 @@ void PAL_clearScreen(void);
 QSpyStatus PAL_openTargetSer(char const *comName, int baudRate);
 QSpyStatus PAL_openTargetTcp(int portNum);
 QSpyStatus PAL_openTargetFile(char const *fName);
+QSpyStatus PAL_openTargetFileJobs(char const *fName, int nJobs);
 
 /* events for the QSPY event loop... */
 typedef enum {
@@ -79,6 +80,7 @@ typedef struct {
     QSPYEvtType (*getEvt)(unsigned char *buf, size_t *pBytes);
     QSpyStatus  (*send2Target)(unsigned char *buf, size_t nBytes);
     void (*cleanup)(void);
+    bool (*captureLn)(void); /* take the output line away from QSPY? */
 } PAL_VtblType;
 
 extern PAL_VtblType PAL_vtbl;
@@ -91,7 +91,8 @@ enum QSpyRecords {
     QS_QF_EQUEUE_GET,     /*!< get an event and queue still not empty */
     QS_QF_EQUEUE_GET_LAST,/*!< get the last event from the queue */
 
-    QS_QF_RESERVED2,
+    /* [23] Additional Active Object (AO) records */
+    QS_QF_ACTIVE_POST_MERGE, /*!< an AO merged a post with a pending event */
 
     /* [24] Memory Pool (MP) records */
     QS_QF_MPOOL_GET,      /*!< a memory block was removed from memory pool */
@@ -159,8 +160,10 @@ enum QSpyRecords {
     QS_PEEK_DATA,         /*!< reports the data from the PEEK query */
     QS_ASSERT_FAIL,       /*!< assertion failed in the code */
 
-    /* [70] Reserved QS records */
-    QS_RESERVED_70,
+    /* [70] Additional QF records */
+    QS_QF_TICK_STAT,      /*!< processing statistics of a tick domain */
+
+    /* [71] Reserved QS records */
     QS_RESERVED_71,
     QS_RESERVED_72,
     QS_RESERVED_73,
@@ -493,8 +496,8 @@ QSTimeCtr QS_onGetTime(void);
 * The active object filter affects the following QS records:
 * ::QS_QF_ACTIVE_DEFER, ::QS_QF_ACTIVE_RECALL, ::QS_QF_ACTIVE_SUBSCRIBE,
 * ::QS_QF_ACTIVE_UNSUBSCRIBE, ::QS_QF_ACTIVE_POST, ::QS_QF_ACTIVE_POST_LIFO,
-* ::QS_QF_ACTIVE_GET, ::QS_QF_ACTIVE_GET_LAST, and
-* ::QS_QF_ACTIVE_RECALL_ATTEMPT.
+* ::QS_QF_ACTIVE_GET, ::QS_QF_ACTIVE_GET_LAST,
+* ::QS_QF_ACTIVE_RECALL_ATTEMPT, and ::QS_QF_ACTIVE_POST_MERGE.
 *
 * @sa Example of using QS filters in #QS_FILTER_ON documentation
 */
@@ -97,6 +97,21 @@ typedef uint64_t KeyType;
 typedef uint32_t SigType;
 typedef uint64_t ObjType;
 
+/*! index keys of a QS record, collected while the record is decoded */
+typedef struct {
+    uint32_t tstamp; /*!< time stamp of the record */
+    ObjType  obj;    /*!< object of the record (the "Obj=" field) */
+    SigType  sig;    /*!< signal of the record (the "Sig=" field) */
+    uint8_t  flags;  /*!< which keys are valid (QSPY_KEY_... bits) */
+} QSpyRecKeys;
+
+enum QSpyRecKeyFlags {
+    QSPY_KEY_TSTAMP = (1U << 0), /*!< the record has a time stamp */
+    QSPY_KEY_OBJ    = (1U << 1), /*!< the record pertains to an object */
+    QSPY_KEY_SIG    = (1U << 2), /*!< the record pertains to a signal */
+    QSPY_KEY_RESET  = (1U << 3)  /*!< the record reports a Target reset */
+};
+
 /* the largest valid QS record size [bytes] */
 #define QS_MAX_RECORD_SIZE  512
 
@@ -142,6 +157,12 @@ void QSPY_configMscFile(void *mscFile);
 
 void QSPY_reset(void);
 void QSPY_parse(uint8_t const *buf, uint32_t nBytes);
+/* parse, but process only the state records (Target info, dictionaries) */
+void QSPY_parseState(uint8_t const *buf, uint32_t nBytes);
+/* process a single complete (un-escaped) QS record, e.g., from an archive */
+void QSPY_parseRec(uint8_t const *rec, uint32_t nBytes, bool stateOnly);
+/* is it a record that changes the parser state (Target info, dictionary)? */
+bool QSPY_isStateRec(uint8_t rec);
 void QSPY_txReset(void);
 
 void QSPY_setExternDict(char const *dictName);
@@ -164,6 +185,26 @@ SigType QSPY_findSig(char const *name, ObjType obj);
 KeyType QSPY_findObj(char const *name);
 KeyType QSPY_findFun(char const *name);
 KeyType QSPY_findUsr(char const *name);
+int     QSPY_findRec(char const *name); /* standard record-ID or -1 */
+char const *QSPY_getObj(ObjType obj); /* object name or its address */
+
+/* indexed archive of QS records (see qspy_arc.c) */
+QSpyStatus QSPY_arcOpen(char const *fName);
+void QSPY_arcPut(uint8_t const *rec, uint32_t nBytes,
+                 QSpyRecKeys const *keys);
+void QSPY_arcClose(void);
+QSpyStatus QSPY_arcQuery(char const *fName, char const *filter);
+bool QSPY_arcIsQuiet(void); /* output suppressed while replaying archive? */
+
+/* streaming statistics of QS records (see qspy_stat.c) */
+void QSPY_statOn(void);
+void QSPY_statPost(uint32_t t, ObjType ao,
+                   uint32_t nFree, uint32_t nMin, bool lifo);
+void QSPY_statGet(uint32_t t, ObjType ao, uint32_t nFree, bool last);
+void QSPY_statRtc(uint32_t t, ObjType sm, bool begin);
+void QSPY_statPool(ObjType mp, uint32_t nFree, uint32_t nMin, bool get);
+void QSPY_statReset(void); /* forget the events in flight (Target reset) */
+void QSPY_statReport(bool final);
 
 void QSPY_stop(void); /* orderly close all used files */
 
@@ -46,6 +46,10 @@
 #include <unistd.h>
 #include <sys/select.h>
 #include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <signal.h>
 #include <sys/socket.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
@@ -74,6 +78,10 @@ static QSPYEvtType file_getEvt(unsigned char *buf, size_t *pBytes);
 static QSpyStatus  file_send2Target(unsigned char *buf, size_t nBytes);
 static void file_cleanup(void);
 
+static QSPYEvtType par_getEvt(unsigned char *buf, size_t *pBytes);
+static void par_cleanup(void);
+static bool par_captureLn(void);
+
 /* helper functions ........................................................*/
 static QSPYEvtType be_receive (fd_set const *pReadSet,
                                unsigned char *buf, size_t *pBytes);
@@ -103,6 +111,24 @@ static socklen_t       l_beReturnAddrSize;
 
 static FILE *l_file = (FILE *)0;
 
+/* parallel decoding of a capture file... */
+typedef struct {
+    pid_t pid;  /* worker process decoding the chunk */
+    FILE *out;  /* output lines captured by the worker */
+} ParJob;
+
+static uint8_t const *l_parMap;  /* the capture file mapped to memory */
+static size_t  l_parSize;        /* size of the capture file */
+static size_t  l_parPos;         /* start of the next chunk */
+static size_t  l_parChunk;       /* nominal chunk size */
+static ParJob *l_parJob;         /* ring buffer of the jobs in progress */
+static int     l_parMaxJobs;     /* capacity of the ring buffer */
+static int     l_parHead;        /* the next job to dispatch */
+static int     l_parTail;        /* the oldest job in progress */
+static int     l_parJobs;        /* number of jobs in progress */
+static FILE   *l_parCapture;     /* output capture in the worker process */
+static bool    l_parDiscard;     /* discard output (state pass)? */
+
 /* PAL timeout determines how long to wait for an event [ms] */
 #define PAL_TOUT_MS 10
 
@@ -561,6 +587,276 @@ static void file_cleanup(void) {
 }
 
 
+/*==========================================================================*/
+/* Parallel decoding of a capture File
+*
+* The file is mapped to memory and cut into chunks, each ending right after
+* a QS_FRAME byte. Every chunk is decoded by a forked worker process, which
+* starts with a copy of the parser exactly as it would be at the beginning
+* of the chunk: before forking the next worker, the main process runs the
+* chunk through QSPY_parseState(), which tracks the framing, the Target
+* info and the dictionaries, but doesn't decode anything else. The workers
+* capture their output lines in temporary files, which the main process
+* then outputs in the original order through QSPY_onPrintLn().
+*/
+QSpyStatus PAL_openTargetFileJobs(char const *fName, int nJobs) {
+    int fd;
+    struct stat st;
+    void *map;
+
+    /* setup the PAL virtual table for the parallel File decoding... */
+    PAL_vtbl.getEvt      = &par_getEvt;
+    PAL_vtbl.send2Target = &file_send2Target;
+    PAL_vtbl.cleanup     = &par_cleanup;
+    PAL_vtbl.captureLn   = &par_captureLn;
+
+    /* start with initializing the keyboard (terminal) */
+    if (kbd_open() != QSPY_SUCCESS) {
+        return QSPY_ERROR;
+    }
+
+    fd = open(fName, O_RDONLY);
+    if (fd < 0) {
+        SNPRINTF_LINE("   <COMMS> ERROR    Cannot find File=%s", fName);
+        QSPY_printError();
+        return QSPY_ERROR;
+    }
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        SNPRINTF_LINE("   <COMMS> ERROR    Cannot stat File=%s", fName);
+        QSPY_printError();
+        return QSPY_ERROR;
+    }
+    l_parSize = (size_t)st.st_size;
+    map = MAP_FAILED;
+    if (l_parSize > 0U) {
+        map = mmap(NULL, l_parSize, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map == MAP_FAILED) {
+            close(fd);
+            SNPRINTF_LINE("   <COMMS> ERROR    Cannot map File=%s errno=%d",
+                          fName, errno);
+            QSPY_printError();
+            return QSPY_ERROR;
+        }
+        madvise(map, l_parSize, MADV_SEQUENTIAL);
+    }
+    close(fd); /* the mapping stays valid */
+    l_parMap = (map != MAP_FAILED) ? (uint8_t const *)map : (uint8_t *)0;
+    l_parPos = 0U;
+
+    if (nJobs <= 0) { /* use all the available CPUs? */
+        nJobs = (int)sysconf(_SC_NPROCESSORS_ONLN);
+        if (nJobs <= 0) {
+            nJobs = 1;
+        }
+    }
+
+    /* several chunks per job for balancing, but not too big or small */
+    l_parChunk = l_parSize / (4U * (size_t)nJobs);
+    if (l_parChunk > 64U*1024U*1024U) {
+        l_parChunk = 64U*1024U*1024U;
+    }
+    else if (l_parChunk < 256U*1024U) {
+        l_parChunk = 256U*1024U;
+    }
+
+    l_parJob = (ParJob *)calloc((size_t)nJobs, sizeof(ParJob));
+    Q_ASSERT(l_parJob != (ParJob *)0);
+    l_parMaxJobs = nJobs;
+    l_parHead    = 0;
+    l_parTail    = 0;
+    l_parJobs    = 0;
+
+    QSPY_reset();   /* reset the QSPY parser to start over cleanly */
+    QSPY_txReset(); /* reset the QSPY transmitter */
+
+    updateReadySet(0); /* only the keyboard is checked in select() */
+
+    SNPRINTF_LINE("   <COMMS> File     Opened File=%s Jobs=%d",
+                  fName, nJobs);
+    QSPY_printInfo();
+
+    return QSPY_SUCCESS;
+}
+/*..........................................................................*/
+/* parse the QS data (or just the state) of a chunk of the capture file */
+static void par_parse(size_t pos, size_t end, bool stateOnly) {
+    while (pos < end) {
+        uint32_t n = ((end - pos) < 0x10000000U)
+                     ? (uint32_t)(end - pos)
+                     : 0x10000000U;
+        if (stateOnly) {
+            QSPY_parseState(&l_parMap[pos], n);
+        }
+        else {
+            QSPY_parse(&l_parMap[pos], n);
+        }
+        pos += n;
+    }
+}
+/*..........................................................................*/
+/* start decoding the next chunk of the capture file in a worker process */
+static QSpyStatus par_dispatch(void) {
+    size_t end;
+    ParJob *job = &l_parJob[l_parHead];
+    uint8_t const *frame;
+
+    /* the chunk ends right after a frame byte (or at the end of file) */
+    end = l_parPos + l_parChunk;
+    if (end < l_parSize) {
+        frame = (uint8_t const *)memchr(&l_parMap[end], (int)QS_FRAME,
+                                        l_parSize - end);
+        end = (frame != (uint8_t const *)0)
+              ? (size_t)(frame - l_parMap) + 1U
+              : l_parSize;
+    }
+    else {
+        end = l_parSize;
+    }
+
+    job->out = tmpfile();
+    if (job->out == (FILE *)0) {
+        SNPRINTF_LINE("   <COMMS> ERROR    Cannot create output "
+                      "for a job errno=%d", errno);
+        QSPY_printError();
+        return QSPY_ERROR;
+    }
+
+    fflush((FILE *)0); /* don't duplicate the pending output in the worker */
+    job->pid = fork();
+    if (job->pid == 0) { /* the worker process? */
+        l_parCapture = job->out;
+        par_parse(l_parPos, end, false);
+        _exit((fflush(l_parCapture) == 0) ? 0 : 1);
+    }
+    else if (job->pid < 0) {
+        fclose(job->out);
+        SNPRINTF_LINE("   <COMMS> ERROR    Cannot start a job errno=%d",
+                      errno);
+        QSPY_printError();
+        return QSPY_ERROR;
+    }
+
+    /* bring the parser state to the end of the chunk for the next job */
+    l_parDiscard = true;
+    par_parse(l_parPos, end, true);
+    l_parDiscard = false;
+
+    l_parPos = end;
+    l_parHead = (l_parHead + 1) % l_parMaxJobs;
+    ++l_parJobs;
+    return QSPY_SUCCESS;
+}
+/*..........................................................................*/
+/* wait for the oldest job and output its lines in the original order */
+static QSpyStatus par_collect(void) {
+    ParJob *job = &l_parJob[l_parTail];
+    int status;
+    int hdr[4]; /* type, rec, len, number of chars */
+    QSpyStatus ret = QSPY_SUCCESS;
+
+    while (waitpid(job->pid, &status, 0) < 0) {
+        if (errno != EINTR) {
+            status = -1;
+            break;
+        }
+    }
+    job->pid = 0;
+    l_parTail = (l_parTail + 1) % l_parMaxJobs;
+    --l_parJobs;
+
+    rewind(job->out);
+    while (fread(hdr, sizeof(hdr), 1U, job->out) == 1U) {
+        size_t n = (size_t)hdr[3];
+        if (n > QS_MAX_LINE_LENGTH - QS_LINE_OFFSET - 1) {
+            break; /* corrupted output */
+        }
+        if (fread(QSPY_line, 1U, n, job->out) != n) {
+            break;
+        }
+        QSPY_line[n]     = '\0';
+        QSPY_output.type = hdr[0];
+        QSPY_output.rec  = hdr[1];
+        QSPY_output.len  = hdr[2];
+        QSPY_onPrintLn();
+    }
+    fclose(job->out);
+    job->out = (FILE *)0;
+
+    if (!WIFEXITED(status) || (WEXITSTATUS(status) != 0)) {
+        SNPRINTF_LINE("   <COMMS> ERROR    Decoding job failed "
+                      "status=0x%X", (unsigned)status);
+        QSPY_printError();
+        ret = QSPY_ERROR;
+    }
+    return ret;
+}
+/*..........................................................................*/
+static QSPYEvtType par_getEvt(unsigned char *buf, size_t *pBytes) {
+    QSPYEvtType evt;
+    fd_set readSet = l_readSet;
+    struct timeval timeout = { 0, 0 }; /* just poll the keyboard */
+
+    if (select(l_maxFd, &readSet, 0, 0, &timeout) > 0) {
+        evt = kbd_receive(&readSet, buf, pBytes);
+        if (evt != QSPY_NO_EVT) {
+            return evt;
+        }
+    }
+
+    /* keep all the jobs busy... */
+    while ((l_parPos < l_parSize) && (l_parJobs < l_parMaxJobs)) {
+        if (par_dispatch() != QSPY_SUCCESS) {
+            return QSPY_ERROR_EVT;
+        }
+    }
+
+    if (l_parJobs == 0) { /* all chunks decoded and output? */
+        return QSPY_DONE_EVT;
+    }
+    return (par_collect() == QSPY_SUCCESS)
+           ? QSPY_NO_EVT
+           : QSPY_ERROR_EVT;
+}
+/*..........................................................................*/
+static void par_cleanup(void) {
+    kbd_close(); /* close the keyboard */
+
+    if (l_parCapture != (FILE *)0) { /* cleanup in the worker process? */
+        return; /* the jobs and the mapping belong to the main process */
+    }
+    if (l_parJob != (ParJob *)0) {
+        while (l_parJobs > 0) { /* terminate the jobs still in progress */
+            ParJob *job = &l_parJob[l_parTail];
+            kill(job->pid, SIGTERM);
+            waitpid(job->pid, (int *)0, 0);
+            fclose(job->out);
+            l_parTail = (l_parTail + 1) % l_parMaxJobs;
+            --l_parJobs;
+        }
+        free(l_parJob);
+        l_parJob = (ParJob *)0;
+    }
+    if (l_parMap != (uint8_t const *)0) {
+        munmap((void *)l_parMap, l_parSize);
+        l_parMap = (uint8_t const *)0;
+    }
+}
+/*..........................................................................*/
+static bool par_captureLn(void) {
+    if (l_parCapture != (FILE *)0) { /* in the worker process? */
+        int hdr[4];
+        hdr[0] = QSPY_output.type;
+        hdr[1] = QSPY_output.rec;
+        hdr[2] = QSPY_output.len;
+        hdr[3] = (int)strlen(QSPY_line);
+        fwrite(hdr, sizeof(hdr), 1U, l_parCapture);
+        fwrite(QSPY_line, 1U, (size_t)hdr[3], l_parCapture);
+        return true;
+    }
+    return l_parDiscard;
+}
+
 /*==========================================================================*/
 /* Front-End interface  */
 QSpyStatus PAL_openBE(int portNum) {
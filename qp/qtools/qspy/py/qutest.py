@@ -262,7 +262,7 @@ class qutest:
                     filter[0] |= 0x000003FE
                     filter[1] |= 0x03800000
                 elif arg == qspy._GRP_AO:   # active objects
-                    filter[0] |= 0x0007FC00
+                    filter[0] |= 0x0087FC00
                     filter[1] |= 0x00002000
                 elif arg == qspy._GRP_EQ:  # raw queues
                     filter[0] |= 0x00780000
@@ -57,7 +57,8 @@ typedef enum {
     NO_LINK,
     FILE_LINK,
     SERIAL_LINK,
-    TCP_LINK
+    TCP_LINK,
+    ARC_LINK    /* query of an archive (no Target) */
 } TargetLink;
 
 static TargetLink l_link = NO_LINK;
@@ -75,12 +76,18 @@ static char  l_savFileName[FNAME_SIZE];
 static char  l_matFileName[FNAME_SIZE];
 static char  l_mscFileName[FNAME_SIZE];
 static char  l_dicFileName[FNAME_SIZE];
+static char  l_arcFileName[FNAME_SIZE];
+static char  l_qryFileName[FNAME_SIZE];
+static char  l_qryFilter  [256];
 
 static char  l_tstampStr  [16];
 
 static int   l_bePort   = 7701;   /* default UDP port  */
 static int   l_tcpPort  = 6601;   /* default TCP port */
 static int   l_baudRate = 115200; /* default serial baudrate */
+static int   l_jobs     = 1;      /* file decoding jobs (0 - all CPUs) */
+static int   l_statSec  = -1;     /* statistics period [s] (-1 - off) */
+static time_t l_statTime;         /* time of the next statistics summary */
 
 static char const l_introStr[] =
     "QSPY %s Copyright (c) 2005-2020 Quantum Leaps\n"
@@ -101,6 +108,13 @@ static char const l_helpStr[] =
     "-s                (key-s) save binary QS data to a file\n"
     "-m                        produce Matlab output to a file\n"
     "-g                        produce MscGen output to a file\n"
+    "-a                        save indexed QS archive to a file\n"
+    "-x <file_name>            query an indexed QS archive\n"
+    "-w <filter>               query filter for -x, e.g.:\n"
+    "                  rec=QS_QF_ACTIVE_POST,obj=AO_Table,t=100-200\n"
+    "                  (epoch=N selects the time after N Target resets)\n"
+    "-y [seconds]      10      statistics of queues, RTC steps, pools\n"
+    "                          (0 - final report only)\n"
     "-t [TCP_port]     6601    TCP/IP input with optional port\n"
 #ifdef _WIN32
     "-c <COM_port>     COM1    com port input (default)\n"
@@ -109,6 +123,9 @@ static char const l_helpStr[] =
 #endif
     "-b <baud_rate>    115200  baud rate for the com port\n"
     "-f <file_name>            file input (postprocessing)\n"
+#ifndef _WIN32
+    "-j [jobs]         #CPUs   parallel decoding of the -f file input\n"
+#endif
     "-d [file_name]            dictionary files\n"
     "-T <tstamp_size>  4       QS timestamp size     (bytes)\n"
     "-O <pointer_size> 4       object pointer size   (bytes)\n"
@@ -136,7 +153,8 @@ static char const l_kbdHelpStr[] =
     "  o               toggle screen file output (close/re-open)\n"
     "  s/b             toggle binary file output (close/re-open)\n"
     "  m               toggle Matlab file output (close/re-open)\n"
-    "  g               toggle MscGen file output (close/re-open)\n";
+    "  g               toggle MscGen file output (close/re-open)\n"
+    "  y               display the statistics summary now\n";
 
 /*..........................................................................*/
 static QSpyStatus configure(int argc, char *argv[]);
@@ -152,6 +170,11 @@ int main(int argc, char *argv[]) {
     if (configure(argc, argv) != QSPY_SUCCESS) {
         status = -1;
     }
+    else if (l_link == ARC_LINK) { /* query of an archive? */
+        if (QSPY_arcQuery(l_qryFileName, l_qryFilter) != QSPY_SUCCESS) {
+            status = -1;
+        }
+    }
     else {
         size_t nBytes;
         bool isRunning = true;
@@ -196,7 +219,14 @@ int main(int argc, char *argv[]) {
                     status = -1;        /* error return */
                     break;
             }
+
+            /* time for the periodic statistics summary? */
+            if ((l_statSec > 0) && (time((time_t *)0) >= l_statTime)) {
+                QSPY_statReport(false);
+                l_statTime = time((time_t *)0) + l_statSec;
+            }
         }
+        QSPY_statReport(true); /* final statistics report, if enabled */
     }
     /* cleanup .............................................................*/
     cleanup();
@@ -234,6 +264,16 @@ void Q_onAssert(char const * const module, int loc) {
 
 /*..........................................................................*/
 void QSPY_onPrintLn(void) {
+    /* the line taken over by the PAL (parallel file decoding)? */
+    if ((PAL_vtbl.captureLn != 0) && (*PAL_vtbl.captureLn)()) {
+        QSPY_output.type = REG_OUT; /* reset for the next time */
+        return;
+    }
+    if (QSPY_arcIsQuiet()) { /* replaying state records from an archive? */
+        QSPY_output.type = REG_OUT; /* reset for the next time */
+        return;
+    }
+
     if (l_quiet < 0) {
         fputs(QSPY_line, stdout);
         fputc('\n', stdout);
@@ -276,7 +316,7 @@ void QSPY_printInfo(void) {
 /*..........................................................................*/
 static QSpyStatus configure(int argc, char *argv[]) {
     static char const getoptStr[] =
-        "hq::u::v:osmgc:b:t::p:f:d::T:O:F:S:E:Q:P:B:C:";
+        "hq::u::v:osmgax:w:y::c:b:t::p:f:j::d::T:O:F:S:E:Q:P:B:C:";
 
     /* default configuration options... */
     uint16_t version     = 620U;
@@ -296,6 +336,7 @@ static QSpyStatus configure(int argc, char *argv[]) {
     STRCPY_S(l_matFileName, sizeof(l_matFileName), "OFF");
     STRCPY_S(l_mscFileName, sizeof(l_mscFileName), "OFF");
     STRCPY_S(l_dicFileName, sizeof(l_dicFileName), "OFF");
+    STRCPY_S(l_arcFileName, sizeof(l_arcFileName), "OFF");
 
     (void)tstampStr();
     PRINTF_S(l_introStr, QSPY_VER, l_tstampStr);
@@ -367,10 +408,42 @@ static QSpyStatus configure(int argc, char *argv[]) {
                 PRINTF_S("-g (%s)\n", l_mscFileName);
                 break;
             }
+            case 'a': { /* indexed archive output */
+                SNPRINTF_S(l_arcFileName, sizeof(l_arcFileName) - 1U,
+                           "qspy%s.qsa", l_tstampStr);
+                PRINTF_S("-a (%s)\n", l_arcFileName);
+                break;
+            }
+            case 'x': { /* query of an indexed archive */
+                if (l_link != NO_LINK) {
+                    FPRINTF_S(stderr,
+                        "The -x option is incompatible with -c/-b/-t/-f\n");
+                    return QSPY_ERROR;
+                }
+                STRCPY_S(l_qryFileName, sizeof(l_qryFileName), optarg);
+                PRINTF_S("-x %s\n", l_qryFileName);
+                l_link = ARC_LINK;
+                break;
+            }
+            case 'w': { /* archive query filter */
+                STRCPY_S(l_qryFilter, sizeof(l_qryFilter), optarg);
+                PRINTF_S("-w %s\n", l_qryFilter);
+                break;
+            }
+            case 'y': { /* streaming statistics */
+                if (optarg != NULL) { /* is optional argument provided? */
+                    l_statSec = (int)strtoul(optarg, NULL, 10);
+                }
+                else { /* apply the default */
+                    l_statSec = 10;
+                }
+                PRINTF_S("-y %d\n", l_statSec);
+                break;
+            }
             case 'c': { /* COM port */
                 if ((l_link != NO_LINK) && (l_link != SERIAL_LINK)) {
                     FPRINTF_S(stderr,
-                            "The -c option is incompatible with -t/-f\n");
+                            "The -c option is incompatible with -t/-f/-x\n");
                     return QSPY_ERROR;
                 }
                 STRCPY_S(l_comPort, sizeof(l_comPort), optarg);
@@ -381,7 +454,7 @@ static QSpyStatus configure(int argc, char *argv[]) {
             case 'b': { /* baud rate */
                 if ((l_link != NO_LINK) && (l_link != SERIAL_LINK)) {
                     FPRINTF_S(stderr,
-                        "The -b option is incompatible with -t/-f\n");
+                        "The -b option is incompatible with -t/-f/-x\n");
                     return QSPY_ERROR;
                 }
                 l_baudRate = (int)strtol(optarg, NULL, 10);
@@ -396,7 +469,7 @@ static QSpyStatus configure(int argc, char *argv[]) {
             case 'f': { /* File input */
                 if (l_link != NO_LINK) {
                     FPRINTF_S(stderr,
-                            "The -f option is incompatible with -c/-b/-t\n");
+                        "The -f option is incompatible with -c/-b/-t/-x\n");
                     return QSPY_ERROR;
                 }
                 STRCPY_S(l_inpFileName, sizeof(l_inpFileName), optarg);
@@ -404,6 +477,18 @@ static QSpyStatus configure(int argc, char *argv[]) {
                 l_link = FILE_LINK;
                 break;
             }
+#ifndef _WIN32
+            case 'j': { /* parallel file decoding jobs */
+                if (optarg != NULL) { /* is optional argument provided? */
+                    l_jobs = (int)strtoul(optarg, NULL, 10);
+                }
+                else { /* apply the default (all CPUs) */
+                    l_jobs = 0;
+                }
+                PRINTF_S("-j %d\n", l_jobs);
+                break;
+            }
+#endif
             case 'd': { /* Dictionary file */
                 if (optarg != NULL) { /* is optional argument provided? */
                     STRCPY_S(l_dicFileName, sizeof(l_dicFileName), optarg);
@@ -419,7 +504,7 @@ static QSpyStatus configure(int argc, char *argv[]) {
             case 't': { /* TCP/IP input */
                 if ((l_link != NO_LINK) && (l_link != TCP_LINK)) {
                     FPRINTF_S(stderr,
-                            "The -t option is incompatible with -c/-b/-f\n");
+                        "The -t option is incompatible with -c/-b/-f/-x\n");
                     return QSPY_ERROR;
                 }
                 if (optarg != NULL) { /* is optional argument provided? */
@@ -489,6 +574,45 @@ static QSpyStatus configure(int argc, char *argv[]) {
         return QSPY_ERROR;
     }
 
+    if (l_jobs != 1) { /* parallel file decoding? */
+        if (l_link != FILE_LINK) {
+            FPRINTF_S(stderr, "The -j option requires -f\n");
+            return QSPY_ERROR;
+        }
+        if ((l_savFileName[0] != 'O')
+            || (l_matFileName[0] != 'O')
+            || (l_mscFileName[0] != 'O')
+            || (l_arcFileName[0] != 'O')
+            || (l_statSec >= 0))
+        {
+            FPRINTF_S(stderr,
+                "The -j option is incompatible with -s/-m/-g/-a/-y\n");
+            return QSPY_ERROR;
+        }
+        l_bePort = 0; /* no Front-End for parallel decoding */
+    }
+    if (l_link == ARC_LINK) { /* query of an archive? */
+        if ((l_savFileName[0] != 'O')
+            || (l_matFileName[0] != 'O')
+            || (l_mscFileName[0] != 'O')
+            || (l_arcFileName[0] != 'O')
+            || (l_statSec >= 0))
+        {
+            FPRINTF_S(stderr,
+                "The -x option is incompatible with -s/-m/-g/-a/-y\n");
+            return QSPY_ERROR;
+        }
+        l_bePort = 0; /* no Front-End for archive queries */
+    }
+    else if (l_qryFilter[0] != '\0') {
+        FPRINTF_S(stderr, "The -w option requires -x\n");
+        return QSPY_ERROR;
+    }
+    if (l_statSec >= 0) { /* streaming statistics? */
+        QSPY_statOn();
+        l_statTime = time((time_t *)0) + l_statSec;
+    }
+
     /* configure QSPY ......................................................*/
     /* open Back-End link. NOTE: must happen *before* opening Target link */
     if (l_bePort != 0) {
@@ -516,11 +640,24 @@ static QSpyStatus configure(int argc, char *argv[]) {
             break;
         }
         case FILE_LINK: {   /* input QS data from a file */
+#ifndef _WIN32
+            if (l_jobs != 1) { /* parallel decoding of the file? */
+                if (PAL_openTargetFileJobs(l_inpFileName, l_jobs)
+                    != QSPY_SUCCESS)
+                {
+                    return QSPY_ERROR;
+                }
+                break;
+            }
+#endif
             if (PAL_openTargetFile(l_inpFileName) != QSPY_SUCCESS) {
                 return QSPY_ERROR;
             }
             break;
         }
+        case ARC_LINK: {    /* records from an archive, see main() */
+            break;
+        }
     }
 
     /* open files specified on the command line... */
@@ -555,6 +692,12 @@ static QSpyStatus configure(int argc, char *argv[]) {
             return QSPY_ERROR;
         }
     }
+    if (l_arcFileName[0] != 'O') { /* "OFF" ? */
+        if (QSPY_arcOpen(l_arcFileName) != QSPY_SUCCESS) {
+            PRINTF_S("   <QSPY-> Cannot open File=%s\n", l_arcFileName);
+            return QSPY_ERROR;
+        }
+    }
     QSPY_config(version,
                 objPtrSize,
                 funPtrSize,
@@ -604,6 +747,13 @@ bool QSPY_command(uint8_t cmdId) {
             PRINTF_S("Binary Output [s]: %s\n", l_savFileName);
             PRINTF_S("Matlab Output [m]: %s\n", l_matFileName);
             PRINTF_S("MscGen Output [g]: %s\n", l_mscFileName);
+            PRINTF_S("Archive Output   : %s\n", l_arcFileName);
+            if (l_statSec < 0) {
+                PRINTF_S("Statistics    [y]: OFF\n");
+            }
+            else {
+                PRINTF_S("Statistics    [y]: every %d s\n", l_statSec);
+            }
             break;
 
         case 'r':  /* send RESET command to the Target */
@@ -744,6 +894,15 @@ bool QSPY_command(uint8_t cmdId) {
                    l_mscFileName);
             break;
 
+        case 'y':  /* statistics summary */
+            if (l_statSec >= 0) {
+                QSPY_statReport(false);
+            }
+            else {
+                PRINTF_S("   <USER-> Statistics [y] not enabled (-y)\n");
+            }
+            break;
+
         case 'x':
         case 'X':
         case '\033': /* Esc */
@@ -42,6 +42,9 @@
 #include <stdlib.h>
 #include <time.h>
 #include <inttypes.h>
+#ifdef __SSE2__
+#include <emmintrin.h> /* SSE2 intrinsics for the QS frame decoder */
+#endif
 
 #include "safe_std.h" /* "safe" <stdio.h> and <string.h> facilities */
 #include "qspy.h"     /* QSPY data parser */
@@ -83,10 +86,15 @@ typedef struct {
     int        capacity;
     int        entries;
     int        keySize;
+    int       *keyHash;  /* hash index key->entry (entry index + 1) */
+    int       *nameHash; /* hash index name->entry (entry index + 1) */
+    int        hashMask; /* size of the hash indexes - 1 */
+    int        nameUsed; /* used slots in the name index (incl. stale) */
 } Dictionary;
 
 static void Dictionary_ctor(Dictionary * const me,
-                            DictEntry *sto, uint32_t capacity);
+                            DictEntry *sto, uint32_t capacity,
+                            int *keyHash, int *nameHash, uint32_t hashSize);
 static void Dictionary_config(Dictionary * const me, int keySize);
 static char const *Dictionary_at(Dictionary * const me, unsigned idx);
 static void Dictionary_put(Dictionary * const me,
@@ -96,7 +104,8 @@ static char const *Dictionary_get(Dictionary * const me,
 static int Dictionary_find(Dictionary * const me, KeyType key);
 static KeyType Dictionary_findKey(Dictionary * const me, char const *name);
 static void Dictionary_reset(Dictionary * const me);
-static void Dictionary_write(Dictionary const * const me, FILE *stream);
+static void Dictionary_sort(Dictionary * const me);
+static void Dictionary_write(Dictionary * const me, FILE *stream);
 static bool Dictionary_read(Dictionary * const me, FILE *stream);
 
 static char const *getMatDict(char const *s);
@@ -115,10 +124,15 @@ typedef struct SigDictionaryTag {
     int           capacity;
     int           entries;
     int           ptrSize;
+    int          *sigHash;  /* hash index sig->entry (entry index + 1) */
+    int          *nameHash; /* hash index name->entry (entry index + 1) */
+    int           hashMask; /* size of the hash indexes - 1 */
+    int           nameUsed; /* used slots in the name index (incl. stale) */
 } SigDictionary;
 
 static void SigDictionary_ctor(SigDictionary * const me,
-                        SigDictEntry *sto, uint32_t capacity);
+                        SigDictEntry *sto, uint32_t capacity,
+                        int *sigHash, int *nameHash, uint32_t hashSize);
 static void SigDictionary_config(SigDictionary * const me, int ptrSize);
 static void SigDictionary_put(SigDictionary * const me,
                         SigType sig, ObjType obj, char const *name);
@@ -126,18 +140,29 @@ static char const *SigDictionary_get(SigDictionary * const me,
                         SigType sig, ObjType obj, char *buf);
 static int SigDictionary_find(SigDictionary * const me,
                               SigType sig, ObjType obj);
+static int SigDictionary_findEntry(SigDictionary * const me,
+                                   SigType sig, ObjType obj);
 static SigType SigDictionary_findSig(SigDictionary * const me,
                                      char const *name, ObjType obj);
 static void SigDictionary_reset(SigDictionary * const me);
-static void SigDictionary_write(SigDictionary const * const me, FILE *stream);
+static void SigDictionary_sort(SigDictionary * const me);
+static void SigDictionary_write(SigDictionary * const me, FILE *stream);
 static bool SigDictionary_read(SigDictionary * const me, FILE *stream);
 
 /*..........................................................................*/
-static DictEntry     l_funSto[512];
-static DictEntry     l_objSto[256];
+/* hash indexes of the dictionaries must have a power-of-2 size of at least
+* twice the capacity of the dictionary
+*/
+static DictEntry     l_funSto[8192];
+static int           l_funHash[2][16384];
+static DictEntry     l_objSto[8192];
+static int           l_objHash[2][16384];
 static DictEntry     l_mscSto[64];
+static int           l_mscHash[2][128];
 static DictEntry     l_usrSto[128 + 1 - OLD_QS_USER];
-static SigDictEntry  l_sigSto[512];
+static int           l_usrHash[2][128];
+static SigDictEntry  l_sigSto[8192];
+static int           l_sigHash[2][16384];
 static Dictionary    l_funDict;
 static Dictionary    l_objDict;
 static Dictionary    l_mscDict;
@@ -152,6 +177,7 @@ static FILE         *l_mscFile;
 static uint32_t      l_userRec;
 static QSPY_CustParseFun l_custParseFun;
 static QSPY_resetFun     l_txResetFun;
+static QSpyRecKeys   l_keys;  /* index keys of the current record */
 
 /* QS record names... NOTE: keep in synch with qs_copy.h */
 static char const *  l_qs_rec[] = {
@@ -182,7 +208,7 @@ static char const *  l_qs_rec[] = {
     "QS_QF_EQUEUE_POST_LIFO",
     "QS_QF_EQUEUE_GET",
     "QS_QF_EQUEUE_GET_LAST",
-    "QS_QF_RESERVED2",
+    "QS_QF_ACTIVE_POST_MERGE",
     "QS_QF_MPOOL_GET",
     "QS_QF_MPOOL_PUT",
     "QS_QF_PUBLISH",
@@ -234,10 +260,12 @@ static char const *  l_qs_rec[] = {
     "QS_RX_STATUS",
     "QS_QUERY_DATA",
     "QS_PEEK_DATA",
-    "QS_ASSERT_FAIL"
+    "QS_ASSERT_FAIL",
+
+    /* [70] Additional QF records */
+    "QS_QF_TICK_STAT",
 
-    /* [70] Reserved QS records */
-    "QS_RESERVED_70",
+    /* [71] Reserved QS records */
     "QS_RESERVED_71",
     "QS_RESERVED_72",
     "QS_RESERVED_73",
@@ -270,6 +298,9 @@ static char const *  l_qs_rec[] = {
 
     /* [100] Application-specific (User) QS records */
 };
+/* compile-time check that l_qs_rec[] names exactly the standard records */
+typedef char l_qs_rec_check[(sizeof(l_qs_rec)/sizeof(l_qs_rec[0])
+                             == (size_t)QS_USER) ? 1 : -1];
 
 /* QS object kinds... NOTE: keep in synch with qs_copy.h */
 static char const *  l_qs_obj[] = {
@@ -308,6 +339,14 @@ static char const *  l_qs_rx_rec[] = {
         FPRINTF_S(l_matFile, format_, ##__VA_ARGS__); \
     } else (void)0
 
+/* remember the index keys of the current record for the archive */
+#define REC_KEYS(flags_, t_, obj_, sig_) do { \
+    l_keys.flags  = (uint8_t)(flags_); \
+    l_keys.tstamp = (t_); \
+    l_keys.obj    = (obj_); \
+    l_keys.sig    = (SigType)(sig_); \
+} while (0)
+
 #define CONFIG_UPDATE(member_, new_, diff_) \
     if (l_config.member_ != (new_)) { \
         l_config.member_ =  (new_); \
@@ -359,15 +398,25 @@ void QSPY_config(uint16_t version,
     }
 
     Dictionary_ctor(&l_funDict, l_funSto,
-                    sizeof(l_funSto)/sizeof(l_funSto[0]));
+                    sizeof(l_funSto)/sizeof(l_funSto[0]),
+                    l_funHash[0], l_funHash[1],
+                    sizeof(l_funHash[0])/sizeof(l_funHash[0][0]));
     Dictionary_ctor(&l_objDict, l_objSto,
-                    sizeof(l_objSto)/sizeof(l_objSto[0]));
+                    sizeof(l_objSto)/sizeof(l_objSto[0]),
+                    l_objHash[0], l_objHash[1],
+                    sizeof(l_objHash[0])/sizeof(l_objHash[0][0]));
     Dictionary_ctor(&l_mscDict, l_mscSto,
-                    sizeof(l_mscSto)/sizeof(l_mscSto[0]));
+                    sizeof(l_mscSto)/sizeof(l_mscSto[0]),
+                    l_mscHash[0], l_mscHash[1],
+                    sizeof(l_mscHash[0])/sizeof(l_mscHash[0][0]));
     Dictionary_ctor(&l_usrDict, l_usrSto,
-                    sizeof(l_usrSto)/sizeof(l_usrSto[0]));
+                    sizeof(l_usrSto)/sizeof(l_usrSto[0]),
+                    l_usrHash[0], l_usrHash[1],
+                    sizeof(l_usrHash[0])/sizeof(l_usrHash[0][0]));
     SigDictionary_ctor(&l_sigDict, l_sigSto,
-                       sizeof(l_sigSto)/sizeof(l_sigSto[0]));
+                       sizeof(l_sigSto)/sizeof(l_sigSto[0]),
+                       l_sigHash[0], l_sigHash[1],
+                       sizeof(l_sigHash[0])/sizeof(l_sigHash[0][0]));
     Dictionary_config(&l_funDict, l_config.funPtrSize);
     Dictionary_config(&l_objDict, l_config.objPtrSize);
     Dictionary_config(&l_usrDict, 1);
@@ -408,6 +457,7 @@ void QSPY_configMscFile(void *mscFile) {
         FPRINTF_S(l_mscFile, "}\n");
         rewind(l_mscFile);
         FPRINTF_S(l_mscFile, "msc {\n");
+        Dictionary_sort(&l_mscDict); /* list the entities by the key */
         for (i = 0; ; ++i) {
             char const *entry = Dictionary_at(&l_mscDict, i);
             if (entry[0] != '\0') {
@@ -748,6 +798,7 @@ static void QSpyRecord_processUser(QSpyRecord * const me) {
     };
 
     u32 = QSpyRecord_getUint32(me, l_config.tstampSize);
+    REC_KEYS(QSPY_KEY_TSTAMP, u32, 0U, 0U);
     i32 = Dictionary_find(&l_usrDict, me->rec);
     if (i32 >= 0) {
         SNPRINTF_LINE("%010u %s", u32, Dictionary_at(&l_usrDict, i32));
@@ -932,6 +983,7 @@ static void QSpyRecord_process(QSpyRecord * const me) {
             p = QSpyRecord_getUint64(me, l_config.objPtrSize);
             q = QSpyRecord_getUint64(me, l_config.funPtrSize);
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_OBJ, 0U, p, 0U);
                 SNPRINTF_LINE("===RTC===> %s Obj=%s,State=%s",
                        s,
                        Dictionary_get(&l_objDict, p, (char *)0),
@@ -957,6 +1009,7 @@ static void QSpyRecord_process(QSpyRecord * const me) {
             q = QSpyRecord_getUint64(me, l_config.funPtrSize);
             r = QSpyRecord_getUint64(me, l_config.funPtrSize);
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_OBJ, 0U, p, 0U);
                 SNPRINTF_LINE("===RTC===> %s Obj=%s,State=%s->%s",
                        s,
                        Dictionary_get(&l_objDict, p, (char *)0),
@@ -973,6 +1026,7 @@ static void QSpyRecord_process(QSpyRecord * const me) {
             p = QSpyRecord_getUint64(me, l_config.objPtrSize);
             q = QSpyRecord_getUint64(me, l_config.funPtrSize);
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_TSTAMP | QSPY_KEY_OBJ, t, p, 0U);
                 SNPRINTF_LINE("%010u Init===> Obj=%s,State=%s",
                        t,
                        Dictionary_get(&l_objDict, p, (char *)0),
@@ -989,6 +1043,9 @@ static void QSpyRecord_process(QSpyRecord * const me) {
             p = QSpyRecord_getUint64(me, l_config.objPtrSize);
             q = QSpyRecord_getUint64(me, l_config.funPtrSize);
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_TSTAMP | QSPY_KEY_OBJ | QSPY_KEY_SIG,
+                         t, p, a);
+                QSPY_statRtc(t, p, false);
                 SNPRINTF_LINE("%010u =>Intern Obj=%s,Sig=%s,State=%s",
                        t,
                        Dictionary_get(&l_objDict, p, (char *)0),
@@ -1008,6 +1065,9 @@ static void QSpyRecord_process(QSpyRecord * const me) {
             q = QSpyRecord_getUint64(me, l_config.funPtrSize);
             r = QSpyRecord_getUint64(me, l_config.funPtrSize);
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_TSTAMP | QSPY_KEY_OBJ | QSPY_KEY_SIG,
+                         t, p, a);
+                QSPY_statRtc(t, p, false);
                 SNPRINTF_LINE("%010u ===>Tran "
                        "Obj=%s,Sig=%s,State=%s->%s",
                        t,
@@ -1036,6 +1096,9 @@ static void QSpyRecord_process(QSpyRecord * const me) {
             p = QSpyRecord_getUint64(me, l_config.objPtrSize);
             q = QSpyRecord_getUint64(me, l_config.funPtrSize);
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_TSTAMP | QSPY_KEY_OBJ | QSPY_KEY_SIG,
+                         t, p, a);
+                QSPY_statRtc(t, p, false);
                 SNPRINTF_LINE("%010u =>Ignore Obj=%s,Sig=%s,State=%s",
                        t,
                        Dictionary_get(&l_objDict, p, (char *)0),
@@ -1053,6 +1116,9 @@ static void QSpyRecord_process(QSpyRecord * const me) {
             p = QSpyRecord_getUint64(me, l_config.objPtrSize);
             q = QSpyRecord_getUint64(me, l_config.funPtrSize);
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_TSTAMP | QSPY_KEY_OBJ | QSPY_KEY_SIG,
+                         t, p, a);
+                QSPY_statRtc(t, p, true);
                 SNPRINTF_LINE("%010u Disp===> Obj=%s,Sig=%s,State=%s",
                        t,
                        Dictionary_get(&l_objDict, p, (char *)0),
@@ -1069,6 +1135,7 @@ static void QSpyRecord_process(QSpyRecord * const me) {
             p = QSpyRecord_getUint64(me, l_config.objPtrSize);
             q = QSpyRecord_getUint64(me, l_config.funPtrSize);
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_OBJ | QSPY_KEY_SIG, 0U, p, a);
                 SNPRINTF_LINE("===RTC===> St-Unhnd Obj=%s,Sig=%s,State=%s",
                        Dictionary_get(&l_objDict, p, (char *)0),
                        SigDictionary_get(&l_sigDict, a, p, (char *)0),
@@ -1099,6 +1166,8 @@ static void QSpyRecord_process(QSpyRecord * const me) {
                 b = QSpyRecord_getUint32(me, 1);
                 c = QSpyRecord_getUint32(me, 1);
                 if (QSpyRecord_OK(me)) {
+                    REC_KEYS(QSPY_KEY_TSTAMP | QSPY_KEY_OBJ | QSPY_KEY_SIG,
+                             t, p, a);
                     SNPRINTF_LINE("%010u AO-%s Obj=%s,Que=%s,"
                                   "Evt<Sig=%s,Pool=%u,Ref=%u>",
                            t,
@@ -1119,6 +1188,7 @@ static void QSpyRecord_process(QSpyRecord * const me) {
                 p = QSpyRecord_getUint64(me, l_config.objPtrSize);
                 a = QSpyRecord_getUint32(me, 1);
                 if (QSpyRecord_OK(me)) {
+                    REC_KEYS(QSPY_KEY_TSTAMP | QSPY_KEY_OBJ, t, p, 0U);
                     SNPRINTF_LINE("%010u AO-%s Obj=%s,Pri=%u",
                            t,
                            s,
@@ -1137,6 +1207,7 @@ static void QSpyRecord_process(QSpyRecord * const me) {
                 p = QSpyRecord_getUint64(me, l_config.objPtrSize);
                 q = QSpyRecord_getUint64(me, l_config.objPtrSize);
                 if (QSpyRecord_OK(me)) {
+                    REC_KEYS(QSPY_KEY_TSTAMP | QSPY_KEY_OBJ, t, p, 0U);
                     SNPRINTF_LINE("%010u AO-RCllA Obj=%s,Que=%s",
                            t,
                            Dictionary_get(&l_objDict, p, (char *)0),
@@ -1150,6 +1221,7 @@ static void QSpyRecord_process(QSpyRecord * const me) {
                 p = QSpyRecord_getUint64(me, l_config.objPtrSize);
                 b = QSpyRecord_getUint32(me, l_config.queueCtrSize);
                 if (QSpyRecord_OK(me)) {
+                    REC_KEYS(QSPY_KEY_OBJ, 0U, p, 0U);
                     SNPRINTF_LINE("           EQ-Init  Obj=%s,Len=%u",
                            Dictionary_get(&l_objDict, p, (char *)0),
                            b);
@@ -1170,6 +1242,8 @@ static void QSpyRecord_process(QSpyRecord * const me) {
             a = QSpyRecord_getUint32(me, l_config.sigSize);
             p = QSpyRecord_getUint64(me, l_config.objPtrSize);
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_TSTAMP | QSPY_KEY_OBJ | QSPY_KEY_SIG,
+                         t, p, a);
                 SNPRINTF_LINE("%010u AO-%s Obj=%s,Sig=%s",
                        t,
                        s,
@@ -1207,6 +1281,11 @@ static void QSpyRecord_process(QSpyRecord * const me) {
             d = QSpyRecord_getUint32(me, l_config.queueCtrSize);
             e = QSpyRecord_getUint32(me, l_config.queueCtrSize);
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_TSTAMP | QSPY_KEY_OBJ | QSPY_KEY_SIG,
+                         t, p, a);
+                if (me->rec == QS_QF_ACTIVE_POST) {
+                    QSPY_statPost(t, p, d, e, false);
+                }
                 SNPRINTF_LINE("%010u AO-%s Sdr=%s,Obj=%s,"
                        "Evt<Sig=%s,Pool=%u,Ref=%u>,"
                        "Que<Free=%u,%s=%u>",
@@ -1256,6 +1335,9 @@ static void QSpyRecord_process(QSpyRecord * const me) {
             d = QSpyRecord_getUint32(me, l_config.queueCtrSize);
             e = QSpyRecord_getUint32(me, l_config.queueCtrSize);
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_TSTAMP | QSPY_KEY_OBJ | QSPY_KEY_SIG,
+                         t, p, a);
+                QSPY_statPost(t, p, d, e, true);
                 SNPRINTF_LINE("%010u AO-LIFO  Obj=%s,"
                        "Evt<Sig=%s,Pool=%u,Ref=%u>,"
                        "Que<Free=%u,Min=%u>",
@@ -1300,6 +1382,11 @@ static void QSpyRecord_process(QSpyRecord * const me) {
             }
             d = QSpyRecord_getUint32(me, l_config.queueCtrSize);
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_TSTAMP | QSPY_KEY_OBJ | QSPY_KEY_SIG,
+                         t, p, a);
+                if (me->rec == QS_QF_ACTIVE_GET) {
+                    QSPY_statGet(t, p, d, false);
+                }
                 SNPRINTF_LINE("%010u %s Obj=%s,Evt<Sig=%s,Pool=%u,Ref=%u>,"
                        "Que<Free=%u>",
                        t,
@@ -1331,6 +1418,11 @@ static void QSpyRecord_process(QSpyRecord * const me) {
                 b >>= 6;
             }
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_TSTAMP | QSPY_KEY_OBJ | QSPY_KEY_SIG,
+                         t, p, a);
+                if (me->rec == QS_QF_ACTIVE_GET_LAST) {
+                    QSPY_statGet(t, p, 0U, true);
+                }
                 SNPRINTF_LINE("%010u %s Obj=%s,Evt<Sig=%s,Pool=%u,Ref=%u>",
                        t,
                        s,
@@ -1370,6 +1462,8 @@ static void QSpyRecord_process(QSpyRecord * const me) {
             d = QSpyRecord_getUint32(me, l_config.queueCtrSize);
             e = QSpyRecord_getUint32(me, l_config.queueCtrSize);
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_TSTAMP | QSPY_KEY_OBJ | QSPY_KEY_SIG,
+                         t, p, a);
                 SNPRINTF_LINE("%010u EQ-%s Obj=%s,"
                        "Evt<Sig=%s,Pool=%u,Ref=%u>,"
                        "Que<Free=%u,%s=%u>",
@@ -1387,16 +1481,33 @@ static void QSpyRecord_process(QSpyRecord * const me) {
             }
             break;
         }
-        case QS_QF_RESERVED2: {
+        case QS_QF_ACTIVE_POST_MERGE: {
             if (l_config.version >= 620U) {
-                SNPRINTF_LINE("           Unknown Rec=%d,Len=%d",
-                       (int)me->rec, (int)me->len);
-                QSPY_onPrintLn();
+                t = QSpyRecord_getUint32(me, l_config.tstampSize);
+                q = QSpyRecord_getUint64(me, l_config.objPtrSize);
+                a = QSpyRecord_getUint32(me, l_config.sigSize);
+                p = QSpyRecord_getUint64(me, l_config.objPtrSize);
+                b = QSpyRecord_getUint32(me, 2);
+                if (QSpyRecord_OK(me)) {
+                    REC_KEYS(QSPY_KEY_TSTAMP | QSPY_KEY_OBJ | QSPY_KEY_SIG,
+                             t, p, a);
+                    SNPRINTF_LINE("%010u AO-Merge Sdr=%s,Obj=%s,"
+                           "Evt<Sig=%s>,Merged=%u",
+                           t,
+                           Dictionary_get(&l_objDict, q, (char *)0),
+                           Dictionary_get(&l_objDict, p, buf),
+                           SigDictionary_get(&l_sigDict, a, p, (char *)0),
+                           b);
+                    QSPY_onPrintLn();
+                    FPRINF_MATFILE("%d %u %"PRId64" %u %"PRId64" %u\n",
+                                   (int)me->rec, t, q, a, p, b);
+                }
             }
             else { /* former QS_QF_MPOOL_INIT */
                 p = QSpyRecord_getUint64(me, l_config.objPtrSize);
                 b = QSpyRecord_getUint32(me, l_config.poolCtrSize);
                 if (QSpyRecord_OK(me)) {
+                    REC_KEYS(QSPY_KEY_OBJ, 0U, p, 0U);
                     SNPRINTF_LINE("           MP-Init  Obj=%s,Blcks=%u",
                            Dictionary_get(&l_objDict, p, (char *)0),
                            b);
@@ -1419,6 +1530,10 @@ static void QSpyRecord_process(QSpyRecord * const me) {
             b = QSpyRecord_getUint32(me, l_config.poolCtrSize);
             c = QSpyRecord_getUint32(me, l_config.poolCtrSize);
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_TSTAMP | QSPY_KEY_OBJ, t, p, 0U);
+                if (me->rec == QS_QF_MPOOL_GET) {
+                    QSPY_statPool(p, b, c, true);
+                }
                 SNPRINTF_LINE("%010u MP-%s Obj=%s,Free=%u,%s=%u",
                        t,
                        s,
@@ -1437,6 +1552,8 @@ static void QSpyRecord_process(QSpyRecord * const me) {
             p = QSpyRecord_getUint64(me, l_config.objPtrSize);
             b = QSpyRecord_getUint32(me, l_config.poolCtrSize);
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_TSTAMP | QSPY_KEY_OBJ, t, p, 0U);
+                QSPY_statPool(p, b, 0U, false);
                 SNPRINTF_LINE("%010u MP-Put   Obj=%s,Free=%u",
                        t,
                        Dictionary_get(&l_objDict, p, (char *)0),
@@ -1465,6 +1582,7 @@ static void QSpyRecord_process(QSpyRecord * const me) {
                 b >>= 6;
             }
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_TSTAMP | QSPY_KEY_SIG, t, 0U, a);
                 SNPRINTF_LINE("%010u QF-Pub   Sdr=%s,"
                        "Evt<Sig=%s,Pool=%u,Ref=%u>",
                        t,
@@ -1497,6 +1615,7 @@ static void QSpyRecord_process(QSpyRecord * const me) {
             b = QSpyRecord_getUint32(me, 1);
             c = QSpyRecord_getUint32(me, 1);
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_TSTAMP | QSPY_KEY_SIG, t, 0U, a);
                 SNPRINTF_LINE("%010u QF-NewRf Evt<Sig=%s,Pool=%u,Ref=%u>",
                        t,
                        SigDictionary_get(&l_sigDict, a, 0, (char *)0),
@@ -1513,6 +1632,7 @@ static void QSpyRecord_process(QSpyRecord * const me) {
             a = QSpyRecord_getUint32(me, l_config.evtSize);
             c = QSpyRecord_getUint32(me, l_config.sigSize);
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_TSTAMP | QSPY_KEY_SIG, t, 0U, c);
                 SNPRINTF_LINE("%010u QF-New   Sig=%s,Size=%u",
                        t,
                        SigDictionary_get(&l_sigDict, c, 0, (char *)0),
@@ -1531,6 +1651,7 @@ static void QSpyRecord_process(QSpyRecord * const me) {
                 b = QSpyRecord_getUint32(me, 1);
                 c = QSpyRecord_getUint32(me, 1);
                 if (QSpyRecord_OK(me)) {
+                    REC_KEYS(QSPY_KEY_TSTAMP | QSPY_KEY_SIG, t, 0U, a);
                     SNPRINTF_LINE("%010u QF-DelRf Evt<Sig=%s,Pool=%u,Ref=%u>",
                            t,
                            SigDictionary_get(&l_sigDict, a, 0, (char *)0),
@@ -1553,6 +1674,7 @@ static void QSpyRecord_process(QSpyRecord * const me) {
                     b = 0U;
                 }
                 if (QSpyRecord_OK(me)) {
+                    REC_KEYS(QSPY_KEY_TSTAMP | QSPY_KEY_OBJ, t, p, 0U);
                     SNPRINTF_LINE("%010u TE%1u-Ctr  Obj=%s,AO=%s,"
                            "Tim=%u,Int=%u",
                            t,
@@ -1585,6 +1707,7 @@ static void QSpyRecord_process(QSpyRecord * const me) {
                 b >>= 6;
             }
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_TSTAMP | QSPY_KEY_SIG, t, 0U, a);
                 SNPRINTF_LINE("%010u %s Evt<Sig=%s,Pool=%d,Ref=%d>",
                        t,
                        s,
@@ -1620,6 +1743,25 @@ static void QSpyRecord_process(QSpyRecord * const me) {
             }
             break;
         }
+        case QS_QF_TICK_STAT: {
+            t = QSpyRecord_getUint32(me, l_config.tstampSize);
+            b = QSpyRecord_getUint32(me, 1);
+            a = QSpyRecord_getUint32(me, 4);
+            c = QSpyRecord_getUint32(me, 4);
+            d = QSpyRecord_getUint32(me, 4);
+            e = QSpyRecord_getUint32(me, 4);
+            p = QSpyRecord_getUint64(me, 4);
+            if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_TSTAMP, t, 0U, 0U);
+                SNPRINTF_LINE("%010u Tick<%1u> Stat Ticks=%u,Ovr=%u,"
+                       "MaxLate=%u,MaxBusy=%u,AvgBusy=%"PRId64,
+                       t, b, a, c, d, e, p);
+                QSPY_onPrintLn();
+                FPRINF_MATFILE("%d %u %u %u %u %u %u %"PRId64"\n",
+                               (int)me->rec, t, b, a, c, d, e, p);
+            }
+            break;
+        }
         case QS_QF_TIMEEVT_ARM:
             s = "Arm ";
             /* fall through */
@@ -1637,6 +1779,7 @@ static void QSpyRecord_process(QSpyRecord * const me) {
                 b = 0U;
             }
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_TSTAMP | QSPY_KEY_OBJ, t, p, 0U);
                 SNPRINTF_LINE("%010u TE%1u-%s Obj=%s,AO=%s,Tim=%u,Int=%u",
                        t,
                        b,
@@ -1660,6 +1803,7 @@ static void QSpyRecord_process(QSpyRecord * const me) {
                 b = 0U;
             }
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_OBJ, 0U, p, 0U);
                 SNPRINTF_LINE("           TE%1u-ADis Obj=%s,AO=%s",
                        b,
                        Dictionary_get(&l_objDict, p, (char *)0),
@@ -1681,6 +1825,7 @@ static void QSpyRecord_process(QSpyRecord * const me) {
                 b = 0U;
             }
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_TSTAMP | QSPY_KEY_OBJ, t, p, 0U);
                 SNPRINTF_LINE("%010u TE%1u-DisA Obj=%s,AO=%s",
                        t,
                        b,
@@ -1706,6 +1851,7 @@ static void QSpyRecord_process(QSpyRecord * const me) {
                 b = 0U;
             }
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_TSTAMP | QSPY_KEY_OBJ, t, p, 0U);
                 SNPRINTF_LINE("%010u TE%1u-Rarm Obj=%s,AO=%s,"
                        "Tim=%u,Int=%u,Was=%1u",
                        t,
@@ -1731,6 +1877,8 @@ static void QSpyRecord_process(QSpyRecord * const me) {
                 b = 0U;
             }
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_TSTAMP | QSPY_KEY_OBJ | QSPY_KEY_SIG,
+                         t, p, a);
                 SNPRINTF_LINE("%010u TE%1u-Post Obj=%s,Sig=%s,AO=%s",
                        t,
                        b,
@@ -1751,6 +1899,7 @@ static void QSpyRecord_process(QSpyRecord * const me) {
             t = QSpyRecord_getUint32(me, l_config.tstampSize);
             a = QSpyRecord_getUint32(me, 1);
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_TSTAMP, t, 0U, 0U);
                 SNPRINTF_LINE("%010u %s Nest=%d",
                        t,
                        s,
@@ -1770,6 +1919,7 @@ static void QSpyRecord_process(QSpyRecord * const me) {
             a = QSpyRecord_getUint32(me, 1);
             b = QSpyRecord_getUint32(me, 1);
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_TSTAMP, t, 0U, 0U);
                 SNPRINTF_LINE("%010u %s  Nest=%u,Pri=%u",
                        t,
                        s,
@@ -1791,6 +1941,7 @@ static void QSpyRecord_process(QSpyRecord * const me) {
             a = QSpyRecord_getUint32(me, 1);
             b = QSpyRecord_getUint32(me, 1);
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_TSTAMP, t, 0U, 0U);
                 SNPRINTF_LINE("%010u %s Ceil=%u->%u",
                        t,
                        s,
@@ -1806,6 +1957,7 @@ static void QSpyRecord_process(QSpyRecord * const me) {
             a = QSpyRecord_getUint32(me, 1);
             b = QSpyRecord_getUint32(me, 1);
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_TSTAMP, t, 0U, 0U);
                 SNPRINTF_LINE("%010u Sch-Next Pri=%u->%u",
                        t, b, a);
                 QSPY_onPrintLn();
@@ -1818,6 +1970,7 @@ static void QSpyRecord_process(QSpyRecord * const me) {
             t = QSpyRecord_getUint32(me, l_config.tstampSize);
             a = QSpyRecord_getUint32(me, 1);
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_TSTAMP, t, 0U, 0U);
                 SNPRINTF_LINE("%010u Sch-Idle Pri=%u->0",
                        t, a);
                 QSPY_onPrintLn();
@@ -1831,6 +1984,7 @@ static void QSpyRecord_process(QSpyRecord * const me) {
             a = QSpyRecord_getUint32(me, 1);
             b = QSpyRecord_getUint32(me, 1);
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_TSTAMP, t, 0U, 0U);
                 SNPRINTF_LINE("%010u Sch-Rsme Prio=%u->%u",
                        t, b, a);
                 QSPY_onPrintLn();
@@ -1848,6 +2002,7 @@ static void QSpyRecord_process(QSpyRecord * const me) {
             a = QSpyRecord_getUint32(me, 1);
             b = QSpyRecord_getUint32(me, 1);
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_TSTAMP, t, 0U, 0U);
                 SNPRINTF_LINE("%010u %s Pro=%u,Ceil=%u",
                        t,
                        s,
@@ -1873,6 +2028,7 @@ static void QSpyRecord_process(QSpyRecord * const me) {
             q = QSpyRecord_getUint64(me, l_config.funPtrSize);
             a = QSpyRecord_getUint32(me, 4U);
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_TSTAMP, t, 0U, 0U);
                 SNPRINTF_LINE("%010u TstProbe Fun=%s,Data=%d",
                               t, Dictionary_get(&l_funDict, q, (char *)0), a);
                 QSPY_onPrintLn();
@@ -2020,6 +2176,8 @@ static void QSpyRecord_process(QSpyRecord * const me) {
 
                     /* always reset dictionaries upon target reset */
                     resetAllDictionaries();
+                    QSPY_statReset();
+                    REC_KEYS(QSPY_KEY_RESET, 0U, 0U, 0U); /* new epoch */
 
                     /* reset the QSPY-Tx channel, if available */
                     if (l_txResetFun != (QSPY_resetFun)0) {
@@ -2040,6 +2198,7 @@ static void QSpyRecord_process(QSpyRecord * const me) {
             t = QSpyRecord_getUint32(me, l_config.tstampSize);
             a = QSpyRecord_getUint32(me, 1U);
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_TSTAMP, t, 0U, 0U);
                 if (a < sizeof(l_qs_rx_rec)/sizeof(l_qs_rx_rec[0])) {
                     SNPRINTF_LINE("%010u Trg-Done %s",
                                  t, l_qs_rx_rec[a]);
@@ -2123,6 +2282,7 @@ static void QSpyRecord_process(QSpyRecord * const me) {
                     break;
             }
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_TSTAMP | QSPY_KEY_OBJ, t, p, 0U);
                 SNPRINTF_LINE("%010u Query-%s Obj=%s",
                        t,
                        l_qs_obj[a],
@@ -2168,6 +2328,7 @@ static void QSpyRecord_process(QSpyRecord * const me) {
             b = QSpyRecord_getUint32(me, 1);  /* data size */
             w = (char const *)QSpyRecord_getMem(me, (uint8_t)b, &c);
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_TSTAMP, t, 0U, 0U);
                 SNPRINTF_LINE("%010u Trg-Peek Offs=%d,Size=%d,Num=%d,Data=<",
                               t, a, b, c);
                 for (; c > 1U; --c, w += b) {
@@ -2206,6 +2367,7 @@ static void QSpyRecord_process(QSpyRecord * const me) {
             a = QSpyRecord_getUint32(me, 2);
             s = QSpyRecord_getStr(me);
             if (QSpyRecord_OK(me)) {
+                REC_KEYS(QSPY_KEY_TSTAMP, t, 0U, 0U);
                 SNPRINTF_LINE("%010u =ASSERT= Mod=%s,Loc=%u",
                        t, s, a);
                 QSPY_onPrintLn();
@@ -2233,6 +2395,7 @@ static void QSpyRecord_process(QSpyRecord * const me) {
 void QSPY_stop(void) {
     QSPY_configMatFile((void *)0);
     QSPY_configMscFile((void *)0);
+    QSPY_arcClose();
 }
 /*..........................................................................*/
 void QSPY_printError(void) {
@@ -2246,6 +2409,7 @@ static uint8_t *l_pos   = l_record; /* position within the record */
 static uint8_t l_chksum = 0U;
 static uint8_t l_esc    = 0U;
 static uint8_t l_seq    = 0U;
+static bool    l_stateOnly = false; /* process only the state records? */
 
 /*..........................................................................*/
 void QSPY_reset(void) {
@@ -2255,11 +2419,96 @@ void QSPY_reset(void) {
     l_seq    = 0U;
 }
 /*..........................................................................*/
+/* records that change the state of the parser (target configuration and
+* dictionaries) and thus must be seen by all the records that follow them
+*/
+bool QSPY_isStateRec(uint8_t rec) {
+    switch (rec) {
+        case QS_EMPTY:
+        case QS_TARGET_INFO:
+        case QS_SIG_DICT:
+        case QS_OBJ_DICT:
+        case QS_FUN_DICT:
+        case QS_USR_DICT:
+            return true;
+        default:
+            return false;
+    }
+}
+/*..........................................................................*/
+/* copy the run of plain bytes (neither QS_FRAME nor QS_ESC) from 'src' to
+* 'dst', but not more than 'nMax' bytes, and add the copied bytes to the
+* checksum '*pChksum'. Returns the number of bytes copied.
+*
+* With SSE2 the run is copied and summed 16 bytes at a time, and only the
+* partial block at the end of the run is handled byte by byte. Nothing is
+* written past the end of the run, because the error reports still look
+* at the previous contents of the record buffer. QS records are short, so
+* wider vectors (AVX2) would not pay off.
+*/
+static uint32_t QSPY_copyPlain(uint8_t *dst, uint8_t const *src,
+                               uint32_t nMax, uint8_t *pChksum)
+{
+    uint32_t n = 0U;
+    uint32_t sum = *pChksum;
+
+#ifdef __SSE2__
+    __m128i const frame = _mm_set1_epi8((char)QS_FRAME);
+    __m128i const esc   = _mm_set1_epi8((char)QS_ESC);
+    __m128i const zero  = _mm_setzero_si128();
+    __m128i acc = zero;
+
+    /* whole blocks of plain bytes... */
+    while (n + 16U <= nMax) {
+        __m128i v = _mm_loadu_si128((__m128i const *)&src[n]);
+        if (_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, frame),
+                                           _mm_cmpeq_epi8(v, esc))) != 0)
+        {
+            break; /* the rest of the run is copied below */
+        }
+        _mm_storeu_si128((__m128i *)&dst[n], v);
+        acc = _mm_add_epi64(acc, _mm_sad_epu8(v, zero));
+        n += 16U;
+    }
+    sum += (uint32_t)_mm_cvtsi128_si32(acc)
+           + (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(acc, 8));
+#endif
+
+    /* the end of the run (or the whole run without SSE2)... */
+    while ((n < nMax) && (src[n] != QS_FRAME) && (src[n] != QS_ESC)) {
+        dst[n] = src[n];
+        sum += src[n];
+        ++n;
+    }
+
+    *pChksum = (uint8_t)sum;
+    return n;
+}
+/*..........................................................................*/
 void QSPY_parse(uint8_t const *buf, uint32_t nBytes) {
     static bool isJustStarted = true;
 
-    for (; nBytes != 0U; --nBytes) {
-        uint8_t b = *buf++;
+    while (nBytes != 0U) {
+        uint8_t b;
+
+        /* fast path: copy the run of plain bytes into the record in bulk */
+        if (l_esc == 0U) {
+            uint32_t n = (uint32_t)(&l_record[sizeof(l_record)] - l_pos);
+            if (n > nBytes) {
+                n = nBytes;
+            }
+            n = QSPY_copyPlain(l_pos, buf, n, &l_chksum);
+            if (n != 0U) {
+                l_pos  += n;
+                buf    += n;
+                nBytes -= n;
+                continue;
+            }
+        }
+
+        /* slow path: frame byte, escape sequence, or record too long */
+        b = *buf++;
+        --nBytes;
 
         if (l_esc) { /* escaped byte arrived? */
             l_esc = 0U;
@@ -2367,8 +2616,12 @@ void QSPY_parse(uint8_t const *buf, uint32_t nBytes) {
                 l_seq = l_record[0];
 
                 QSpyRecord_init(&qrec, l_record, (int32_t)(l_pos - l_record));
+                l_keys.flags = 0U;
 
-                if (l_custParseFun != (QSPY_CustParseFun)0) {
+                if (l_stateOnly) { /* only the parser state requested? */
+                    parse = QSPY_isStateRec(qrec.rec);
+                }
+                else if (l_custParseFun != (QSPY_CustParseFun)0) {
                     parse = (*l_custParseFun)(&qrec);
                     if (parse) {
                         /* re-initialize the record for parsing again */
@@ -2379,6 +2632,10 @@ void QSPY_parse(uint8_t const *buf, uint32_t nBytes) {
                 if (parse) {
                     QSpyRecord_process(&qrec);
                 }
+                if (!l_stateOnly) {
+                    QSPY_arcPut(l_record, (uint32_t)(l_pos - l_record),
+                                &l_keys);
+                }
             }
 
             /* get ready for the next record ... */
@@ -2411,6 +2668,22 @@ void QSPY_parse(uint8_t const *buf, uint32_t nBytes) {
     }
 }
 
+/*..........................................................................*/
+void QSPY_parseState(uint8_t const *buf, uint32_t nBytes) {
+    l_stateOnly = true;
+    QSPY_parse(buf, nBytes);
+    l_stateOnly = false;
+}
+
+/*..........................................................................*/
+void QSPY_parseRec(uint8_t const *rec, uint32_t nBytes, bool stateOnly) {
+    QSpyRecord qrec;
+    QSpyRecord_init(&qrec, rec, nBytes);
+    if ((!stateOnly) || QSPY_isStateRec(qrec.rec)) {
+        QSpyRecord_process(&qrec);
+    }
+}
+
 /*..........................................................................*/
 void QSPY_setExternDict(char const *dictName) {
     SNPRINTF_S(l_dictFileName, sizeof(l_dictFileName), "%s", dictName);
@@ -2705,6 +2978,20 @@ KeyType QSPY_findFun(char const *name) {
 KeyType QSPY_findUsr(char const *name) {
     return Dictionary_findKey(&l_usrDict, name);
 }
+/*..........................................................................*/
+int QSPY_findRec(char const *name) {
+    int rec;
+    for (rec = 0; rec < (int)(sizeof(l_qs_rec)/sizeof(l_qs_rec[0])); ++rec) {
+        if (strcmp(l_qs_rec[rec], name) == 0) {
+            return rec;
+        }
+    }
+    return -1; /* not found */
+}
+/*..........................................................................*/
+char const *QSPY_getObj(ObjType obj) {
+    return Dictionary_get(&l_objDict, obj, (char *)0);
+}
 
 /*..........................................................................*/
 static char const *getMatDict(char const *s) {
@@ -2726,6 +3013,31 @@ static char const *getMatDict(char const *s) {
 }
 
 /****************************************************************************/
+/* The dictionaries keep their entries in the order of insertion and find
+* them through two open-addressing (linear probing) hash indexes: by the key
+* (or sig) and by the name. The index slots hold (entry index + 1), so that
+* zero marks an empty slot. The entries are never removed individually, so
+* no "deleted" slots are needed, but renaming an entry leaves a stale slot
+* in the name index, which is skipped because the name does not match and
+* which is purged by rebuilding the indexes when the name index gets 3/4
+* full. The entries are sorted by the key only when they are listed (the
+* dictionary file and the MSC file), which also rebuilds the indexes.
+*/
+/* hash of a dictionary key (Fibonacci hashing) */
+static int Dictionary_hashKey(KeyType key) {
+    return (int)((key * 0x9E3779B97F4A7C15ULL) >> 33);
+}
+/*..........................................................................*/
+/* hash of a dictionary name (FNV-1a) */
+static int Dictionary_hashName(char const *name) {
+    uint32_t h = 2166136261U;
+    int i;
+    for (i = 0; (i < DNAME_SIZE) && (name[i] != '\0'); ++i) {
+        h = (h ^ (uint8_t)name[i]) * 16777619U;
+    }
+    return (int)(h >> 1);
+}
+/*..........................................................................*/
 static int Dictionary_comp(void const *arg1, void const *arg2) {
     KeyType key1 = ((DictEntry const *)arg1)->key;
     KeyType key2 = ((DictEntry const *)arg2)->key;
@@ -2742,12 +3054,20 @@ static int Dictionary_comp(void const *arg1, void const *arg2) {
 
 /*..........................................................................*/
 static void Dictionary_ctor(Dictionary * const me,
-                            DictEntry *sto, uint32_t capacity)
+                            DictEntry *sto, uint32_t capacity,
+                            int *keyHash, int *nameHash, uint32_t hashSize)
 {
+    /* the hash indexes must be at least half empty */
+    Q_ASSERT(((hashSize & (hashSize - 1U)) == 0U)
+             && (hashSize >= 2U * capacity));
     me->sto      = sto;
     me->capacity = capacity;
     me->entries  = 0;
     me->keySize  = 4;
+    me->keyHash  = keyHash;
+    me->nameHash = nameHash;
+    me->hashMask = (int)hashSize - 1;
+    Dictionary_reset(me);
 }
 /*..........................................................................*/
 static void Dictionary_config(Dictionary * const me, int keySize) {
@@ -2763,6 +3083,32 @@ static char const *Dictionary_at(Dictionary * const me, unsigned idx) {
     }
 }
 /*..........................................................................*/
+/* add the entry 'idx' to the name index */
+static void Dictionary_indexName(Dictionary * const me, int idx) {
+    int i = Dictionary_hashName(me->sto[idx].name) & me->hashMask;
+    while (me->nameHash[i] != 0) {
+        i = (i + 1) & me->hashMask;
+    }
+    me->nameHash[i] = idx + 1;
+    ++me->nameUsed;
+}
+/*..........................................................................*/
+/* rebuild both hash indexes from the entries */
+static void Dictionary_reindex(Dictionary * const me) {
+    int idx;
+    memset(me->keyHash,  0, (size_t)(me->hashMask + 1)*sizeof(int));
+    memset(me->nameHash, 0, (size_t)(me->hashMask + 1)*sizeof(int));
+    me->nameUsed = 0;
+    for (idx = 0; idx < me->entries; ++idx) {
+        int i = Dictionary_hashKey(me->sto[idx].key) & me->hashMask;
+        while (me->keyHash[i] != 0) {
+            i = (i + 1) & me->hashMask;
+        }
+        me->keyHash[i] = idx + 1;
+        Dictionary_indexName(me, idx);
+    }
+}
+/*..........................................................................*/
 static void Dictionary_put(Dictionary * const me,
                            KeyType key, char const *name)
 {
@@ -2772,18 +3118,33 @@ static void Dictionary_put(Dictionary * const me,
     if (idx >= 0) { /* the key found? */
         Q_ASSERT((idx <= n) || (n == 0));
         dst = me->sto[idx].name;
-        STRCPY_S(dst, sizeof(me->sto[idx].name), name);
-        dst[sizeof(me->sto[idx].name) - 1] = '\0'; /* zero-terminate */
+        if (strncmp(dst, name, sizeof(me->sto[idx].name) - 1) != 0) {
+            STRCPY_S(dst, sizeof(me->sto[idx].name), name);
+            dst[sizeof(me->sto[idx].name) - 1] = '\0'; /* zero-terminate */
+
+            /* too many stale names in the name index? */
+            if (me->nameUsed >= (me->hashMask + 1) * 3 / 4) {
+                Dictionary_reindex(me);
+            }
+            else {
+                Dictionary_indexName(me, idx);
+            }
+        }
     }
     else if (n < me->capacity - 1) {
+        int i = Dictionary_hashKey(key) & me->hashMask;
         me->sto[n].key = key;
         dst = me->sto[n].name;
         STRCPY_S(dst, sizeof(me->sto[n].name), name);
-        dst[sizeof(me->sto[idx].name) - 1] = '\0'; /* zero-terminate */
+        dst[sizeof(me->sto[n].name) - 1] = '\0'; /* zero-terminate */
         ++me->entries;
-        /* keep the entries sorted by the key */
-        qsort(me->sto, (size_t)me->entries, sizeof(me->sto[0]),
-              &Dictionary_comp);
+
+        /* index the new entry */
+        while (me->keyHash[i] != 0) {
+            i = (i + 1) & me->hashMask;
+        }
+        me->keyHash[i] = n + 1;
+        Dictionary_indexName(me, n);
     }
 }
 /*..........................................................................*/
@@ -2815,33 +3176,28 @@ static char const *Dictionary_get(Dictionary * const me,
 }
 /*..........................................................................*/
 static int Dictionary_find(Dictionary * const me, KeyType key) {
-    /* binary search algorithm... */
-    int mid;
-    int first = 0;
-    int last = me->entries;
-    while (first <= last) {
-        mid = (first + last) / 2;
-        if (me->sto[mid].key == key) {
-            return mid;
-        }
-        if (me->sto[mid].key > key) {
-            last = mid - 1;
-        }
-        else {
-            first = mid + 1;
-        }
+    /* hash index lookup */
+    int i = Dictionary_hashKey(key) & me->hashMask;
+    while (me->keyHash[i] != 0) {
+        int idx = me->keyHash[i] - 1;
+        if (me->sto[idx].key == key) {
+            return idx;
+        }
+        i = (i + 1) & me->hashMask;
     }
 
     return -1; /* entry not found */
 }
 /*..........................................................................*/
 static KeyType Dictionary_findKey(Dictionary * const me, char const *name) {
-    /* brute-force search algorithm... */
-    int i;
-    for (i = 0; i < me->entries; ++i) {
-        if (strncmp(me->sto[i].name, name, sizeof(me->sto[i].name)) == 0) {
-            return me->sto[i].key;
-        }
+    /* hash index lookup */
+    int i = Dictionary_hashName(name) & me->hashMask;
+    while (me->nameHash[i] != 0) {
+        int idx = me->nameHash[i] - 1;
+        if (strncmp(me->sto[idx].name, name, sizeof(me->sto[idx].name)) == 0) {
+            return me->sto[idx].key;
+        }
+        i = (i + 1) & me->hashMask;
     }
     return (KeyType)0; /* not found */
 }
@@ -2852,11 +3208,20 @@ static void Dictionary_reset(Dictionary * const me) {
         me->sto[i].key = (KeyType)0;
     }
     me->entries = 0;
+    Dictionary_reindex(me);
+}
+/*..........................................................................*/
+static void Dictionary_sort(Dictionary * const me) {
+    /* sort the entries by the key only when they need to be listed */
+    qsort(me->sto, (size_t)me->entries, sizeof(me->sto[0]),
+          &Dictionary_comp);
+    Dictionary_reindex(me);
 }
 /*..........................................................................*/
-static void Dictionary_write(Dictionary const * const me, FILE *stream) {
+static void Dictionary_write(Dictionary * const me, FILE *stream) {
     int i;
 
+    Dictionary_sort(me); /* write the entries sorted by the key */
     FPRINTF_S(stream, "%d\n", me->keySize);
     for (i = 0; i < me->entries; ++i) {
         DictEntry const *e = &me->sto[i];
@@ -2933,41 +3298,89 @@ static int SigDictionary_comp(void const *arg1, void const *arg2) {
 }
 /*..........................................................................*/
 static void SigDictionary_ctor(SigDictionary * const me,
-                        SigDictEntry *sto, uint32_t capacity)
+                        SigDictEntry *sto, uint32_t capacity,
+                        int *sigHash, int *nameHash, uint32_t hashSize)
 {
+    /* the hash indexes must be at least half empty */
+    Q_ASSERT(((hashSize & (hashSize - 1U)) == 0U)
+             && (hashSize >= 2U * capacity));
     me->sto      = sto;
     me->capacity = capacity;
     me->entries  = 0;
     me->ptrSize  = 4;
+    me->sigHash  = sigHash;
+    me->nameHash = nameHash;
+    me->hashMask = (int)hashSize - 1;
+    SigDictionary_reset(me);
 }
 /*..........................................................................*/
 static void SigDictionary_config(SigDictionary * const me, int ptrSize) {
     me->ptrSize = ptrSize;
 }
 /*..........................................................................*/
+/* add the entry 'idx' to the name index */
+static void SigDictionary_indexName(SigDictionary * const me, int idx) {
+    int i = Dictionary_hashName(me->sto[idx].name) & me->hashMask;
+    while (me->nameHash[i] != 0) {
+        i = (i + 1) & me->hashMask;
+    }
+    me->nameHash[i] = idx + 1;
+    ++me->nameUsed;
+}
+/*..........................................................................*/
+/* rebuild both hash indexes from the entries */
+static void SigDictionary_reindex(SigDictionary * const me) {
+    int idx;
+    memset(me->sigHash,  0, (size_t)(me->hashMask + 1)*sizeof(int));
+    memset(me->nameHash, 0, (size_t)(me->hashMask + 1)*sizeof(int));
+    me->nameUsed = 0;
+    for (idx = 0; idx < me->entries; ++idx) {
+        int i = Dictionary_hashKey(me->sto[idx].sig) & me->hashMask;
+        while (me->sigHash[i] != 0) {
+            i = (i + 1) & me->hashMask;
+        }
+        me->sigHash[i] = idx + 1;
+        SigDictionary_indexName(me, idx);
+    }
+}
+/*..........................................................................*/
 static void SigDictionary_put(SigDictionary * const me,
                               SigType sig, ObjType obj, char const *name)
 {
-    int idx = SigDictionary_find(me, sig, obj);
+    int idx = SigDictionary_findEntry(me, sig, obj);
     int n = me->entries;
     char *dst;
     if (idx >= 0) { /* the key found? */
         Q_ASSERT((idx <= n) || (n == 0));
-        me->sto[idx].obj = obj;
         dst = me->sto[idx].name;
-        STRCPY_S(dst, sizeof(me->sto[idx].name), name);
-        dst[sizeof(me->sto[idx].name) - 1] = '\0'; /* zero-terminate */
+        if (strncmp(dst, name, sizeof(me->sto[idx].name) - 1) != 0) {
+            STRCPY_S(dst, sizeof(me->sto[idx].name), name);
+            dst[sizeof(me->sto[idx].name) - 1] = '\0'; /* zero-terminate */
+
+            /* too many stale names in the name index? */
+            if (me->nameUsed >= (me->hashMask + 1) * 3 / 4) {
+                SigDictionary_reindex(me);
+            }
+            else {
+                SigDictionary_indexName(me, idx);
+            }
+        }
     }
     else if (n < me->capacity - 1) {
+        int i = Dictionary_hashKey(sig) & me->hashMask;
         me->sto[n].sig = sig;
         me->sto[n].obj = obj;
         dst = me->sto[n].name;
         STRCPY_S(dst, sizeof(me->sto[n].name), name);
-        dst[sizeof(me->sto[idx].name) - 1] = '\0'; /* zero-terminate */
+        dst[sizeof(me->sto[n].name) - 1] = '\0'; /* zero-terminate */
         ++me->entries;
-        /* keep the entries sorted by the sig */
-        qsort(me->sto, (size_t)me->entries, sizeof(me->sto[0]),
-              &SigDictionary_comp);
+
+        /* index the new entry */
+        while (me->sigHash[i] != 0) {
+            i = (i + 1) & me->hashMask;
+        }
+        me->sigHash[i] = n + 1;
+        SigDictionary_indexName(me, n);
     }
 }
 /*..........................................................................*/
@@ -3003,60 +3416,56 @@ static char const *SigDictionary_get(SigDictionary * const me,
 static int SigDictionary_find(SigDictionary * const me,
                               SigType sig, ObjType obj)
 {
-    /* binary search algorithm ... */
-    int mid;
-    int first = 0;
-    int last = me->entries;
-    while (first <= last) {
-        mid = (first + last) / 2;
-        if (me->sto[mid].sig == sig) {
-            if (obj == 0) { /* global/generic signal? */
-                return mid;
+    /* hash index lookup of all entries for this sig, where the signal
+    * local to the object takes precedence over the global signal
+    */
+    int glb = -1;
+    int i = Dictionary_hashKey(sig) & me->hashMask;
+    while (me->sigHash[i] != 0) {
+        int idx = me->sigHash[i] - 1;
+        if (me->sto[idx].sig == sig) {
+            if ((obj == 0) || (me->sto[idx].obj == obj)) {
+                return idx;
             }
-            else {
-                first = mid;
-                do {
-                    if ((me->sto[first].obj == 0)
-                        || (me->sto[first].obj == obj))
-                    {
-                        return first;
-                    }
-                    --first;
-                } while ((first >= 0) && (me->sto[first].sig == sig));
-                last = mid + 1;
-                while ((last < me->entries) && (me->sto[last].sig == sig)) {
-                    if ((me->sto[last].obj == 0)
-                        || (me->sto[last].obj == obj))
-                    {
-                        return last;
-                    }
-                    ++last;
-                }
-                return -1;  /* entry not found */
+            if ((me->sto[idx].obj == 0) && (glb < 0)) {
+                glb = idx;
             }
         }
-        if (me->sto[mid].sig > sig) {
-            last = mid - 1;
-        }
-        else {
-            first = mid + 1;
-        }
+        i = (i + 1) & me->hashMask;
     }
 
+    return glb; /* the global signal or -1 if not found */
+}
+/*..........................................................................*/
+/* the entry of exactly this sig and obj (obj == 0 for the global signal) */
+static int SigDictionary_findEntry(SigDictionary * const me,
+                                   SigType sig, ObjType obj)
+{
+    int i = Dictionary_hashKey(sig) & me->hashMask;
+    while (me->sigHash[i] != 0) {
+        int idx = me->sigHash[i] - 1;
+        if ((me->sto[idx].sig == sig) && (me->sto[idx].obj == obj)) {
+            return idx;
+        }
+        i = (i + 1) & me->hashMask;
+    }
     return -1; /* entry not found */
 }
 /*..........................................................................*/
 static SigType SigDictionary_findSig(SigDictionary * const me,
                                      char const *name, ObjType obj)
 {
-    /* brute-force search algorithm... */
-    int i;
-    for (i = 0; i < me->entries; ++i) {
-        if (((me->sto[i].obj == obj) || (me->sto[i].obj == (ObjType)0))
-            && (strncmp(me->sto[i].name, name, sizeof(me->sto[i].name)) == 0))
+    /* hash index lookup of all entries for this name */
+    int i = Dictionary_hashName(name) & me->hashMask;
+    while (me->nameHash[i] != 0) {
+        int idx = me->nameHash[i] - 1;
+        if (((me->sto[idx].obj == obj) || (me->sto[idx].obj == (ObjType)0))
+            && (strncmp(me->sto[idx].name, name,
+                        sizeof(me->sto[idx].name)) == 0))
         {
-            return me->sto[i].sig;
+            return me->sto[idx].sig;
         }
+        i = (i + 1) & me->hashMask;
     }
     return (SigType)0; /* not found */
 }
@@ -3067,13 +3476,20 @@ static void SigDictionary_reset(SigDictionary * const me) {
         me->sto[i].sig = (SigType)0;
     }
     me->entries = 0;
+    SigDictionary_reindex(me);
 }
 /*..........................................................................*/
-static void SigDictionary_write(SigDictionary const * const me,
-                                FILE *stream)
-{
+static void SigDictionary_sort(SigDictionary * const me) {
+    /* sort the entries by the sig only when they need to be listed */
+    qsort(me->sto, (size_t)me->entries, sizeof(me->sto[0]),
+          &SigDictionary_comp);
+    SigDictionary_reindex(me);
+}
+/*..........................................................................*/
+static void SigDictionary_write(SigDictionary * const me, FILE *stream) {
     int i;
 
+    SigDictionary_sort(me); /* write the entries sorted by the sig */
     FPRINTF_S(stream, "%d\n", me->ptrSize);
     for (i = 0; i < me->entries; ++i) {
         SigDictEntry const *e = &me->sto[i];
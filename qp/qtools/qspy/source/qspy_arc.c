@@ -0,0 +1,872 @@
+/**
+* @file
+* @brief QSPY indexed archive of QS records
+* @ingroup qpspy
+* @cond
+******************************************************************************
+* Last updated for version 6.8.2
+* Last updated on  2020-07-17
+*
+*                    Q u a n t u m  L e a P s
+*                    ------------------------
+*                    Modern Embedded Software
+*
+* Copyright (C) 2005-2020 Quantum Leaps, LLC. All rights reserved.
+*
+* This program is open source software: you can redistribute it and/or
+* modify it under the terms of the GNU General Public License as published
+* by the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* Alternatively, this program may be distributed and modified under the
+* terms of Quantum Leaps commercial licenses, which expressly supersede
+* the GNU General Public License and are specifically designed for
+* licensees interested in retaining the proprietary status of their code.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program. If not, see <www.gnu.org/licenses>.
+*
+* Contact information:
+* <www.state-machine.com/licensing>
+* <info@state-machine.com>
+******************************************************************************
+* @endcond
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "safe_std.h" /* "safe" <stdio.h> and <string.h> facilities */
+#include "qspy.h"     /* QSPY data parser */
+
+/*
+* The archive holds the healthy QS records received by QSPY, in the order
+* of arrival, grouped into blocks of up to ARC_BLOCK_RECS records. Within a
+* block the records are split into columns (record-IDs, sequence numbers,
+* key flags, time stamps, objects, signals, lengths and the rest of the
+* record data), so that similar bytes end up next to each other, and the
+* whole block is then compressed with a simple LZ77 scheme.
+*
+* For every block the index holds the range of time stamps, the set of
+* record-IDs and a Bloom filter of the objects and signals in the block.
+* A query reads the index first and decompresses only the blocks that
+* might contain matching records. Within such a block, the records are
+* matched on the key columns, and only the matching records are decoded
+* by the regular QSPY parser.
+*
+* The records that change the parser state (Target info, dictionaries)
+* are replayed silently from every block that contains them, so that the
+* matching records are decoded exactly as they were when archived.
+* Records without a time stamp of their own (e.g., state entry/exit)
+* inherit the time stamp of the preceding record.
+*
+* The QS time stamps are only 1, 2 or 4 bytes wide and wrap around. The
+* archive extends them to 64 bits by counting the wrap-arounds (a time
+* stamp smaller than the preceding one), so that the archive time grows
+* monotonically. A Target reset restarts the time of the Target, so it
+* starts a new "epoch" of the archive time (the number of Target resets
+* before the record) and a new block. The index and the queries use the
+* epoch and the 64-bit archive time rather than the raw time stamps.
+*
+* File layout (all numbers little-endian):
+*   header: ARC_MAGIC
+*   blocks: compressed blocks, back to back
+*   index:  one ARC_IDX_SIZE entry per block
+*   footer: offset of the index (8 bytes), number of blocks (4 bytes),
+*           ARC_IDX_MAGIC (4 bytes)
+*/
+#define ARC_MAGIC       "QSPYARC2"
+#define ARC_IDX_MAGIC   "QIDX"
+#define ARC_BLOCK_RECS  4096U
+#define ARC_BLOCK_DATA  (64U * 1024U)
+#define ARC_BLOOM_BITS  512U
+#define ARC_MIN_MATCH   4U
+#define ARC_HASH_BITS   14U
+
+enum ArcColumns {
+    COL_REC,  /* record-ID, 1 byte per record */
+    COL_SEQ,  /* sequence number, 1 byte per record */
+    COL_FLG,  /* QSPY_KEY_... flags, 1 byte per record */
+    COL_TS,   /* time stamp difference (varint), if QSPY_KEY_TSTAMP */
+    COL_OBJ,  /* object (varint), if QSPY_KEY_OBJ */
+    COL_SIG,  /* signal (varint), if QSPY_KEY_SIG */
+    COL_LEN,  /* length of the record data (varint) */
+    COL_DAT,  /* record data (without seq, record-ID and checksum) */
+    COL_NUM
+};
+
+/* block header: number of records, initial time (8 bytes), column sizes */
+#define ARC_HDR_SIZE    (4U * (3U + COL_NUM))
+#define ARC_RAW_MAX     (ARC_HDR_SIZE + (ARC_BLOCK_RECS * 25U) \
+                         + ARC_BLOCK_DATA + QS_MAX_RECORD_SIZE)
+#define ARC_PACKED_MAX  (ARC_RAW_MAX + (ARC_RAW_MAX / 64U) + 16U)
+
+/* index entry of a block */
+typedef struct {
+    uint64_t offset;   /* file offset of the compressed block */
+    uint32_t packed;   /* compressed size (== raw if stored as is) */
+    uint32_t raw;      /* uncompressed size */
+    uint32_t nRecs;    /* number of records */
+    uint32_t epoch;    /* number of Target resets before the block */
+    uint64_t tMin;     /* smallest archive time */
+    uint64_t tMax;     /* largest archive time */
+    uint8_t  recMap[256U / 8U];            /* record-IDs in the block */
+    uint8_t  keyMap[ARC_BLOOM_BITS / 8U];  /* Bloom filter of obj/sig */
+} ArcIdx;
+
+#define ARC_IDX_SIZE    (8U + (4U * 4U) + (8U * 2U) + (256U / 8U) \
+                         + (ARC_BLOOM_BITS / 8U))
+
+/* archive writer ..........................................................*/
+static FILE    *l_arcFile;
+static ArcIdx  *l_idx;      /* index of all blocks written so far */
+static uint32_t l_nIdx;
+static uint32_t l_maxIdx;
+static uint64_t l_offset;   /* current file offset */
+static ArcIdx   l_blk;      /* index entry of the block being filled */
+static uint64_t l_t0;       /* archive time carried into the block */
+static uint64_t l_tLast;    /* last archive time (inherited by records) */
+static uint32_t l_tRaw;     /* last raw time stamp of the Target */
+static uint32_t l_wraps;    /* wrap-arounds of the raw time stamp */
+static uint32_t l_epoch;    /* number of Target resets so far */
+static uint8_t  l_colRec[ARC_BLOCK_RECS];
+static uint8_t  l_colSeq[ARC_BLOCK_RECS];
+static uint8_t  l_colFlg[ARC_BLOCK_RECS];
+static uint8_t  l_colTs [ARC_BLOCK_RECS * 5U];
+static uint8_t  l_colObj[ARC_BLOCK_RECS * 10U];
+static uint8_t  l_colSig[ARC_BLOCK_RECS * 5U];
+static uint8_t  l_colLen[ARC_BLOCK_RECS * 2U];
+static uint8_t  l_colDat[ARC_BLOCK_DATA + QS_MAX_RECORD_SIZE];
+static uint8_t * const l_col[COL_NUM] = {
+    l_colRec, l_colSeq, l_colFlg, l_colTs,
+    l_colObj, l_colSig, l_colLen, l_colDat
+};
+static uint32_t l_colSize[COL_NUM];  /* current sizes of the columns */
+
+/* shared by the writer and the query ......................................*/
+static uint8_t  l_raw[ARC_RAW_MAX];
+static uint8_t  l_packed[ARC_PACKED_MAX];
+static uint32_t l_hash[1U << ARC_HASH_BITS];
+static bool     l_quiet;    /* output suppressed (replaying state)? */
+
+/*..........................................................................*/
+static void putU32(uint8_t *p, uint32_t x) {
+    p[0] = (uint8_t)x;
+    p[1] = (uint8_t)(x >> 8);
+    p[2] = (uint8_t)(x >> 16);
+    p[3] = (uint8_t)(x >> 24);
+}
+/*..........................................................................*/
+static uint32_t getU32(uint8_t const *p) {
+    return (uint32_t)p[0]
+           | ((uint32_t)p[1] << 8)
+           | ((uint32_t)p[2] << 16)
+           | ((uint32_t)p[3] << 24);
+}
+/*..........................................................................*/
+static void putU64(uint8_t *p, uint64_t x) {
+    putU32(&p[0], (uint32_t)x);
+    putU32(&p[4], (uint32_t)(x >> 32));
+}
+/*..........................................................................*/
+static uint64_t getU64(uint8_t const *p) {
+    return (uint64_t)getU32(&p[0]) | ((uint64_t)getU32(&p[4]) << 32);
+}
+/*..........................................................................*/
+static uint32_t putVar(uint8_t *p, uint64_t x) {
+    uint32_t n = 0U;
+    while (x >= 0x80U) {
+        p[n++] = (uint8_t)(x | 0x80U);
+        x >>= 7;
+    }
+    p[n++] = (uint8_t)x;
+    return n;
+}
+/*..........................................................................*/
+/* decode a varint from [*pp, end); returns false if the input ran out */
+static bool getVar(uint8_t const **pp, uint8_t const *end, uint64_t *px) {
+    uint8_t const *p = *pp;
+    uint64_t x = 0U;
+    unsigned sh;
+    for (sh = 0U; (p < end) && (sh < 64U); sh += 7U) {
+        uint8_t b = *p++;
+        x |= (uint64_t)(b & 0x7FU) << sh;
+        if ((b & 0x80U) == 0U) {
+            *pp = p;
+            *px = x;
+            return true;
+        }
+    }
+    return false;
+}
+/*..........................................................................*/
+static uint32_t keyHash(uint64_t key, uint32_t salt) {
+    key ^= (uint64_t)salt << 56;
+    key *= 0x9E3779B97F4A7C15ULL;
+    key ^= key >> 31;
+    key *= 0xBF58476D1CE4E5B9ULL;
+    return (uint32_t)(key >> 32);
+}
+/*..........................................................................*/
+static void bloomAdd(uint8_t *map, uint64_t key, uint32_t salt) {
+    uint32_t h = keyHash(key, salt);
+    uint32_t i = h % ARC_BLOOM_BITS;
+    map[i >> 3] |= (uint8_t)(1U << (i & 7U));
+    i = (h >> 16) % ARC_BLOOM_BITS;
+    map[i >> 3] |= (uint8_t)(1U << (i & 7U));
+}
+/*..........................................................................*/
+static bool bloomHas(uint8_t const *map, uint64_t key, uint32_t salt) {
+    uint32_t h = keyHash(key, salt);
+    uint32_t i = h % ARC_BLOOM_BITS;
+    uint32_t j = (h >> 16) % ARC_BLOOM_BITS;
+    return ((map[i >> 3] & (1U << (i & 7U))) != 0U)
+           && ((map[j >> 3] & (1U << (j & 7U))) != 0U);
+}
+
+/*..........................................................................*/
+/* LZ77 compression of 'n' bytes from 'src' into 'dst'. The output is
+* a sequence of: literal count (varint), literals, match offset (varint)
+* and match length minus ARC_MIN_MATCH (varint). The last sequence has
+* only the literals. Returns the compressed size.
+*/
+static uint32_t arcPack(uint8_t *dst, uint8_t const *src, uint32_t n) {
+    uint8_t *out = dst;
+    uint32_t lit = 0U; /* start of the pending literals */
+    uint32_t i = 0U;
+
+    memset(l_hash, 0, sizeof(l_hash));
+    while (i + ARC_MIN_MATCH <= n) {
+        uint32_t h = (getU32(&src[i]) * 2654435761U)
+                     >> (32U - ARC_HASH_BITS);
+        uint32_t cand = l_hash[h];
+        l_hash[h] = i + 1U;
+        if ((cand != 0U)
+            && (memcmp(&src[cand - 1U], &src[i], ARC_MIN_MATCH) == 0))
+        {
+            uint32_t m = ARC_MIN_MATCH;
+            --cand;
+            while ((i + m < n) && (src[cand + m] == src[i + m])) {
+                ++m;
+            }
+            out += putVar(out, i - lit);
+            memcpy(out, &src[lit], i - lit);
+            out += i - lit;
+            out += putVar(out, i - cand);
+            out += putVar(out, m - ARC_MIN_MATCH);
+            i += m;
+            lit = i;
+        }
+        else {
+            ++i;
+        }
+    }
+    out += putVar(out, n - lit);
+    memcpy(out, &src[lit], n - lit);
+    out += n - lit;
+    return (uint32_t)(out - dst);
+}
+/*..........................................................................*/
+/* LZ77 decompression of 'm' bytes from 'src' into exactly 'n' bytes in
+* 'dst'. Returns false if the compressed data is corrupted.
+*/
+static bool arcUnpack(uint8_t *dst, uint32_t n,
+                      uint8_t const *src, uint32_t m)
+{
+    uint8_t const *end = src + m;
+    uint32_t i = 0U;
+    for (;;) {
+        uint64_t len;
+        uint64_t off;
+        if (!getVar(&src, end, &len)
+            || (len > (uint64_t)(end - src)) || (len > n - i))
+        {
+            return false;
+        }
+        memcpy(&dst[i], src, (size_t)len);
+        src += len;
+        i += (uint32_t)len;
+        if (i == n) {
+            return true;
+        }
+        if (!getVar(&src, end, &off) || !getVar(&src, end, &len)
+            || (off == 0U) || (off > i)
+            || (len + ARC_MIN_MATCH > n - i))
+        {
+            return false;
+        }
+        for (len += ARC_MIN_MATCH; len > 0U; --len, ++i) {
+            dst[i] = dst[i - (uint32_t)off]; /* the match may overlap */
+        }
+    }
+}
+
+/*..........................................................................*/
+static void putIdx(uint8_t *p, ArcIdx const *idx) {
+    putU64(&p[0],  idx->offset);
+    putU32(&p[8],  idx->packed);
+    putU32(&p[12], idx->raw);
+    putU32(&p[16], idx->nRecs);
+    putU32(&p[20], idx->epoch);
+    putU64(&p[24], idx->tMin);
+    putU64(&p[32], idx->tMax);
+    memcpy(&p[40], idx->recMap, sizeof(idx->recMap));
+    memcpy(&p[40 + sizeof(idx->recMap)], idx->keyMap, sizeof(idx->keyMap));
+}
+/*..........................................................................*/
+static void getIdx(uint8_t const *p, ArcIdx *idx) {
+    idx->offset = getU64(&p[0]);
+    idx->packed = getU32(&p[8]);
+    idx->raw    = getU32(&p[12]);
+    idx->nRecs  = getU32(&p[16]);
+    idx->epoch  = getU32(&p[20]);
+    idx->tMin   = getU64(&p[24]);
+    idx->tMax   = getU64(&p[32]);
+    memcpy(idx->recMap, &p[40], sizeof(idx->recMap));
+    memcpy(idx->keyMap, &p[40 + sizeof(idx->recMap)], sizeof(idx->keyMap));
+}
+
+/*..........................................................................*/
+static void arcFlush(void) {
+    uint8_t *p = &l_raw[ARC_HDR_SIZE];
+    uint8_t const *blk;
+    int col;
+
+    if (l_blk.nRecs == 0U) {
+        return;
+    }
+
+    putU32(&l_raw[0], l_blk.nRecs);
+    putU64(&l_raw[4], l_t0);
+    for (col = 0; col < COL_NUM; ++col) {
+        putU32(&l_raw[12 + (4 * col)], l_colSize[col]);
+        memcpy(p, l_col[col], l_colSize[col]);
+        p += l_colSize[col];
+        l_colSize[col] = 0U;
+    }
+    l_blk.raw    = (uint32_t)(p - l_raw);
+    l_blk.packed = arcPack(l_packed, l_raw, l_blk.raw);
+    blk = l_packed;
+    if (l_blk.packed >= l_blk.raw) { /* not compressible? */
+        l_blk.packed = l_blk.raw;
+        blk = l_raw;                 /* store the block as is */
+    }
+    l_blk.offset = l_offset;
+    fwrite(blk, 1, l_blk.packed, l_arcFile);
+    l_offset += l_blk.packed;
+
+    if (l_nIdx == l_maxIdx) { /* grow the index */
+        ArcIdx *idx;
+        l_maxIdx = (l_maxIdx != 0U) ? (2U * l_maxIdx) : 256U;
+        idx = (ArcIdx *)realloc(l_idx, l_maxIdx * sizeof(ArcIdx));
+        if (idx == (ArcIdx *)0) { /* out of memory? */
+            SNPRINTF_LINE("   <QSPY-> Archive index too large, "
+                          "archive abandoned");
+            QSPY_printError();
+            fclose(l_arcFile);
+            l_arcFile = (FILE *)0;
+            return;
+        }
+        l_idx = idx;
+    }
+    l_idx[l_nIdx++] = l_blk;
+
+    memset(&l_blk, 0, sizeof(l_blk));
+    l_blk.epoch = l_epoch;
+    l_t0 = l_tLast;
+}
+/*..........................................................................*/
+QSpyStatus QSPY_arcOpen(char const *fName) {
+    FOPEN_S(l_arcFile, fName, "wb");
+    if (l_arcFile == (FILE *)0) {
+        return QSPY_ERROR;
+    }
+    fwrite(ARC_MAGIC, 1, sizeof(ARC_MAGIC) - 1U, l_arcFile);
+    l_offset = sizeof(ARC_MAGIC) - 1U;
+    l_nIdx   = 0U;
+    l_t0     = 0U;
+    l_tLast  = 0U;
+    l_tRaw   = 0U;
+    l_wraps  = 0U;
+    l_epoch  = 0U;
+    memset(&l_blk, 0, sizeof(l_blk));
+    memset(l_colSize, 0, sizeof(l_colSize));
+    return QSPY_SUCCESS;
+}
+/*..........................................................................*/
+void QSPY_arcPut(uint8_t const *rec, uint32_t nBytes,
+                 QSpyRecKeys const *keys)
+{
+    uint32_t n;
+    uint64_t t;
+    uint8_t flags;
+
+    if (l_arcFile == (FILE *)0) { /* archive not open? */
+        return;
+    }
+
+    flags = keys->flags;
+    if ((flags & QSPY_KEY_RESET) != 0U) { /* Target reset? */
+        arcFlush(); /* a block never spans two epochs */
+        ++l_epoch;
+        l_blk.epoch = l_epoch;
+        l_t0    = 0U;
+        l_tLast = 0U;
+        l_tRaw  = 0U;
+        l_wraps = 0U;
+    }
+
+    n = nBytes - 3U; /* without the seq, record-ID and checksum */
+    if ((l_blk.nRecs == ARC_BLOCK_RECS)
+        || (l_colSize[COL_DAT] + n > ARC_BLOCK_DATA))
+    {
+        arcFlush();
+    }
+
+    if ((flags & QSPY_KEY_TSTAMP) != 0U) {
+        uint8_t const size = QSPY_getConfig()->tstampSize;
+        unsigned const bits = ((size >= 1U) && (size < 4U))
+                              ? (8U * size) : 32U;
+        if (keys->tstamp < l_tRaw) { /* the time stamp wrapped around? */
+            ++l_wraps;
+        }
+        l_tRaw = keys->tstamp;
+        t = ((uint64_t)l_wraps << bits) + l_tRaw;
+        l_colSize[COL_TS] += putVar(&l_colTs[l_colSize[COL_TS]],
+                                    t - l_tLast);
+        l_tLast = t;
+    }
+    else {
+        t = l_tLast; /* inherit the time stamp of the preceding record */
+    }
+    if ((flags & QSPY_KEY_OBJ) != 0U) {
+        l_colSize[COL_OBJ] += putVar(&l_colObj[l_colSize[COL_OBJ]],
+                                     keys->obj);
+        bloomAdd(l_blk.keyMap, keys->obj, QSPY_KEY_OBJ);
+    }
+    if ((flags & QSPY_KEY_SIG) != 0U) {
+        l_colSize[COL_SIG] += putVar(&l_colSig[l_colSize[COL_SIG]],
+                                     keys->sig);
+        bloomAdd(l_blk.keyMap, keys->sig, QSPY_KEY_SIG);
+    }
+    l_colRec[l_colSize[COL_REC]++] = rec[1];
+    l_colSeq[l_colSize[COL_SEQ]++] = rec[0];
+    l_colFlg[l_colSize[COL_FLG]++] = flags;
+    l_colSize[COL_LEN] += putVar(&l_colLen[l_colSize[COL_LEN]], n);
+    memcpy(&l_colDat[l_colSize[COL_DAT]], &rec[2], n);
+    l_colSize[COL_DAT] += n;
+
+    if ((l_blk.nRecs == 0U) || (t < l_blk.tMin)) {
+        l_blk.tMin = t;
+    }
+    if ((l_blk.nRecs == 0U) || (t > l_blk.tMax)) {
+        l_blk.tMax = t;
+    }
+    l_blk.recMap[rec[1] >> 3] |= (uint8_t)(1U << (rec[1] & 7U));
+    ++l_blk.nRecs;
+}
+/*..........................................................................*/
+void QSPY_arcClose(void) {
+    uint8_t buf[ARC_IDX_SIZE];
+    uint32_t i;
+
+    if (l_arcFile == (FILE *)0) { /* archive not open? */
+        return;
+    }
+    arcFlush();
+    for (i = 0U; i < l_nIdx; ++i) {
+        putIdx(buf, &l_idx[i]);
+        fwrite(buf, 1, ARC_IDX_SIZE, l_arcFile);
+    }
+    putU64(&buf[0], l_offset);
+    putU32(&buf[8], l_nIdx);
+    memcpy(&buf[12], ARC_IDX_MAGIC, 4U);
+    fwrite(buf, 1, 16U, l_arcFile);
+    fclose(l_arcFile);
+    l_arcFile = (FILE *)0;
+
+    free(l_idx);
+    l_idx = (ArcIdx *)0;
+    l_maxIdx = 0U;
+}
+
+/* archive query ...........................................................*/
+typedef struct {
+    uint8_t  recMap[256U / 8U]; /* requested record-IDs */
+    bool     anyRec;            /* no record-ID filter? */
+    uint64_t t1, t2;            /* requested archive time range */
+    uint32_t epoch;             /* requested epoch */
+    bool     anyEpoch;          /* no epoch filter? */
+    char     objName[64];       /* requested object ("" for any) */
+    char     sigName[64];       /* requested signal ("" for any) */
+    ObjType  obj;               /* the object resolved from objName */
+    SigType  sig;               /* the signal resolved from sigName */
+    bool     objOK;             /* the object (still) resolved? */
+    bool     sigOK;             /* the signal (still) resolved? */
+} ArcQuery;
+
+static uint8_t l_stateMap[256U / 8U]; /* record-IDs of the state records */
+
+/*..........................................................................*/
+/* parse an unsigned number; returns false if 'str' is not a number */
+static bool parseNum(char const *str, uint64_t *px) {
+    char *end;
+    if ((str[0] < '0') || (str[0] > '9')) {
+        return false;
+    }
+    *px = (uint64_t)strtoull(str, &end, 0);
+    return (*end == '\0');
+}
+/*..........................................................................*/
+/* resolve the object/signal names with the current dictionaries */
+static void resolveKeys(ArcQuery *q) {
+    uint64_t x;
+    if (q->objName[0] != '\0') {
+        if (parseNum(q->objName, &x)) {
+            q->obj = (ObjType)x;
+        }
+        else {
+            q->obj = (ObjType)QSPY_findObj(q->objName);
+        }
+        q->objOK = (q->obj != (ObjType)0);
+    }
+    if (q->sigName[0] != '\0') {
+        if (parseNum(q->sigName, &x)) {
+            q->sig = (SigType)x;
+        }
+        else {
+            /* the signals local to an object are found only with obj= */
+            q->sig = QSPY_findSig(q->sigName,
+                                  (q->objName[0] != '\0') ? q->obj : 0U);
+        }
+        q->sigOK = (q->sig != (SigType)0);
+    }
+}
+/*..........................................................................*/
+/* parse the filter, e.g.: "rec=QS_QF_ACTIVE_POST,obj=AO_Table,t=100-200" */
+static QSpyStatus parseFilter(ArcQuery *q, char const *filter) {
+    char buf[256];
+    char *tok;
+
+    memset(q, 0, sizeof(*q));
+    q->anyRec = true;
+    q->anyEpoch = true;
+    q->t2 = 0xFFFFFFFFFFFFFFFFULL;
+    if ((filter == (char const *)0) || (filter[0] == '\0')) {
+        return QSPY_SUCCESS;
+    }
+
+    STRCPY_S(buf, sizeof(buf), filter);
+    for (tok = strtok(buf, ","); tok != (char *)0;
+         tok = strtok((char *)0, ","))
+    {
+        char *val = strchr(tok, '=');
+        uint64_t x;
+        if (val == (char *)0) {
+            FPRINTF_S(stderr, "Incorrect query filter: %s\n", tok);
+            return QSPY_ERROR;
+        }
+        *val++ = '\0';
+        if (strcmp(tok, "rec") == 0) {
+            int rec = QSPY_findRec(val);
+            if ((rec < 0) && parseNum(val, &x) && (x < 256U)) {
+                rec = (int)x;
+            }
+            if (rec < 0) {
+                FPRINTF_S(stderr, "Unknown record in the query: %s\n", val);
+                return QSPY_ERROR;
+            }
+            q->recMap[rec >> 3] |= (uint8_t)(1U << (rec & 7));
+            q->anyRec = false;
+        }
+        else if (strcmp(tok, "obj") == 0) {
+            STRCPY_S(q->objName, sizeof(q->objName), val);
+        }
+        else if (strcmp(tok, "sig") == 0) {
+            STRCPY_S(q->sigName, sizeof(q->sigName), val);
+        }
+        else if (strcmp(tok, "t") == 0) {
+            char *t2 = strchr(val, '-');
+            if (t2 != (char *)0) { /* range "t1-t2", "t1-" or "-t2"? */
+                *t2++ = '\0';
+                if (*t2 != '\0') {
+                    q->t2 = (uint64_t)strtoull(t2, (char **)0, 10);
+                }
+                if (*val != '\0') {
+                    q->t1 = (uint64_t)strtoull(val, (char **)0, 10);
+                }
+            }
+            else { /* single time stamp */
+                q->t1 = (uint64_t)strtoull(val, (char **)0, 10);
+                q->t2 = q->t1;
+            }
+        }
+        else if (strcmp(tok, "epoch") == 0) {
+            if (!parseNum(val, &x) || (x > 0xFFFFFFFFU)) {
+                FPRINTF_S(stderr, "Incorrect epoch in the query: %s\n",
+                          val);
+                return QSPY_ERROR;
+            }
+            q->epoch = (uint32_t)x;
+            q->anyEpoch = false;
+        }
+        else {
+            FPRINTF_S(stderr, "Unknown key in the query: %s\n", tok);
+            return QSPY_ERROR;
+        }
+    }
+    return QSPY_SUCCESS;
+}
+/*..........................................................................*/
+/* might the block contain records matching the query? */
+static bool blockMatches(ArcIdx const *idx, ArcQuery const *q) {
+    unsigned i;
+    if ((!q->anyEpoch) && (idx->epoch != q->epoch)) {
+        return false;
+    }
+    if ((idx->tMax < q->t1) || (idx->tMin > q->t2)) {
+        return false;
+    }
+    if (!q->anyRec) {
+        for (i = 0U; i < sizeof(q->recMap); ++i) {
+            if ((idx->recMap[i] & q->recMap[i]) != 0U) {
+                break;
+            }
+        }
+        if (i == sizeof(q->recMap)) {
+            return false;
+        }
+    }
+    if ((q->objName[0] != '\0')
+        && ((!q->objOK)
+            || !bloomHas(idx->keyMap, q->obj, QSPY_KEY_OBJ)))
+    {
+        return false;
+    }
+    if ((q->sigName[0] != '\0')
+        && ((!q->sigOK)
+            || !bloomHas(idx->keyMap, q->sig, QSPY_KEY_SIG)))
+    {
+        return false;
+    }
+    return true;
+}
+/*..........................................................................*/
+/* does the block contain any records that change the parser state? */
+static bool blockHasState(ArcIdx const *idx) {
+    unsigned i;
+    for (i = 0U; i < sizeof(l_stateMap); ++i) {
+        if ((idx->recMap[i] & l_stateMap[i]) != 0U) {
+            return true;
+        }
+    }
+    return false;
+}
+/*..........................................................................*/
+/* go over the records of the unpacked block in l_raw, decode the records
+* matching the query 'q' and silently replay the state records.
+* Returns the number of matching records or -1 for a corrupted block.
+*/
+static int32_t scanBlock(ArcIdx const *idx, ArcQuery *q) {
+    uint8_t const *col[COL_NUM];
+    uint8_t const *end[COL_NUM];
+    uint8_t rec[QS_MAX_RECORD_SIZE];
+    uint8_t const *p = &l_raw[ARC_HDR_SIZE];
+    uint32_t nRecs;
+    uint64_t t;
+    uint32_t i;
+    int32_t nMatch = 0;
+    bool const epochOK = (q->anyEpoch || (idx->epoch == q->epoch));
+    int c;
+
+    if (idx->raw < ARC_HDR_SIZE) {
+        return -1;
+    }
+    nRecs = getU32(&l_raw[0]);
+    t     = getU64(&l_raw[4]);
+    for (c = 0; c < COL_NUM; ++c) {
+        uint32_t len = getU32(&l_raw[12 + (4 * c)]);
+        if (len > (uint32_t)(&l_raw[idx->raw] - p)) {
+            return -1;
+        }
+        col[c] = p;
+        p += len;
+        end[c] = p;
+    }
+    if ((nRecs != idx->nRecs)
+        || ((uint32_t)(end[COL_REC] - col[COL_REC]) != nRecs)
+        || ((uint32_t)(end[COL_SEQ] - col[COL_SEQ]) != nRecs)
+        || ((uint32_t)(end[COL_FLG] - col[COL_FLG]) != nRecs))
+    {
+        return -1;
+    }
+
+    for (i = 0U; i < nRecs; ++i) {
+        uint8_t id    = col[COL_REC][i];
+        uint8_t flags = col[COL_FLG][i];
+        uint64_t obj = 0U;
+        uint64_t sig = 0U;
+        uint64_t x;
+        bool match;
+
+        if ((flags & QSPY_KEY_TSTAMP) != 0U) {
+            if (!getVar(&col[COL_TS], end[COL_TS], &x)) {
+                return -1;
+            }
+            t += x;
+        }
+        if (((flags & QSPY_KEY_OBJ) != 0U)
+            && !getVar(&col[COL_OBJ], end[COL_OBJ], &obj))
+        {
+            return -1;
+        }
+        if (((flags & QSPY_KEY_SIG) != 0U)
+            && !getVar(&col[COL_SIG], end[COL_SIG], &sig))
+        {
+            return -1;
+        }
+        if (!getVar(&col[COL_LEN], end[COL_LEN], &x)
+            || (x > (uint64_t)(end[COL_DAT] - col[COL_DAT]))
+            || (x + 3U > sizeof(rec)))
+        {
+            return -1;
+        }
+
+        /* match the record on the key columns only... */
+        match = (q->anyRec
+                || ((q->recMap[id >> 3] & (1U << (id & 7U))) != 0U))
+            && epochOK && (q->t1 <= t) && (t <= q->t2)
+            && ((q->objName[0] == '\0')
+                || (q->objOK && ((flags & QSPY_KEY_OBJ) != 0U)
+                    && ((ObjType)obj == q->obj)))
+            && ((q->sigName[0] == '\0')
+                || (q->sigOK && ((flags & QSPY_KEY_SIG) != 0U)
+                    && ((SigType)sig == q->sig)));
+
+        if (match || QSPY_isStateRec(id)) {
+            /* ... and decode only the matching and the state records */
+            rec[0] = col[COL_SEQ][i];
+            rec[1] = id;
+            memcpy(&rec[2], col[COL_DAT], (size_t)x);
+            rec[x + 2U] = 0U; /* checksum (not used by the decoder) */
+
+            l_quiet = !match;
+            QSPY_parseRec(rec, (uint32_t)x + 3U, !match);
+            l_quiet = false;
+
+            if (QSPY_isStateRec(id)) { /* dictionaries might have changed */
+                resolveKeys(q);
+            }
+            if (match) {
+                ++nMatch;
+            }
+        }
+        col[COL_DAT] += x;
+    }
+    return nMatch;
+}
+/*..........................................................................*/
+QSpyStatus QSPY_arcQuery(char const *fName, char const *filter) {
+    ArcQuery q;
+    ArcIdx idx;
+    FILE *f;
+    uint8_t buf[ARC_IDX_SIZE];
+    uint64_t idxOffset;
+    uint32_t nBlocks;
+    uint32_t nRead = 0U;
+    uint32_t nMatch = 0U;
+    uint32_t i;
+    int rec;
+    QSpyStatus status = QSPY_ERROR;
+
+    if (parseFilter(&q, filter) != QSPY_SUCCESS) {
+        return QSPY_ERROR;
+    }
+    memset(l_stateMap, 0, sizeof(l_stateMap));
+    for (rec = 0; rec < 256; ++rec) {
+        if (QSPY_isStateRec((uint8_t)rec)) {
+            l_stateMap[rec >> 3] |= (uint8_t)(1U << (rec & 7));
+        }
+    }
+    resolveKeys(&q); /* names might be known from the -d dictionaries */
+
+    FOPEN_S(f, fName, "rb");
+    if (f == (FILE *)0) {
+        SNPRINTF_LINE("   <QSPY-> Cannot open File=%s", fName);
+        QSPY_printError();
+        return QSPY_ERROR;
+    }
+    if ((fread(buf, 1, sizeof(ARC_MAGIC) - 1U, f)
+            != sizeof(ARC_MAGIC) - 1U)
+        || (memcmp(buf, ARC_MAGIC, sizeof(ARC_MAGIC) - 1U) != 0)
+        || (fseek(f, -16L, SEEK_END) != 0)
+        || (fread(buf, 1, 16U, f) != 16U)
+        || (memcmp(&buf[12], ARC_IDX_MAGIC, 4U) != 0))
+    {
+        SNPRINTF_LINE("   <QSPY-> Not a QSPY archive File=%s", fName);
+        QSPY_printError();
+        fclose(f);
+        return QSPY_ERROR;
+    }
+    idxOffset = getU64(&buf[0]);
+    nBlocks = getU32(&buf[8]);
+
+    for (i = 0U; i < nBlocks; ++i) {
+        int32_t n;
+
+        /* the index entries are read one at a time, as needed */
+        if ((fseek(f, (long)(idxOffset + (uint64_t)i * ARC_IDX_SIZE),
+                   SEEK_SET) != 0)
+            || (fread(buf, 1, ARC_IDX_SIZE, f) != ARC_IDX_SIZE))
+        {
+            break;
+        }
+        getIdx(buf, &idx);
+
+        if (!blockMatches(&idx, &q) && !blockHasState(&idx)) {
+            continue; /* skip the block without decompressing it */
+        }
+
+        if ((idx.raw > sizeof(l_raw)) || (idx.packed > sizeof(l_packed))
+            || (idx.packed > idx.raw)
+            || (fseek(f, (long)idx.offset, SEEK_SET) != 0)
+            || (fread((idx.packed == idx.raw) ? l_raw : l_packed,
+                      1, idx.packed, f) != idx.packed)
+            || ((idx.packed != idx.raw)
+                && !arcUnpack(l_raw, idx.raw, l_packed, idx.packed)))
+        {
+            break;
+        }
+        ++nRead;
+
+        n = scanBlock(&idx, &q);
+        if (n < 0) {
+            break;
+        }
+        nMatch += (uint32_t)n;
+    }
+    if (i == nBlocks) {
+        status = QSPY_SUCCESS;
+    }
+    else {
+        SNPRINTF_LINE("   <QSPY-> Corrupted archive File=%s,Block=%u",
+                      fName, (unsigned)i);
+        QSPY_printError();
+    }
+    fclose(f);
+
+    SNPRINTF_LINE("   <QSPY-> Query Blocks=%u/%u,Matched=%u",
+                  (unsigned)nRead, (unsigned)nBlocks, (unsigned)nMatch);
+    QSPY_printInfo();
+    return status;
+}
+/*..........................................................................*/
+bool QSPY_arcIsQuiet(void) {
+    return l_quiet;
+}
@@ -0,0 +1,387 @@
+/**
+* @file
+* @brief QSPY streaming statistics of QS records
+* @ingroup qpspy
+* @cond
+******************************************************************************
+* Last updated for version 6.8.2
+* Last updated on  2020-07-17
+*
+*                    Q u a n t u m  L e a P s
+*                    ------------------------
+*                    Modern Embedded Software
+*
+* Copyright (C) 2005-2020 Quantum Leaps, LLC. All rights reserved.
+*
+* This program is open source software: you can redistribute it and/or
+* modify it under the terms of the GNU General Public License as published
+* by the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* Alternatively, this program may be distributed and modified under the
+* terms of Quantum Leaps commercial licenses, which expressly supersede
+* the GNU General Public License and are specifically designed for
+* licensees interested in retaining the proprietary status of their code.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program. If not, see <www.gnu.org/licenses>.
+*
+* Contact information:
+* <www.state-machine.com/licensing>
+* <info@state-machine.com>
+******************************************************************************
+* @endcond
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "safe_std.h" /* "safe" <stdio.h> and <string.h> facilities */
+#include "qspy.h"     /* QSPY data parser */
+
+/*
+* The statistics are collected from the records decoded by QSPY:
+* - per active object: the queue depth at every post and the latency
+*   from posting an event to getting it out of the queue. The posts are
+*   matched with the gets in the FIFO order (LIFO posts go to the front);
+*   the queue emptied (QS_QF_ACTIVE_GET_LAST) re-synchronizes the match.
+*   The queue capacity is not in the trace, so the depth is counted from
+*   the largest number of free entries seen (+1 for the front event);
+* - per state machine: the run-to-completion step, from the dispatch of
+*   an event to the transition, internal transition or ignoring of it;
+* - per memory pool: the blocks in use (again counted from the largest
+*   number of free blocks seen) and the low-watermark from the Target.
+*
+* All durations are in the units of the Target time stamp. The memory is
+* bounded: there is a fixed number of objects of each kind and every
+* distribution is kept in a log-linear histogram with 8 sub-buckets per
+* power of two, so the reported percentiles are within 12.5% of the
+* exact values.
+*/
+#define STAT_MAX_AO     64U   /* active objects */
+#define STAT_MAX_SM     128U  /* state machines */
+#define STAT_MAX_MP     16U   /* memory pools */
+#define STAT_MAX_POSTS  256U  /* posted events in flight per AO */
+#define STAT_SUB_BITS   3U
+#define STAT_SUB        (1U << STAT_SUB_BITS)
+#define STAT_BUCKETS    (STAT_SUB + ((32U - STAT_SUB_BITS) * STAT_SUB))
+
+typedef struct {
+    uint64_t cnt[STAT_BUCKETS];
+    uint64_t total;
+    uint32_t max;
+} Histogram;
+
+typedef struct {
+    ObjType   obj;
+    uint64_t  posts;
+    uint64_t  gets;
+    uint32_t  maxFree;  /* largest number of free entries seen */
+    uint32_t  nMin;     /* low-watermark of free entries from the Target */
+    Histogram depth;
+    Histogram latency;
+    uint32_t  tPost[STAT_MAX_POSTS]; /* time stamps of the posts */
+    uint32_t  head;     /* the oldest post in tPost[] */
+    uint32_t  nPosts;   /* posts in tPost[] */
+} AoStat;
+
+typedef struct {
+    ObjType   obj;
+    uint32_t  tBegin;   /* time stamp of the dispatch */
+    bool      inRtc;    /* dispatch seen, but not the end of the step? */
+    Histogram rtc;
+} SmStat;
+
+typedef struct {
+    ObjType   obj;
+    uint64_t  gets;
+    uint64_t  puts;
+    uint32_t  maxFree;  /* largest number of free blocks seen */
+    uint32_t  nMin;     /* low-watermark of free blocks from the Target */
+    Histogram inUse;
+} MpStat;
+
+static bool     l_on;         /* statistics collected? */
+static AoStat   l_ao[STAT_MAX_AO];
+static uint32_t l_nAo;
+static SmStat   l_sm[STAT_MAX_SM];
+static uint32_t l_nSm;
+static MpStat   l_mp[STAT_MAX_MP];
+static uint32_t l_nMp;
+static uint32_t l_nLost;      /* objects not tracked (tables full) */
+
+/*..........................................................................*/
+static uint32_t bucketOf(uint32_t x) {
+    uint32_t e;
+    if (x < STAT_SUB) {
+        return x;
+    }
+    for (e = STAT_SUB_BITS; (x >> (e + 1U)) != 0U; ++e) {
+    }
+    return STAT_SUB + ((e - STAT_SUB_BITS) * STAT_SUB)
+           + ((x >> (e - STAT_SUB_BITS)) & (STAT_SUB - 1U));
+}
+/*..........................................................................*/
+/* the largest value falling into the bucket 'b' */
+static uint32_t bucketTop(uint32_t b) {
+    uint32_t e;
+    uint32_t sub;
+    if (b < STAT_SUB) {
+        return b;
+    }
+    e   = ((b - STAT_SUB) / STAT_SUB) + STAT_SUB_BITS;
+    sub = (b - STAT_SUB) % STAT_SUB;
+    return (((STAT_SUB + sub + 1U) << (e - STAT_SUB_BITS)) - 1U);
+}
+/*..........................................................................*/
+static void Histogram_add(Histogram * const me, uint32_t x) {
+    ++me->cnt[bucketOf(x)];
+    ++me->total;
+    if (x > me->max) {
+        me->max = x;
+    }
+}
+/*..........................................................................*/
+/* estimate of the value below which 'pct' percent of the samples fall */
+static uint32_t Histogram_pct(Histogram const * const me, unsigned pct) {
+    uint64_t rank = ((me->total * pct) + 99U) / 100U;
+    uint64_t sum = 0U;
+    uint32_t b;
+    for (b = 0U; b < STAT_BUCKETS; ++b) {
+        sum += me->cnt[b];
+        if ((sum >= rank) && (sum != 0U)) {
+            uint32_t top = bucketTop(b);
+            return (top < me->max) ? top : me->max;
+        }
+    }
+    return me->max;
+}
+/*..........................................................................*/
+/* append the "<Max=,p50=,p90=,p99=>" summary of the histogram */
+static void Histogram_print(Histogram const * const me, char const *name) {
+    if (me->total == 0U) {
+        SNPRINTF_APPEND(",%s<>", name);
+    }
+    else {
+        SNPRINTF_APPEND(",%s<p50=%u,p90=%u,p99=%u,Max=%u>",
+                        name,
+                        (unsigned)Histogram_pct(me, 50U),
+                        (unsigned)Histogram_pct(me, 90U),
+                        (unsigned)Histogram_pct(me, 99U),
+                        (unsigned)me->max);
+    }
+}
+
+/*..........................................................................*/
+/* find the AO statistics (add a new one if needed); NULL if the table full.
+* The tables are small and the same few objects keep coming, so the last
+* object found is checked first.
+*/
+static AoStat *findAo(ObjType obj) {
+    static uint32_t last;
+    uint32_t i;
+    if ((last < l_nAo) && (l_ao[last].obj == obj)) {
+        return &l_ao[last];
+    }
+    for (i = 0U; i < l_nAo; ++i) {
+        if (l_ao[i].obj == obj) {
+            last = i;
+            return &l_ao[i];
+        }
+    }
+    if (l_nAo == STAT_MAX_AO) {
+        ++l_nLost;
+        return (AoStat *)0;
+    }
+    memset(&l_ao[l_nAo], 0, sizeof(l_ao[l_nAo]));
+    l_ao[l_nAo].obj  = obj;
+    l_ao[l_nAo].nMin = 0xFFFFFFFFU;
+    last = l_nAo;
+    return &l_ao[l_nAo++];
+}
+/*..........................................................................*/
+static SmStat *findSm(ObjType obj) {
+    static uint32_t last;
+    uint32_t i;
+    if ((last < l_nSm) && (l_sm[last].obj == obj)) {
+        return &l_sm[last];
+    }
+    for (i = 0U; i < l_nSm; ++i) {
+        if (l_sm[i].obj == obj) {
+            last = i;
+            return &l_sm[i];
+        }
+    }
+    if (l_nSm == STAT_MAX_SM) {
+        ++l_nLost;
+        return (SmStat *)0;
+    }
+    memset(&l_sm[l_nSm], 0, sizeof(l_sm[l_nSm]));
+    l_sm[l_nSm].obj = obj;
+    last = l_nSm;
+    return &l_sm[l_nSm++];
+}
+/*..........................................................................*/
+static MpStat *findMp(ObjType obj) {
+    uint32_t i;
+    for (i = 0U; i < l_nMp; ++i) {
+        if (l_mp[i].obj == obj) {
+            return &l_mp[i];
+        }
+    }
+    if (l_nMp == STAT_MAX_MP) {
+        ++l_nLost;
+        return (MpStat *)0;
+    }
+    memset(&l_mp[l_nMp], 0, sizeof(l_mp[l_nMp]));
+    l_mp[l_nMp].obj  = obj;
+    l_mp[l_nMp].nMin = 0xFFFFFFFFU;
+    return &l_mp[l_nMp++];
+}
+
+/*..........................................................................*/
+void QSPY_statOn(void) {
+    l_on = true;
+}
+/*..........................................................................*/
+void QSPY_statPost(uint32_t t, ObjType ao,
+                   uint32_t nFree, uint32_t nMin, bool lifo)
+{
+    AoStat *a;
+    if (!l_on || ((a = findAo(ao)) == (AoStat *)0)) {
+        return;
+    }
+    ++a->posts;
+    if (nFree > a->maxFree) {
+        a->maxFree = nFree;
+    }
+    if (nMin < a->nMin) {
+        a->nMin = nMin;
+    }
+    Histogram_add(&a->depth, a->maxFree + 1U - nFree);
+
+    if (a->nPosts == STAT_MAX_POSTS) { /* lost track of the queue? */
+        a->nPosts = 0U; /* re-synchronize on the next empty queue */
+    }
+    if (lifo) { /* LIFO post goes to the front of the queue */
+        a->head = (a->head + STAT_MAX_POSTS - 1U) % STAT_MAX_POSTS;
+        a->tPost[a->head] = t;
+    }
+    else {
+        a->tPost[(a->head + a->nPosts) % STAT_MAX_POSTS] = t;
+    }
+    ++a->nPosts;
+}
+/*..........................................................................*/
+void QSPY_statGet(uint32_t t, ObjType ao, uint32_t nFree, bool last) {
+    AoStat *a;
+    if (!l_on || ((a = findAo(ao)) == (AoStat *)0)) {
+        return;
+    }
+    ++a->gets;
+    if ((!last) && (nFree > a->maxFree)) {
+        a->maxFree = nFree;
+    }
+    if (a->nPosts != 0U) {
+        Histogram_add(&a->latency, t - a->tPost[a->head]);
+        a->head = (a->head + 1U) % STAT_MAX_POSTS;
+        --a->nPosts;
+    }
+    if (last) { /* the queue is empty now */
+        a->nPosts = 0U;
+    }
+}
+/*..........................................................................*/
+void QSPY_statRtc(uint32_t t, ObjType sm, bool begin) {
+    SmStat *s;
+    if (!l_on || ((s = findSm(sm)) == (SmStat *)0)) {
+        return;
+    }
+    if (begin) {
+        s->tBegin = t;
+        s->inRtc  = true;
+    }
+    else if (s->inRtc) {
+        Histogram_add(&s->rtc, t - s->tBegin);
+        s->inRtc = false;
+    }
+}
+/*..........................................................................*/
+void QSPY_statPool(ObjType mp, uint32_t nFree, uint32_t nMin, bool get) {
+    MpStat *m;
+    if (!l_on || ((m = findMp(mp)) == (MpStat *)0)) {
+        return;
+    }
+    if (get) {
+        ++m->gets;
+        if (nMin < m->nMin) {
+            m->nMin = nMin;
+        }
+    }
+    else {
+        ++m->puts;
+    }
+    if (nFree > m->maxFree) {
+        m->maxFree = nFree;
+    }
+    Histogram_add(&m->inUse, m->maxFree - nFree);
+}
+/*..........................................................................*/
+void QSPY_statReset(void) {
+    uint32_t i;
+    /* the events in flight and the RTC steps are gone with the Target */
+    for (i = 0U; i < l_nAo; ++i) {
+        l_ao[i].nPosts = 0U;
+    }
+    for (i = 0U; i < l_nSm; ++i) {
+        l_sm[i].inRtc = false;
+    }
+}
+/*..........................................................................*/
+void QSPY_statReport(bool final) {
+    uint32_t i;
+    if (!l_on) {
+        return;
+    }
+
+    SNPRINTF_LINE("   <STAT-> %s AOs=%u,SMs=%u,MPs=%u,Lost=%u",
+                  final ? "Final  " : "Summary",
+                  (unsigned)l_nAo, (unsigned)l_nSm, (unsigned)l_nMp,
+                  (unsigned)l_nLost);
+    QSPY_printInfo();
+
+    for (i = 0U; i < l_nAo; ++i) {
+        AoStat const *a = &l_ao[i];
+        SNPRINTF_LINE("   <STAT-> AO=%s,Posts=%"PRIu64",Gets=%"PRIu64,
+                      QSPY_getObj(a->obj), a->posts, a->gets);
+        Histogram_print(&a->depth, "Depth");
+        if (a->posts != 0U) {
+            SNPRINTF_APPEND(",Min=%u", (unsigned)a->nMin);
+        }
+        Histogram_print(&a->latency, "Latency");
+        QSPY_printInfo();
+    }
+    for (i = 0U; i < l_nSm; ++i) {
+        SmStat const *s = &l_sm[i];
+        SNPRINTF_LINE("   <STAT-> SM=%s,RTCs=%"PRIu64,
+                      QSPY_getObj(s->obj), s->rtc.total);
+        Histogram_print(&s->rtc, "Step");
+        QSPY_printInfo();
+    }
+    for (i = 0U; i < l_nMp; ++i) {
+        MpStat const *m = &l_mp[i];
+        SNPRINTF_LINE("   <STAT-> MP=%s,Gets=%"PRIu64",Puts=%"PRIu64,
+                      QSPY_getObj(m->obj), m->gets, m->puts);
+        Histogram_print(&m->inUse, "InUse");
+        if (m->gets != 0U) {
+            SNPRINTF_APPEND(",Min=%u", (unsigned)m->nMin);
+        }
+        QSPY_printInfo();
+    }
+}
@@ -507,7 +507,7 @@ namespace eval ::qutest {
                         set filter(0) [expr $filter(0) | 0x000003FE]
                         set filter(1) [expr $filter(1) | 0x03800000]
                     } elseif {$arg == {AO}} { ;# active objects
-                        set filter(0) [expr $filter(0) | 0x0007FC00]
+                        set filter(0) [expr $filter(0) | 0x0087FC00]
                         set filter(2) [expr $filter(1) | 0x00002000]
                     } elseif {$arg == {EQ}} { ;# raw queues (for deferral)
                         set filter(0) [expr $filter(0) | 0x00780000]